@@ -12,60 +12,77 @@ local socket = require("socket")
 local host = "127.0.0.1"
 local port = 4433
 
-local listen, client
+local listen
+local clients = {}
 
-function sevo.load(args)
-    -- 查看luasocket版本
-    print("socket version: " .. socket._VERSION)
-
-    -- 创建一个TCP服务
-    listen = socket.bind(host, port)
-    print("Listen on: " .. tostring(listen:getsockname()))
+local function lost(client)
+    -- 断开连接
+    print("Lost connection: " .. tostring(client:getpeername()))
+    sevo.poll.remove(client)
+    clients[client] = nil
+    client:close()
 end
 
-function sevo.update(delta)
-    local readable, status
+local function on_client(client)
+    -- 有数据到达, 按行分帧, 不完整的行留在连接里等下次
+    local lines, count, err = client:receiveframes(64)
 
-    if client then
-        readable, _, status = socket.select({ client }, nil, 0)
-        if #readable > 0 then
-            -- 有数据到达
-            local command, msg = client:receive()
-
-            if command == nil or msg == "close" then
-                -- 断开连接
-                print("Lost connection: " .. tostring(client:getpeername()))
-                client = nil
-            else
-                -- 打印收到的内容
-                print(command)
-
-                if command == "quit" then
-                    -- 退出服务
-                    sevo.event.quit()
-                elseif command == "restart" then
-                    -- 重启服务
-                    sevo.event.quit("restart")
-                end
-
-                -- 回显给客户端
-                client:send(command .. "\n")
-            end
+    for i = 1, count do
+        local command = lines[i]:gsub("\r$", "")
+
+        if command == "close" then
+            lost(client)
+            return
         end
-    else
-        readable, _, status = socket.select({ listen }, nil, 0)
-        if #readable > 0 then
-            -- 新连接到达
-            client = listen:accept()
-            print("New connection: " .. tostring(client:getpeername()))
+
+        -- 打印收到的内容
+        print(command)
+
+        if command == "quit" then
+            -- 退出服务
+            sevo.event.quit()
+        elseif command == "restart" then
+            -- 重启服务
+            sevo.event.quit("restart")
         end
+
+        -- 回显给客户端, 发不完的部分由连接保留, 下次发送时先发出
+        client:sendframe(command)
+    end
+
+    if err and err ~= "timeout" then lost(client) end
+end
+
+local function on_listen(server)
+    -- 新连接到达
+    local client = server:accept()
+
+    if client then
+        client:settimeout(0)
+        client:setframing("delimiter", "\n")
+        clients[client] = true
+        sevo.poll.add(client, "r", on_client)
+        print("New connection: " .. tostring(client:getpeername()))
     end
 end
 
+function sevo.load(args)
+    -- 查看luasocket版本
+    print("socket version: " .. socket._VERSION)
+
+    -- 创建一个TCP服务, 由sevo.poll在主循环中回调, 不再每帧select
+    listen = socket.bind(host, port)
+    listen:settimeout(0)
+    sevo.poll.add(listen, "r", on_listen)
+    print("Listen on: " .. tostring(listen:getsockname()))
+end
+
 function sevo.quit()
+    sevo.poll.remove(listen)
     listen:close()
 
-    if client then
+    for client in pairs(clients) do
+        sevo.poll.remove(client)
         client:close()
     end
 end
@@ -0,0 +1,133 @@
+/*
+ *  atomic.h
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#ifndef __ATOMIC_H__
+#define __ATOMIC_H__
+
+#include "typedef.h"
+
+#if defined(_MSC_VER)
+# include <windows.h>
+# include <intrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    #define CACHELINE_SIZE  64
+
+#if defined(_MSC_VER)
+    #define ATOMIC_INLINE   static __inline
+
+    ATOMIC_INLINE void *atomic_load_ptr(void *volatile *p) {
+        void *v = *p;
+        _ReadWriteBarrier();
+        return v;
+    }
+
+    ATOMIC_INLINE void atomic_store_ptr(void *volatile *p, void *v) {
+        _InterlockedExchangePointer(p, v);
+    }
+
+    ATOMIC_INLINE void *atomic_xchg_ptr(void *volatile *p, void *v) {
+        return _InterlockedExchangePointer(p, v);
+    }
+
+    ATOMIC_INLINE int atomic_load_int(volatile int *p) {
+        int v = *p;
+        _ReadWriteBarrier();
+        return v;
+    }
+
+    ATOMIC_INLINE void atomic_store_int(volatile int *p, int v) {
+        _InterlockedExchange((volatile long *)p, v);
+    }
+
+    /* Returns the value before the addition. */
+    ATOMIC_INLINE int atomic_add_int(volatile int *p, int v) {
+        return _InterlockedExchangeAdd((volatile long *)p, v);
+    }
+
+    ATOMIC_INLINE int atomic_cas_int(volatile int *p, int expected, int desired) {
+        return expected == _InterlockedCompareExchange((volatile long *)p, desired, expected);
+    }
+
+    ATOMIC_INLINE long long atomic_add_ll(volatile long long *p, long long v) {
+        return _InterlockedExchangeAdd64(p, v);
+    }
+
+    ATOMIC_INLINE int atomic_load_acquire(volatile int *p) {
+        int v = *p;
+        _ReadWriteBarrier();
+        return v;
+    }
+
+    ATOMIC_INLINE void atomic_store_release(volatile int *p, int v) {
+        _ReadWriteBarrier();
+        *p = v;
+    }
+
+    ATOMIC_INLINE void atomic_fence(void) {
+        MemoryBarrier();
+    }
+#else
+    #define ATOMIC_INLINE   static inline
+
+    ATOMIC_INLINE void *atomic_load_ptr(void *volatile *p) {
+        return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+    }
+
+    ATOMIC_INLINE void atomic_store_ptr(void *volatile *p, void *v) {
+        __atomic_store_n(p, v, __ATOMIC_RELEASE);
+    }
+
+    ATOMIC_INLINE void *atomic_xchg_ptr(void *volatile *p, void *v) {
+        return __atomic_exchange_n(p, v, __ATOMIC_SEQ_CST);
+    }
+
+    ATOMIC_INLINE int atomic_load_int(volatile int *p) {
+        return __atomic_load_n(p, __ATOMIC_SEQ_CST);
+    }
+
+    ATOMIC_INLINE void atomic_store_int(volatile int *p, int v) {
+        __atomic_store_n(p, v, __ATOMIC_SEQ_CST);
+    }
+
+    /* Returns the value before the addition. */
+    ATOMIC_INLINE int atomic_add_int(volatile int *p, int v) {
+        return __atomic_fetch_add(p, v, __ATOMIC_SEQ_CST);
+    }
+
+    ATOMIC_INLINE int atomic_cas_int(volatile int *p, int expected, int desired) {
+        return __atomic_compare_exchange_n(p, &expected, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    }
+
+    ATOMIC_INLINE long long atomic_add_ll(volatile long long *p, long long v) {
+        return __atomic_fetch_add(p, v, __ATOMIC_SEQ_CST);
+    }
+
+    ATOMIC_INLINE int atomic_load_acquire(volatile int *p) {
+        return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+    }
+
+    ATOMIC_INLINE void atomic_store_release(volatile int *p, int v) {
+        __atomic_store_n(p, v, __ATOMIC_RELEASE);
+    }
+
+    ATOMIC_INLINE void atomic_fence(void) {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+#endif
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif  /* __ATOMIC_H__ */
@@ -0,0 +1,414 @@
+/*
+ *  channel.c
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#include "channel.h"
+#include "ring.h"
+
+#if defined(__linux__)
+# include <limits.h>
+# include <time.h>
+# include <unistd.h>
+# include <sys/syscall.h>
+# include <linux/futex.h>
+#endif
+
+struct channel_t {
+    int         type;
+    int         capacity;
+    int         head;
+    int         count;
+    int         waiting;
+    int         shutdown;
+    mc_mutex_t  mutex;
+    mc_cond_t   cond;
+    void        **items;
+    channel_t   *volatile link;
+
+    /* lock-free types */
+    ring_t      *ring;
+    volatile int seq;
+    volatile int sleepers;
+    volatile int closed;
+    volatile int kicked;    /* under the mutex for the lock type */
+};
+
+channel_t *channel_create(int capacity, int type) {
+    channel_t *ch = (channel_t *)mc_calloc(1, sizeof(channel_t));
+
+    ch->type = type;
+    ch->capacity = MC_MAX(1, capacity);
+
+    if (CHANNEL_LOCK == type) {
+        ch->items = (void **)mc_malloc(ch->capacity * sizeof(void *));
+    } else {
+        ch->ring = ring_create(ch->capacity, CHANNEL_MPSC == type);
+        ch->capacity = ring_capacity(ch->ring);
+    }
+
+    mc_mutex_create(&ch->mutex);
+    mc_cond_create(&ch->cond);
+
+    return ch;
+}
+
+void channel_destroy(channel_t *ch) {
+    if (ch) {
+        mc_cond_destroy(&ch->cond);
+        mc_mutex_destroy(&ch->mutex);
+        ring_destroy(ch->ring);
+        if (ch->items) mc_free(ch->items);
+        mc_free(ch);
+    }
+}
+
+/*
+ * Ring wakeup. The reader samples seq, announces itself in sleepers,
+ * checks the ring once more and sleeps only if seq is unchanged; a writer
+ * bumps seq after publishing whenever it sees a sleeper, so no wakeup
+ * is lost and writers skip the syscall while the reader is busy.
+ */
+#if defined(__linux__)
+static void ring_sleep(channel_t *ch, int seq, unsigned int timeout) {
+    struct timespec ts;
+
+    ts.tv_sec = timeout / 1000;
+    ts.tv_nsec = (long)(timeout % 1000) * 1000000L;
+
+    syscall(SYS_futex, &ch->seq, FUTEX_WAIT_PRIVATE, seq, &ts, NULL, 0);
+}
+
+static void ring_wake(channel_t *ch) {
+    atomic_add_int(&ch->seq, 1);
+    syscall(SYS_futex, &ch->seq, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+#else
+static void ring_sleep(channel_t *ch, int seq, unsigned int timeout) {
+    mc_mutex_lock(&ch->mutex);
+    if (seq == atomic_load_int(&ch->seq)) {
+        mc_cond_timedwait(&ch->cond, &ch->mutex, timeout);
+    }
+    mc_mutex_unlock(&ch->mutex);
+}
+
+static void ring_wake(channel_t *ch) {
+    mc_mutex_lock(&ch->mutex);
+    atomic_add_int(&ch->seq, 1);
+    mc_cond_broadcast(&ch->cond);
+    mc_mutex_unlock(&ch->mutex);
+}
+#endif
+
+/*
+ * A kick wakes channel_wait callers without data. It stays set until a
+ * wait takes it, so a kick landing before the waiter sleeps is not lost.
+ */
+static void ring_kick(channel_t *ch) {
+    atomic_store_int(&ch->kicked, 1);
+    atomic_fence();
+    if (atomic_load_int(&ch->sleepers) > 0) {
+        ring_wake(ch);
+    }
+}
+
+static int ring_write(channel_t *ch, void **p, int n) {
+    if (atomic_load_int(&ch->closed)) {
+        return 0;
+    }
+
+    n = ring_push_many(ch->ring, p, n);
+
+    if (n > 0) {
+        atomic_fence();
+        if (atomic_load_int(&ch->sleepers) > 0) {
+            ring_wake(ch);
+        }
+    }
+    return n;
+}
+
+static int ring_wait(channel_t *ch, unsigned int timeout, int kickable) {
+    unsigned long long deadline = 0;
+    int n = ring_size(ch->ring);
+
+    while ((0 == n) && (timeout > 0) && !atomic_load_int(&ch->closed)) {
+        unsigned long long now = mc_millisec(NULL);
+        int seq = atomic_load_int(&ch->seq);
+
+        if (0 == deadline) {
+            deadline = now + timeout;
+        } else if (now >= deadline) {
+            break;
+        }
+
+        atomic_add_int(&ch->sleepers, 1);
+
+        n = ring_size(ch->ring);
+
+        if (kickable && atomic_cas_int(&ch->kicked, 1, 0)) {
+            atomic_add_int(&ch->sleepers, -1);
+            break;
+        }
+
+        if ((0 == n) && !atomic_load_int(&ch->closed)) {
+            ring_sleep(ch, seq, (unsigned int)(deadline - now));
+            n = ring_size(ch->ring);
+        }
+
+        atomic_add_int(&ch->sleepers, -1);
+    }
+    return n > 0;
+}
+
+/*
+ * An mpsc producer claims its cell before publishing it, so the ring
+ * may look non-empty while the pop still finds nothing. Retry until
+ * the cell is published or the deadline passes.
+ */
+static int ring_read(channel_t *ch, void **p, int max, unsigned int timeout) {
+    unsigned long long deadline, now;
+    int n = ring_pop_many(ch->ring, p, max);
+
+    if (n > 0) {
+        return n;
+    }
+
+    deadline = mc_millisec(NULL) + timeout;
+
+    if (!ring_wait(ch, timeout, 0)) {
+        return 0;
+    }
+
+    for (;;) {
+        n = ring_pop_many(ch->ring, p, max);
+
+        if ((n > 0) || (0 == timeout)) {
+            break;
+        }
+
+        now = mc_millisec(NULL);
+
+        if (now >= deadline || !ring_wait(ch, (unsigned int)(deadline - now), 0)) {
+            break;
+        }
+    }
+    return n;
+}
+
+static void lock_kick(channel_t *ch) {
+    mc_mutex_lock(&ch->mutex);
+    ch->kicked = 1;
+    if (ch->waiting > 0) {
+        mc_cond_broadcast(&ch->cond);
+    }
+    mc_mutex_unlock(&ch->mutex);
+}
+
+/*
+ * Called locked, returns once there is data, on shutdown or on timeout,
+ * and when kickable also on a kick.
+ */
+static void lock_wait(channel_t *ch, unsigned int timeout, int kickable) {
+    unsigned long long deadline;
+
+    if ((ch->count > 0) || ch->shutdown || (0 == timeout)) {
+        return;
+    }
+
+    if (kickable && ch->kicked) {
+        ch->kicked = 0;
+        return;
+    }
+
+    deadline = mc_millisec(NULL) + timeout;
+
+    for (;;) {
+        unsigned long long now;
+
+        ch->waiting += 1;
+        mc_cond_timedwait(&ch->cond, &ch->mutex, timeout);
+        ch->waiting -= 1;
+
+        if ((ch->count > 0) || ch->shutdown) {
+            break;
+        }
+
+        if (kickable && ch->kicked) {
+            ch->kicked = 0;
+            break;
+        }
+
+        now = mc_millisec(NULL);
+
+        if (now >= deadline) {
+            break;
+        }
+        timeout = (unsigned int)(deadline - now);
+    }
+}
+
+int channel_write(channel_t *ch, void *p) {
+    return (1 == channel_write_many(ch, &p, 1)) ? 0 : -1;
+}
+
+static void channel_kick(channel_t *ch) {
+    if (ch->ring) {
+        ring_kick(ch);
+    } else {
+        lock_kick(ch);
+    }
+}
+
+static int lock_write(channel_t *ch, void **p, int n) {
+    int i;
+
+    mc_mutex_lock(&ch->mutex);
+
+    if (ch->shutdown) {
+        n = 0;
+    } else {
+        n = MC_MIN(n, ch->capacity - ch->count);
+    }
+
+    for (i = 0; i < n; ++i) {
+        ch->items[(ch->head + ch->count) % ch->capacity] = p[i];
+        ch->count += 1;
+    }
+
+    if ((n > 0) && (ch->waiting > 0)) {
+        mc_cond_broadcast(&ch->cond);
+    }
+
+    mc_mutex_unlock(&ch->mutex);
+
+    return n;
+}
+
+int channel_write_many(channel_t *ch, void **p, int n) {
+    channel_t *link;
+
+    n = ch->ring ? ring_write(ch, p, n) : lock_write(ch, p, n);
+
+    if (n > 0) {
+        link = (channel_t *)atomic_load_ptr((void *volatile *)&ch->link);
+        if (link) {
+            channel_kick(link);
+        }
+    }
+    return n;
+}
+
+void channel_link(channel_t *ch, channel_t *target) {
+    atomic_store_ptr((void *volatile *)&ch->link, target);
+}
+
+int channel_read(channel_t *ch, void **p, unsigned int timeout) {
+    return (1 == channel_read_many(ch, p, 1, timeout)) ? 0 : -1;
+}
+
+int channel_read_many(channel_t *ch, void **p, int max, unsigned int timeout) {
+    int i, n;
+
+    if (ch->ring) {
+        return ring_read(ch, p, max, timeout);
+    }
+
+    mc_mutex_lock(&ch->mutex);
+
+    lock_wait(ch, timeout, 0);
+
+    n = MC_MIN(max, ch->count);
+
+    for (i = 0; i < n; ++i) {
+        p[i] = ch->items[ch->head];
+        ch->head = (ch->head + 1) % ch->capacity;
+        ch->count -= 1;
+    }
+
+    if (0 == ch->count) {
+        ch->head = 0;
+    }
+
+    mc_mutex_unlock(&ch->mutex);
+
+    return n;
+}
+
+int channel_wait(channel_t *ch, unsigned int timeout) {
+    int readable;
+
+    if (ch->ring) {
+        return ring_wait(ch, timeout, 1);
+    }
+
+    mc_mutex_lock(&ch->mutex);
+    lock_wait(ch, timeout, 1);
+    readable = ch->count > 0;
+    mc_mutex_unlock(&ch->mutex);
+
+    return readable;
+}
+
+int channel_size(channel_t *ch) {
+    int n;
+
+    if (ch->ring) {
+        return ring_size(ch->ring);
+    }
+
+    mc_mutex_lock(&ch->mutex);
+    n = ch->count;
+    mc_mutex_unlock(&ch->mutex);
+
+    return n;
+}
+
+int channel_readable(channel_t *ch) {
+    return channel_size(ch) > 0;
+}
+
+int channel_writeable(channel_t *ch) {
+    int writeable;
+
+    if (ch->ring) {
+        return !atomic_load_int(&ch->closed) && (ring_size(ch->ring) < ch->capacity);
+    }
+
+    mc_mutex_lock(&ch->mutex);
+    writeable = !ch->shutdown && (ch->count < ch->capacity);
+    mc_mutex_unlock(&ch->mutex);
+
+    return writeable;
+}
+
+void channel_shutdown(channel_t *ch) {
+    if (ch->ring) {
+        atomic_store_int(&ch->closed, 1);
+        ring_wake(ch);
+        return;
+    }
+
+    mc_mutex_lock(&ch->mutex);
+    ch->shutdown = 1;
+    mc_cond_broadcast(&ch->cond);
+    mc_mutex_unlock(&ch->mutex);
+}
+
+int channel_is_shutdown(channel_t *ch) {
+    int shutdown;
+
+    if (ch->ring) {
+        return atomic_load_int(&ch->closed);
+    }
+
+    mc_mutex_lock(&ch->mutex);
+    shutdown = ch->shutdown;
+    mc_mutex_unlock(&ch->mutex);
+
+    return shutdown;
+}
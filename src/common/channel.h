@@ -0,0 +1,73 @@
+/*
+ *  channel.h
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#ifndef __CHANNEL_H__
+#define __CHANNEL_H__
+
+#include "typedef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /* Bounded pointer queue with batch operations and blocking reads. */
+    typedef struct channel_t channel_t;
+
+    /*
+     * LOCK takes any number of readers and writers under a mutex. SPSC
+     * and MPSC are lock-free rings for one reader, waiting on a futex
+     * (linux) or a condition variable only when the ring is empty.
+     */
+    enum {
+        CHANNEL_LOCK = 0,
+        CHANNEL_SPSC,
+        CHANNEL_MPSC,
+    };
+
+    channel_t *channel_create(int capacity, int type);
+    void channel_destroy(channel_t *ch);
+
+    /* Never blocks. Returns 0 on success, -1 if full or shut down. */
+    int channel_write(channel_t *ch, void *p);
+
+    /* Moves as many as fit in one go, returns the count written. */
+    int channel_write_many(channel_t *ch, void **p, int n);
+
+    /* Waits up to timeout ms for data, 0 polls. Returns 0 or -1. */
+    int channel_read(channel_t *ch, void **p, unsigned int timeout);
+
+    /* Waits like channel_read, then takes up to max. Returns the count. */
+    int channel_read_many(channel_t *ch, void **p, int max, unsigned int timeout);
+
+    /*
+     * Waits like channel_read without taking anything, also returning
+     * early when a linked channel was written. Returns readable.
+     */
+    int channel_wait(channel_t *ch, unsigned int timeout);
+
+    /*
+     * Every later write to ch also wakes channel_wait on target, so one
+     * reader can sleep on target for both. target must outlive ch; NULL
+     * unlinks.
+     */
+    void channel_link(channel_t *ch, channel_t *target);
+
+    int channel_size(channel_t *ch);
+    int channel_readable(channel_t *ch);
+    int channel_writeable(channel_t *ch);
+
+    /* Wakes blocked readers, further writes fail. */
+    void channel_shutdown(channel_t *ch);
+    int channel_is_shutdown(channel_t *ch);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif  /* __CHANNEL_H__ */
@@ -8,10 +8,13 @@
  */
 
 #include "logger.h"
+#include "channel.h"
 #include <stdio.h>
 
+#define LOGGER_BATCH    64
+
 typedef struct logger_context_t {
-    mc_chan_t   *chan;
+    channel_t   *chan;
     mc_mutex_t  mtx;
     mc_cond_t   cnd;
 } logger_context_t;
@@ -21,26 +24,19 @@ static int g_level = LGL_MIN;
 static void logger_thread(void *param) {
     logger_context_t *ctx = *(logger_context_t **)param;
     mc_sstr_t lmsg;
-    mc_fps_t fps;
-    void *p;
+    void *p[LOGGER_BATCH];
+    int i, n;
 
     if (ctx) {
-        mc_fps_init(&fps, NULL, 10);
-
-        while (!mc_chan_is_shutdown(ctx->chan) || mc_chan_size(ctx->chan) > 0) {
-            mc_fps_update(&fps, NULL);
-
-            while (mc_chan_readable(ctx->chan)) {
-                p = NULL;
-                mc_chan_read(ctx->chan, &p);
-                if (p) {
-                    lmsg = (mc_sstr_t)p;
-                    fprintf(stdout, "%s", lmsg);
-                    mc_sstr_destroy(lmsg);
-                }
+        /* sleeps until a line arrives, the timeout only rechecks shutdown */
+        while (!channel_is_shutdown(ctx->chan) || channel_size(ctx->chan) > 0) {
+            n = channel_read_many(ctx->chan, p, LOGGER_BATCH, 100);
+
+            for (i = 0; i < n; ++i) {
+                lmsg = (mc_sstr_t)p[i];
+                fprintf(stdout, "%s", lmsg);
+                mc_sstr_destroy(lmsg);
             }
-
-            mc_fps_wait(&fps, NULL);
         }
 
         mc_mutex_lock(&ctx->mtx);
@@ -56,7 +52,7 @@ int logger_init(void) {
 
     if (!g_ctx) {
         g_ctx = (logger_context_t *)mc_malloc(sizeof(logger_context_t));
-        g_ctx->chan = mc_chan_create(2048);
+        g_ctx->chan = channel_create(2048, CHANNEL_MPSC);
 
         mc_mutex_create(&g_ctx->mtx);
         mc_cond_create(&g_ctx->cnd);
@@ -69,13 +65,13 @@ int logger_init(void) {
 void logger_deinit(void) {
     if (g_ctx) {
         mc_mutex_lock(&g_ctx->mtx);
-        mc_chan_shutdown(g_ctx->chan);
+        channel_shutdown(g_ctx->chan);
         mc_cond_wait(&g_ctx->cnd, &g_ctx->mtx);
         mc_mutex_unlock(&g_ctx->mtx);
 
         mc_cond_destroy(&g_ctx->cnd);
         mc_mutex_destroy(&g_ctx->mtx);
-        mc_chan_destroy(g_ctx->chan);
+        channel_destroy(g_ctx->chan);
 
         mc_free(g_ctx);
         g_ctx = NULL;
@@ -91,7 +87,7 @@ int logger_level(int level) {
 }
 
 void logger_flush(void) {
-    while (mc_chan_size(g_ctx->chan) > 0) {
+    while (channel_size(g_ctx->chan) > 0) {
         mc_sleep(10);
     }
 }
@@ -145,7 +141,7 @@ int vlogger(int type, int level, const char *fmt, va_list argv) {
     lmsg = mc_sstr_cat_vformat(lmsg, fmt, argv);
     lmsg = mc_sstr_cat_string(lmsg, "\n");
 
-    if (0 != mc_chan_write(g_ctx->chan, lmsg)) {
+    if (0 != channel_write(g_ctx->chan, lmsg)) {
         mc_sstr_destroy(lmsg);
         return -1;
     }
@@ -0,0 +1,68 @@
+/*
+ *  mpsc.c
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#include "mpsc.h"
+
+#define node_next(n)    ((mpsc_node_t *)atomic_load_ptr((void *volatile *)&(n)->next))
+
+void mpsc_init(mpsc_t *q) {
+    q->stub.next = NULL;
+    q->head = &q->stub;
+    q->tail = &q->stub;
+}
+
+void mpsc_push(mpsc_t *q, mpsc_node_t *n) {
+    mpsc_node_t *prev;
+
+    n->next = NULL;
+    prev = (mpsc_node_t *)atomic_xchg_ptr((void *volatile *)&q->head, n);
+    atomic_store_ptr((void *volatile *)&prev->next, n);
+}
+
+mpsc_node_t *mpsc_pop(mpsc_t *q) {
+    mpsc_node_t *tail = q->tail;
+    mpsc_node_t *next = node_next(tail);
+    mpsc_node_t *head;
+
+    if (&q->stub == tail) {
+        if (!next) {
+            return NULL;
+        }
+        q->tail = next;
+        tail = next;
+        next = node_next(next);
+    }
+
+    if (next) {
+        q->tail = next;
+        return tail;
+    }
+
+    head = (mpsc_node_t *)atomic_load_ptr((void *volatile *)&q->head);
+
+    if (tail != head) {
+        return NULL;
+    }
+
+    /* Last node, park the stub behind it so it can be detached. */
+    mpsc_push(q, &q->stub);
+
+    next = node_next(tail);
+
+    if (next) {
+        q->tail = next;
+        return tail;
+    }
+
+    return NULL;
+}
+
+int mpsc_empty(mpsc_t *q) {
+    return (&q->stub == q->tail) && (&q->stub == atomic_load_ptr((void *volatile *)&q->head));
+}
@@ -0,0 +1,45 @@
+/*
+ *  mpsc.h
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#ifndef __MPSC_H__
+#define __MPSC_H__
+
+#include "atomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /* Intrusive node, embed it as the first member of a message. */
+    typedef struct mpsc_node_t {
+        struct mpsc_node_t *volatile next;
+    } mpsc_node_t;
+
+    /* Unbounded lock-free queue, many producers and one consumer. */
+    typedef struct mpsc_t {
+        mpsc_node_t *volatile head;
+        char        pad[CACHELINE_SIZE - sizeof(void *)];
+        mpsc_node_t *tail;
+        mpsc_node_t stub;
+    } mpsc_t;
+
+    void mpsc_init(mpsc_t *q);
+
+    /* Any thread. */
+    void mpsc_push(mpsc_t *q, mpsc_node_t *n);
+
+    /* Consumer only, NULL when empty or a producer is halfway through. */
+    mpsc_node_t *mpsc_pop(mpsc_t *q);
+    int mpsc_empty(mpsc_t *q);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif  /* __MPSC_H__ */
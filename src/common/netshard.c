@@ -0,0 +1,892 @@
+/*
+ *  netshard.c
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#include "netshard.h"
+#include "channel.h"
+#include "atomic.h"
+#include "logger.h"
+#include <string.h>
+
+#if defined(__linux__)
+# include <sys/ioctl.h>
+# include <sys/socket.h>
+#elif defined(__APPLE__)
+# include <sys/socket.h>
+#endif
+
+#define NETSHARD_TICK       1       /* ms a shard blocks in mc_net_update */
+#define NETSHARD_BATCH      64
+#define NETSHARD_CMDSIZE    4096
+#define NETSHARD_EVTSIZE    65536
+#define NETSHARD_SLOTS      64
+#define NETSHARD_STATS      4096    /* slots per block of queue counters */
+
+#define SLOT_MASK           0xFFFFFF
+#define id_make(gen, shard, slot)   (((long long)(gen) << 32) | ((long long)(shard) << 24) | (long long)(slot))
+
+/* Commands answered synchronously, peer commands are NETSHARD_*. */
+enum {
+    CMD_SERVER = 0x100,
+    CMD_CONNECT,
+    CMD_CONN_TIMEOUT,
+    CMD_AUTH_TIMEOUT,
+    CMD_CLOSE_GROUP,
+    CMD_BROADCAST,
+};
+
+#define cmd_sync(op)    ((op) >= CMD_SERVER && (op) <= CMD_AUTH_TIMEOUT)
+
+/* One payload shared by the broadcast commands of every shard. */
+typedef struct netblob_t {
+    volatile int    ref;
+    int             size;
+    char            data[1];
+} netblob_t;
+
+enum {
+    SHARD_STOPPED = 0,
+    SHARD_RUNNING,
+};
+
+typedef struct netcmd_t {
+    int             op;
+    long long       id;
+    int             mode;
+    unsigned short  port;
+    int             backlog;
+    unsigned long long value;
+    volatile int    done;
+    long long       result;
+    netshard_peer_t info;
+    netblob_t       *blob;
+    int             size;
+    char            data[1];
+} netcmd_t;
+
+/* Output still queued for a slot, read by the owner without locks. */
+typedef struct netstat_t {
+    volatile int    pending;    /* posted bytes the shard has not sent */
+    volatile int    outq;       /* kernel queue as of the shard's last look */
+} netstat_t;
+
+typedef struct netshard_t netshard_t;
+
+typedef struct speer_t {
+    netshard_t      *shard;
+    mc_peer_t       *peer;
+    long long       id;
+    long long       group;
+    int             listener;   /* index in the shard's listeners plus one */
+    int             sending;    /* on the shard's sending list */
+} speer_t;
+
+struct netshard_t {
+    netpool_t       *pool;
+    int             index;
+    mc_net_t        *net;
+    channel_t       *cmds;
+    speer_t         **slots;
+    unsigned int    *gens;
+    int             *freeslots;
+    int             nfree;
+    int             capacity;
+    netshard_event_t **backlog;     /* events the full queue refused */
+    int             nbacklog;
+    int             cbacklog;
+    speer_t         **listeners;    /* closed by group without a slot scan */
+    int             nlisteners;
+    int             clisteners;
+    netstat_t       **stats;        /* blocks never move once published */
+    long long       *sending;       /* peers whose kernel queue is watched */
+    int             nsending;
+    int             csending;
+    int             status;
+    mc_mutex_t      mutex;
+    mc_cond_t       cond;
+};
+
+struct netpool_t {
+    int             size;
+    volatile int    quit;
+    volatile int    next;
+    channel_t       *events;
+    netshard_t      shards[1];
+};
+
+/*
+ * Never blocks, a shard waiting on the owner could not serve its
+ * commands. Refused events queue up in order and the shard stops
+ * reading its net until they are gone.
+ */
+static void shard_emit(netshard_t *s, netshard_event_t *e) {
+    if ((0 == s->nbacklog) && (0 == channel_write(s->pool->events, e))) {
+        return;
+    }
+
+    if (atomic_load_int(&s->pool->quit)) {
+        netpool_free(e);
+        return;
+    }
+
+    if (s->nbacklog == s->cbacklog) {
+        s->cbacklog = MC_MAX(s->cbacklog * 2, NETSHARD_BATCH);
+        s->backlog = (netshard_event_t **)mc_realloc(s->backlog, s->cbacklog * sizeof(netshard_event_t *));
+    }
+    s->backlog[s->nbacklog++] = e;
+}
+
+/* Returns the count still waiting. */
+static int shard_flush(netshard_t *s) {
+    int n;
+
+    if (s->nbacklog > 0) {
+        n = channel_write_many(s->pool->events, (void **)s->backlog, s->nbacklog);
+
+        if (n > 0) {
+            s->nbacklog -= n;
+            memmove(s->backlog, s->backlog + n, s->nbacklog * sizeof(netshard_event_t *));
+        }
+    }
+    return s->nbacklog;
+}
+
+static void blob_release(netblob_t *blob) {
+    if (1 == atomic_add_int(&blob->ref, -1)) {
+        mc_free(blob);
+    }
+}
+
+/* Counters of the id's slot, NULL before its shard made the slot. */
+static netstat_t *pool_stat(netpool_t *pool, long long id) {
+    int shard = netshard_of(id), slot = (int)(id & SLOT_MASK);
+    netstat_t *block;
+
+    if (shard >= pool->size) {
+        return NULL;
+    }
+
+    block = (netstat_t *)atomic_load_ptr((void *volatile *)&pool->shards[shard].stats[slot / NETSHARD_STATS]);
+    return block ? block + slot % NETSHARD_STATS : NULL;
+}
+
+static void pool_pending(netpool_t *pool, const long long *ids, int count, int size) {
+    netstat_t *st;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        if (!!(st = pool_stat(pool, ids[i]))) {
+            atomic_add_int(&st->pending, size);
+        }
+    }
+}
+
+/* Frees an async command, the caller owns sync ones and is woken. */
+static void cmd_done(netshard_t *s, netcmd_t *cmd) {
+    if (cmd_sync(cmd->op)) {
+        mc_mutex_lock(&s->mutex);
+        atomic_store_int(&cmd->done, 1);
+        mc_cond_broadcast(&s->cond);
+        mc_mutex_unlock(&s->mutex);
+        return;
+    }
+
+    if (cmd->blob) {
+        blob_release(cmd->blob);
+    }
+    mc_free(cmd);
+}
+
+static void peer_snapshot(speer_t *sp, netshard_peer_t *info) {
+    mc_peer_t *peer = sp->peer;
+
+    info->id = sp->id;
+    info->parent = 0;
+    info->fd = mc_net_socket(peer);
+    info->type = mc_net_type(peer);
+    info->listener = !!sp->listener;
+
+    if (mc_net_is_connecting(peer)) {
+        info->status = NETSHARD_CONNECTING;
+    } else if (mc_net_is_connected(peer)) {
+        info->status = NETSHARD_CONNECTED;
+    } else if (mc_net_is_closing(peer)) {
+        info->status = NETSHARD_CLOSING;
+    } else {
+        info->status = NETSHARD_CLOSED;
+    }
+
+    mc_net_hwaddr(peer, info->hwaddr);
+}
+
+static speer_t *peer_find(netshard_t *s, long long id) {
+    int slot = (int)(id & SLOT_MASK);
+    speer_t *sp;
+
+    if ((slot >= s->capacity) || !(sp = s->slots[slot])) {
+        return NULL;
+    }
+    return (sp->id == id) ? sp : NULL;
+}
+
+/* Runs on the shard thread, mc_net deletes peers from inside its calls. */
+static void on_peer_delete(mc_peer_t *peer) {
+    speer_t *sp = (speer_t *)mc_net_get(peer);
+    netshard_event_t *e;
+    netshard_t *s;
+    int slot;
+
+    if (!sp) {
+        return;
+    }
+
+    s = sp->shard;
+    slot = (int)(sp->id & SLOT_MASK);
+    atomic_store_int(&s->stats[slot / NETSHARD_STATS][slot % NETSHARD_STATS].outq, 0);
+
+    e = (netshard_event_t *)mc_calloc(1, sizeof(netshard_event_t));
+    e->peer.id = sp->id;
+    e->peer.fd = -1;
+    e->peer.status = NETSHARD_CLOSED;
+    shard_emit(s, e);
+
+    if (sp->listener) {
+        speer_t *last = s->listeners[--s->nlisteners];
+
+        s->listeners[sp->listener - 1] = last;
+        last->listener = sp->listener;
+    }
+
+    s->slots[slot] = NULL;
+    s->gens[slot] = (s->gens[slot] + 1) & 0x7FFFFFFF;
+    if (0 == s->gens[slot]) {
+        s->gens[slot] = 1;
+    }
+    s->freeslots[s->nfree++] = slot;
+
+    mc_net_set(peer, NULL);
+    mc_free(sp);
+}
+
+static speer_t *peer_register(netshard_t *s, mc_peer_t *peer, long long group, int listener) {
+    speer_t *sp;
+    int slot;
+
+    if (0 == s->nfree) {
+        int i, capacity = s->capacity * 2;
+
+        if (capacity > SLOT_MASK + 1) {
+            return NULL;
+        }
+
+        s->slots = (speer_t **)mc_realloc(s->slots, capacity * sizeof(speer_t *));
+        s->gens = (unsigned int *)mc_realloc(s->gens, capacity * sizeof(unsigned int));
+        s->freeslots = (int *)mc_realloc(s->freeslots, capacity * sizeof(int));
+
+        for (i = capacity - 1; i >= s->capacity; --i) {
+            s->slots[i] = NULL;
+            s->gens[i] = 1;
+            s->freeslots[s->nfree++] = i;
+        }
+        s->capacity = capacity;
+    }
+
+    slot = s->freeslots[--s->nfree];
+
+    if (!s->stats[slot / NETSHARD_STATS]) {
+        atomic_store_ptr((void *volatile *)&s->stats[slot / NETSHARD_STATS], mc_calloc(NETSHARD_STATS, sizeof(netstat_t)));
+    }
+
+    sp = (speer_t *)mc_malloc(sizeof(speer_t));
+    sp->shard = s;
+    sp->peer = peer;
+    sp->id = id_make(s->gens[slot], s->index, slot);
+    sp->group = group ? group : sp->id;
+    sp->listener = 0;
+    sp->sending = 0;
+
+    if (listener) {
+        if (s->nlisteners == s->clisteners) {
+            s->clisteners = MC_MAX(s->clisteners * 2, 4);
+            s->listeners = (speer_t **)mc_realloc(s->listeners, s->clisteners * sizeof(speer_t *));
+        }
+        s->listeners[s->nlisteners++] = sp;
+        sp->listener = s->nlisteners;
+    }
+
+    s->slots[slot] = sp;
+
+    mc_net_set(peer, sp);
+    mc_net_on_delete(peer, on_peer_delete);
+
+    return sp;
+}
+
+/* Watches the kernel queue of a peer just sent to until it drains. */
+static void shard_sent(netshard_t *s, speer_t *sp) {
+    if (sp->sending) {
+        return;
+    }
+
+    if (s->nsending == s->csending) {
+        s->csending = MC_MAX(s->csending * 2, NETSHARD_BATCH);
+        s->sending = (long long *)mc_realloc(s->sending, s->csending * sizeof(long long));
+    }
+    s->sending[s->nsending++] = sp->id;
+    sp->sending = 1;
+}
+
+/* Publishes the kernel queues here, the socket belongs to this thread. */
+static void shard_outq(netshard_t *s) {
+    speer_t *sp;
+    int i, q, n = 0;
+
+    for (i = 0; i < s->nsending; ++i) {
+        if (!(sp = peer_find(s, s->sending[i]))) {
+            continue;
+        }
+
+        q = netshard_outq(mc_net_socket(sp->peer));
+        atomic_store_int(&pool_stat(s->pool, sp->id)->outq, q);
+
+        if (q > 0) {
+            s->sending[n++] = sp->id;
+        } else {
+            sp->sending = 0;
+        }
+    }
+    s->nsending = n;
+}
+
+static void shard_command(netshard_t *s, netcmd_t *cmd) {
+    mc_peer_t *peer = NULL;
+    speer_t *sp;
+    int i;
+
+    switch (cmd->op) {
+    case CMD_SERVER:
+    case CMD_CONNECT:
+        if (CMD_SERVER == cmd->op) {
+            peer = mc_net_server(s->net, cmd->mode, cmd->data, cmd->port, cmd->backlog);
+        } else {
+            peer = mc_net_connect(s->net, cmd->mode, cmd->data, cmd->port);
+        }
+
+        sp = peer ? peer_register(s, peer, cmd->id, CMD_SERVER == cmd->op) : NULL;
+
+        if (sp) {
+            peer_snapshot(sp, &cmd->info);
+            cmd->result = sp->id;
+        } else if (peer) {
+            mc_net_close(peer);
+        }
+        break;
+    case CMD_CONN_TIMEOUT:
+        cmd->result = mc_net_conn_timeout(s->net, (int)cmd->value);
+        break;
+    case CMD_AUTH_TIMEOUT:
+        cmd->result = mc_net_auth_timeout(s->net, (int)cmd->value);
+        break;
+    case CMD_CLOSE_GROUP:
+        for (i = 0; i < s->nlisteners; ++i) {
+            if (s->listeners[i]->group == cmd->id) {
+                mc_net_close(s->listeners[i]->peer);
+                break;
+            }
+        }
+        break;
+    case CMD_BROADCAST:
+        for (i = 0; i < cmd->size / (int)sizeof(long long); ++i) {
+            sp = peer_find(s, ((long long *)cmd->data)[i]);
+            if (sp) {
+                mc_net_send(sp->peer, cmd->blob->data, cmd->blob->size);
+                shard_sent(s, sp);
+            }
+        }
+        pool_pending(s->pool, (long long *)cmd->data, cmd->size / (int)sizeof(long long), -cmd->blob->size);
+        break;
+    default:
+        sp = peer_find(s, cmd->id);
+
+        if (NETSHARD_SEND == cmd->op) {
+            pool_pending(s->pool, &cmd->id, 1, -cmd->size);
+        }
+
+        if (sp) {
+            switch (cmd->op) {
+            case NETSHARD_CLOSE:    mc_net_close(sp->peer); break;
+            case NETSHARD_AUTH:     mc_net_auth(sp->peer, cmd->data, cmd->size); break;
+            case NETSHARD_ACCEPT:   mc_net_accept(sp->peer, cmd->data, cmd->size); break;
+            case NETSHARD_REJECT:   mc_net_reject(sp->peer, cmd->data, cmd->size); break;
+            case NETSHARD_PING:     mc_net_ping(sp->peer, cmd->value); break;
+            case NETSHARD_PONG:     mc_net_pong(sp->peer, cmd->value); break;
+            case NETSHARD_SEND:     mc_net_send(sp->peer, cmd->data, cmd->size); shard_sent(s, sp); break;
+            }
+        }
+        break;
+    }
+
+    cmd_done(s, cmd);
+}
+
+/* Wraps events, adopting connections accepted by one of our listeners. */
+static void shard_events(netshard_t *s) {
+    mc_net_event_t *evt;
+    netshard_event_t *e;
+    speer_t *sp, *psp;
+    mc_peer_t *parent;
+    long long group;
+
+    while ((0 == s->nbacklog) && !!(evt = mc_net_recv(s->net))) {
+        sp = (speer_t *)mc_net_get(evt->peer);
+        group = 0;
+
+        if (!sp) {
+            if (mc_net_is_closing(evt->peer) || mc_net_is_closed(evt->peer)) {
+                mc_free(evt);
+                continue;
+            }
+
+            parent = mc_net_parent(evt->peer);
+            psp = parent ? (speer_t *)mc_net_get(parent) : NULL;
+            sp = psp ? peer_register(s, evt->peer, psp->group, 0) : NULL;
+
+            if (!sp) {
+                mc_net_close(evt->peer);
+                mc_free(evt);
+                continue;
+            }
+            group = psp->group;
+        }
+
+        e = (netshard_event_t *)mc_malloc(sizeof(netshard_event_t));
+        e->evt = evt;
+        peer_snapshot(sp, &e->peer);
+        e->peer.parent = group;
+
+        shard_emit(s, e);
+    }
+}
+
+static void shard_main(void *param) {
+    netshard_t *s = (netshard_t *)param;
+    netpool_t *pool = s->pool;
+    void *cmds[NETSHARD_BATCH];
+    int i, n;
+
+    s->net = mc_net_create();
+
+    while (!atomic_load_int(&pool->quit)) {
+        n = channel_read_many(s->cmds, cmds, NETSHARD_BATCH, 0);
+
+        for (i = 0; i < n; ++i) {
+            shard_command(s, (netcmd_t *)cmds[i]);
+        }
+        shard_outq(s);
+
+        if (shard_flush(s) > 0) {
+            mc_sleep(NETSHARD_TICK);
+            continue;
+        }
+
+        mc_net_update(s->net, NETSHARD_TICK);
+        shard_events(s);
+    }
+
+    while ((n = channel_read_many(s->cmds, cmds, NETSHARD_BATCH, 0)) > 0) {
+        for (i = 0; i < n; ++i) {
+            cmd_done(s, (netcmd_t *)cmds[i]);
+        }
+    }
+
+    mc_net_destroy(s->net);
+    s->net = NULL;
+
+    for (i = 0; i < s->nbacklog; ++i) {
+        netpool_free(s->backlog[i]);
+    }
+    s->nbacklog = 0;
+
+    for (i = 0; i < s->capacity; ++i) {
+        if (s->slots[i]) {
+            mc_free(s->slots[i]);
+            s->slots[i] = NULL;
+        }
+    }
+
+    mc_mutex_lock(&s->mutex);
+    s->status = SHARD_STOPPED;
+    mc_cond_broadcast(&s->cond);
+    mc_mutex_unlock(&s->mutex);
+}
+
+netpool_t *netpool_create(int threads) {
+    netpool_t *pool;
+    int i;
+
+    threads = MC_MAX(1, MC_MIN(threads, NETSHARD_MAX));
+
+    pool = (netpool_t *)mc_calloc(1, sizeof(netpool_t) + (threads - 1) * sizeof(netshard_t));
+    pool->size = threads;
+    pool->events = channel_create(NETSHARD_EVTSIZE, CHANNEL_MPSC);
+
+    for (i = 0; i < threads; ++i) {
+        netshard_t *s = pool->shards + i;
+        mc_thread_t t = { shard_main, s };
+        int j;
+
+        s->pool = pool;
+        s->index = i;
+        s->cmds = channel_create(NETSHARD_CMDSIZE, CHANNEL_MPSC);
+        s->capacity = NETSHARD_SLOTS;
+        s->slots = (speer_t **)mc_calloc(s->capacity, sizeof(speer_t *));
+        s->gens = (unsigned int *)mc_malloc(s->capacity * sizeof(unsigned int));
+        s->freeslots = (int *)mc_malloc(s->capacity * sizeof(int));
+        s->stats = (netstat_t **)mc_calloc((SLOT_MASK + 1) / NETSHARD_STATS, sizeof(netstat_t *));
+
+        for (j = s->capacity - 1; j >= 0; --j) {
+            s->gens[j] = 1;
+            s->freeslots[s->nfree++] = j;
+        }
+
+        mc_mutex_create(&s->mutex);
+        mc_cond_create(&s->cond);
+
+        s->status = SHARD_RUNNING;
+        mc_thread_exec(&t, 1);
+    }
+
+    return pool;
+}
+
+void netpool_destroy(netpool_t *pool) {
+    netshard_event_t *e;
+    int i, j;
+
+    if (!pool) {
+        return;
+    }
+
+    atomic_store_int(&pool->quit, 1);
+
+    for (i = 0; i < pool->size; ++i) {
+        netshard_t *s = pool->shards + i;
+
+        mc_mutex_lock(&s->mutex);
+        while (SHARD_RUNNING == s->status) {
+            mc_cond_timedwait(&s->cond, &s->mutex, 10);
+        }
+        mc_mutex_unlock(&s->mutex);
+
+        channel_destroy(s->cmds);
+        mc_free(s->slots);
+        mc_free(s->gens);
+        mc_free(s->freeslots);
+        if (s->backlog) mc_free(s->backlog);
+        if (s->sending) mc_free(s->sending);
+        if (s->listeners) mc_free(s->listeners);
+
+        for (j = 0; j < (SLOT_MASK + 1) / NETSHARD_STATS; ++j) {
+            if (s->stats[j]) mc_free(s->stats[j]);
+        }
+        mc_free(s->stats);
+        mc_cond_destroy(&s->cond);
+        mc_mutex_destroy(&s->mutex);
+    }
+
+    while (0 == channel_read(pool->events, (void **)&e, 0)) {
+        netpool_free(e);
+    }
+    channel_destroy(pool->events);
+
+    mc_free(pool);
+}
+
+int netpool_size(netpool_t *pool) {
+    return pool->size;
+}
+
+static netcmd_t *cmd_new(int op, long long id, const void *data, int size) {
+    netcmd_t *cmd = (netcmd_t *)mc_calloc(1, sizeof(netcmd_t) + MC_MAX(size, 0));
+
+    cmd->op = op;
+    cmd->id = id;
+    cmd->size = size;
+
+    if (data && (size > 0)) {
+        memcpy(cmd->data, data, size);
+    }
+    return cmd;
+}
+
+/* Posts and waits for the shard to run it, returns cmd->result. */
+static long long cmd_call(netpool_t *pool, int shard, netcmd_t *cmd, netshard_peer_t *info) {
+    netshard_t *s = pool->shards + shard;
+    long long result;
+
+    while (0 != channel_write(s->cmds, cmd)) {
+        mc_sleep(1);
+    }
+
+    mc_mutex_lock(&s->mutex);
+    while (!atomic_load_int(&cmd->done)) {
+        mc_cond_wait(&s->cond, &s->mutex);
+    }
+    mc_mutex_unlock(&s->mutex);
+
+    if (info) {
+        *info = cmd->info;
+    }
+
+    result = cmd->result;
+    mc_free(cmd);
+
+    return result;
+}
+
+long long netpool_server(netpool_t *pool, int mode, const char *host, unsigned short port, int backlog, netshard_peer_t *info, int *shards) {
+    long long group = 0;
+    int i, listening = 0, size = (int)strlen(host) + 1;
+
+    for (i = 0; i < pool->size; ++i) {
+        netcmd_t *cmd = cmd_new(CMD_SERVER, group, host, size);
+        long long id;
+
+        cmd->mode = mode;
+        cmd->port = port;
+        cmd->backlog = backlog;
+
+        /* Shards after the first only bind where the port can be shared. */
+        id = cmd_call(pool, i, cmd, group ? NULL : info);
+
+        if (0 == i) {
+            if (0 == id) {
+                return 0;
+            }
+            group = id;
+        }
+
+        if (id) {
+            listening += 1;
+        }
+    }
+
+    /* Without a shared port every accept lands on the first shard */
+    if (listening < pool->size) {
+        LG_WRN("net server on port %d listens on %d of %d I/O threads", (int)port, listening, pool->size);
+    }
+
+    if (shards) {
+        *shards = listening;
+    }
+    return group;
+}
+
+long long netpool_connect(netpool_t *pool, int mode, const char *host, unsigned short port, netshard_peer_t *info) {
+    int shard = (atomic_add_int(&pool->next, 1) & 0x7FFFFFFF) % pool->size;
+    netcmd_t *cmd = cmd_new(CMD_CONNECT, 0, host, (int)strlen(host) + 1);
+
+    cmd->mode = mode;
+    cmd->port = port;
+
+    return cmd_call(pool, shard, cmd, info);
+}
+
+static int pool_timeout(netpool_t *pool, int op, int timeout) {
+    int i, old = 0;
+
+    for (i = 0; i < pool->size; ++i) {
+        netcmd_t *cmd = cmd_new(op, 0, NULL, 0);
+        long long result;
+
+        cmd->value = (unsigned long long)timeout;
+        result = cmd_call(pool, i, cmd, NULL);
+
+        if (0 == i) {
+            old = (int)result;
+        }
+    }
+    return old;
+}
+
+int netpool_conn_timeout(netpool_t *pool, int timeout) {
+    return pool_timeout(pool, CMD_CONN_TIMEOUT, timeout);
+}
+
+int netpool_auth_timeout(netpool_t *pool, int timeout) {
+    return pool_timeout(pool, CMD_AUTH_TIMEOUT, timeout);
+}
+
+int netpool_post(netpool_t *pool, long long id, int op, const void *data, int size, unsigned long long value) {
+    int shard = netshard_of(id);
+    netcmd_t *cmd;
+
+    if (shard >= pool->size) {
+        return -1;
+    }
+
+    cmd = cmd_new(op, id, data, size);
+    cmd->value = value;
+
+    /* Counted before the shard can take it, so it never goes negative. */
+    if (NETSHARD_SEND == op) {
+        pool_pending(pool, &id, 1, size);
+    }
+
+    if (0 != channel_write(pool->shards[shard].cmds, cmd)) {
+        if (NETSHARD_SEND == op) {
+            pool_pending(pool, &id, 1, -size);
+        }
+        mc_free(cmd);
+        return -1;
+    }
+    return 0;
+}
+
+int netpool_close_server(netpool_t *pool, long long id) {
+    int i, shard = netshard_of(id);
+    netcmd_t *cmd;
+
+    if (shard >= pool->size) {
+        return -1;
+    }
+
+    for (i = 0; i < pool->size; ++i) {
+        if (i != shard) {
+            cmd = cmd_new(CMD_CLOSE_GROUP, id, NULL, 0);
+
+            if (0 != channel_write(pool->shards[i].cmds, cmd)) {
+                mc_free(cmd);
+            }
+        }
+    }
+    return netpool_post(pool, id, NETSHARD_CLOSE, NULL, 0, 0);
+}
+
+int netpool_broadcast(netpool_t *pool, const long long *ids, int count, const void *data, int size) {
+    int counts[NETSHARD_MAX] = { 0 };
+    netcmd_t *cmds[NETSHARD_MAX] = { NULL };
+    netblob_t *blob;
+    int i, shard, queued = 0;
+
+    for (i = 0; i < count; ++i) {
+        shard = netshard_of(ids[i]);
+        if (shard < pool->size) {
+            counts[shard] += 1;
+        }
+    }
+
+    blob = (netblob_t *)mc_malloc(sizeof(netblob_t) + MC_MAX(size, 0));
+    blob->ref = 1;
+    blob->size = size;
+    memcpy(blob->data, data, size);
+
+    for (i = 0; i < pool->size; ++i) {
+        if (counts[i] > 0) {
+            cmds[i] = cmd_new(CMD_BROADCAST, 0, NULL, counts[i] * (int)sizeof(long long));
+            cmds[i]->blob = blob;
+            cmds[i]->size = 0;
+            atomic_add_int(&blob->ref, 1);
+        }
+    }
+
+    for (i = 0; i < count; ++i) {
+        shard = netshard_of(ids[i]);
+        if (shard < pool->size) {
+            netcmd_t *cmd = cmds[shard];
+            memcpy(cmd->data + cmd->size, &ids[i], sizeof(long long));
+            cmd->size += (int)sizeof(long long);
+        }
+    }
+
+    for (i = 0; i < pool->size; ++i) {
+        if (cmds[i]) {
+            pool_pending(pool, (long long *)cmds[i]->data, counts[i], size);
+
+            if (0 == channel_write(pool->shards[i].cmds, cmds[i])) {
+                queued += counts[i];
+            } else {
+                pool_pending(pool, (long long *)cmds[i]->data, counts[i], -size);
+                cmd_done(pool->shards + i, cmds[i]);
+            }
+        }
+    }
+
+    blob_release(blob);
+    return queued;
+}
+
+int netpool_queued(netpool_t *pool, long long id) {
+    netstat_t *st = pool_stat(pool, id);
+
+    if (!st) {
+        return 0;
+    }
+    return atomic_load_int(&st->pending) + atomic_load_int(&st->outq);
+}
+
+int netshard_outq(int fd) {
+    int q = 0;
+
+    if (fd < 0) {
+        return 0;
+    }
+
+#if defined(__linux__)
+    if (0 != ioctl(fd, TIOCOUTQ, &q)) {
+        q = 0;
+    }
+#elif defined(__APPLE__)
+    {
+        socklen_t len = sizeof(q);
+
+        if (0 != getsockopt(fd, SOL_SOCKET, SO_NWRITE, &q, &len)) {
+            q = 0;
+        }
+    }
+#endif
+
+    return q;
+}
+
+int netshard_sndbuf(int fd) {
+    int size = 0;
+
+#if defined(__linux__) || defined(__APPLE__)
+    socklen_t len = sizeof(size);
+
+    if ((fd < 0) || (0 != getsockopt(fd, SOL_SOCKET, SO_SNDBUF, &size, &len))) {
+        size = 0;
+    }
+#else
+    MC_UNUSED(fd);
+#endif
+
+    return size;
+}
+
+int netpool_recv(netpool_t *pool, netshard_event_t **events, int max, unsigned int timeout) {
+    return channel_read_many(pool->events, (void **)events, max, timeout);
+}
+
+int netpool_wait(netpool_t *pool, unsigned int timeout) {
+    return channel_wait(pool->events, timeout);
+}
+
+void netpool_link(netpool_t *pool, channel_t *ch) {
+    channel_link(pool->events, ch);
+}
+
+void netpool_free(netshard_event_t *e) {
+    if (e) {
+        if (e->evt) {
+            mc_free(e->evt);
+        }
+        mc_free(e);
+    }
+}
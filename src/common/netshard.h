@@ -0,0 +1,120 @@
+/*
+ *  netshard.h
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#ifndef __NETSHARD_H__
+#define __NETSHARD_H__
+
+#include "typedef.h"
+#include "channel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /*
+     * Pool of I/O threads, each driving its own mc_net_t. Peers live on
+     * the thread that created them and are named by ids; the owner talks
+     * to them through per-shard command queues and gets their events
+     * from one shared queue.
+     */
+    typedef struct netpool_t netpool_t;
+
+    #define NETSHARD_MAX    64
+
+    /* Peer ids: generation << 32 | shard << 24 | slot */
+    #define netshard_of(id) ((int)(((id) >> 24) & 0xFF))
+
+    enum {
+        NETSHARD_CLOSE = 1,
+        NETSHARD_AUTH,
+        NETSHARD_ACCEPT,
+        NETSHARD_REJECT,
+        NETSHARD_PING,
+        NETSHARD_PONG,
+        NETSHARD_SEND,
+    };
+
+    enum {
+        NETSHARD_CONNECTING = 1,
+        NETSHARD_CONNECTED,
+        NETSHARD_CLOSING,
+        NETSHARD_CLOSED,
+    };
+
+    /* Peer state captured on its I/O thread with every event. */
+    typedef struct netshard_peer_t {
+        long long       id;
+        long long       parent;     /* listener of a new connection */
+        int             fd;
+        int             type;
+        int             status;
+        int             listener;   /* one of a server's per-shard sockets */
+        unsigned char   hwaddr[MC_HWADDR_LEN];
+    } netshard_peer_t;
+
+    /* evt is NULL when the peer was deleted. */
+    typedef struct netshard_event_t {
+        mc_net_event_t  *evt;
+        netshard_peer_t peer;
+    } netshard_event_t;
+
+    netpool_t *netpool_create(int threads);
+    void netpool_destroy(netpool_t *pool);
+    int netpool_size(netpool_t *pool);
+
+    /*
+     * Every shard listens on the address, the returned id names the
+     * group and shards gets the count that could bind. Connections go
+     * to shards in turn. Both wait for the I/O threads and return 0 on
+     * failure.
+     */
+    long long netpool_server(netpool_t *pool, int mode, const char *host, unsigned short port, int backlog, netshard_peer_t *info, int *shards);
+    long long netpool_connect(netpool_t *pool, int mode, const char *host, unsigned short port, netshard_peer_t *info);
+
+    /* Applies to every shard, returns the previous value of the first. */
+    int netpool_conn_timeout(netpool_t *pool, int timeout);
+    int netpool_auth_timeout(netpool_t *pool, int timeout);
+
+    /* Queues a command for the shard owning the peer, 0 when queued. */
+    int netpool_post(netpool_t *pool, long long id, int op, const void *data, int size, unsigned long long value);
+
+    /* Closes a server by its group id, on every shard that listens. */
+    int netpool_close_server(netpool_t *pool, long long id);
+
+    /*
+     * Sends one payload to many peers, copied once and shared by the
+     * shards. Returns the count of peers it was queued for.
+     */
+    int netpool_broadcast(netpool_t *pool, const long long *ids, int count, const void *data, int size);
+
+    /*
+     * Bytes still to leave the peer: sends posted but not yet taken by
+     * its shard, plus the kernel queue as the shard last saw it.
+     */
+    int netpool_queued(netpool_t *pool, long long id);
+
+    /* Bytes the kernel still holds for the socket, 0 where unknown. */
+    int netshard_outq(int fd);
+
+    /* The socket's send buffer size, 0 where unknown. */
+    int netshard_sndbuf(int fd);
+
+    /* Takes up to max events, waiting up to timeout ms for the first. */
+    int netpool_recv(netpool_t *pool, netshard_event_t **events, int max, unsigned int timeout);
+    int netpool_wait(netpool_t *pool, unsigned int timeout);
+
+    /* Events also wake channel_wait on ch, which must outlive the pool. */
+    void netpool_link(netpool_t *pool, channel_t *ch);
+    void netpool_free(netshard_event_t *e);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif  /* __NETSHARD_H__ */
@@ -0,0 +1,192 @@
+/*
+ *  ring.c
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#include "ring.h"
+
+/* Positions wrap as unsigned, only differences are meaningful. */
+typedef struct ring_cell_t {
+    volatile int seq;
+    void *data;
+} ring_cell_t;
+
+struct ring_t {
+    int multi;
+    unsigned int mask;
+    void **items;           /* spsc slots */
+    ring_cell_t *cells;     /* mpsc slots with sequence */
+
+    char pad0[CACHELINE_SIZE];
+
+    /* producer line */
+    volatile int tail;
+    unsigned int head_cache;
+
+    char pad1[CACHELINE_SIZE];
+
+    /* consumer line */
+    volatile int head;
+    unsigned int tail_cache;
+
+    char pad2[CACHELINE_SIZE];
+};
+
+ring_t *ring_create(int capacity, int multi_producer) {
+    ring_t *r = (ring_t *)mc_calloc(1, sizeof(ring_t));
+    unsigned int size = 2, i;
+
+    while (size < (unsigned int)MC_MAX(capacity, 2) && size < (1u << 30)) {
+        size <<= 1;
+    }
+
+    r->multi = multi_producer;
+    r->mask = size - 1;
+
+    if (multi_producer) {
+        r->cells = (ring_cell_t *)mc_malloc(size * sizeof(ring_cell_t));
+
+        for (i = 0; i < size; ++i) {
+            r->cells[i].seq = (int)i;
+            r->cells[i].data = NULL;
+        }
+    } else {
+        r->items = (void **)mc_malloc(size * sizeof(void *));
+    }
+
+    return r;
+}
+
+void ring_destroy(ring_t *r) {
+    if (r) {
+        if (r->cells) mc_free(r->cells);
+        if (r->items) mc_free(r->items);
+        mc_free(r);
+    }
+}
+
+static int spsc_push(ring_t *r, void **p, int n) {
+    unsigned int tail = (unsigned int)r->tail;
+    unsigned int cap = r->mask + 1;
+    unsigned int room = cap - (tail - r->head_cache);
+    int i;
+
+    if (room < (unsigned int)n) {
+        r->head_cache = (unsigned int)atomic_load_acquire(&r->head);
+        room = cap - (tail - r->head_cache);
+    }
+
+    n = (int)MC_MIN((unsigned int)n, room);
+
+    for (i = 0; i < n; ++i) {
+        r->items[(tail + i) & r->mask] = p[i];
+    }
+
+    if (n > 0) {
+        atomic_store_release(&r->tail, (int)(tail + n));
+    }
+    return n;
+}
+
+static int spsc_pop(ring_t *r, void **p, int max) {
+    unsigned int head = (unsigned int)r->head;
+    unsigned int avail = r->tail_cache - head;
+    int i;
+
+    if (avail < (unsigned int)max) {
+        r->tail_cache = (unsigned int)atomic_load_acquire(&r->tail);
+        avail = r->tail_cache - head;
+    }
+
+    max = (int)MC_MIN((unsigned int)max, avail);
+
+    for (i = 0; i < max; ++i) {
+        p[i] = r->items[(head + i) & r->mask];
+    }
+
+    if (max > 0) {
+        atomic_store_release(&r->head, (int)(head + max));
+    }
+    return max;
+}
+
+/* Bounded queue after Dmitry Vyukov, producers claim a cell by CAS. */
+static int mpsc_push_one(ring_t *r, void *p) {
+    unsigned int pos = (unsigned int)atomic_load_int(&r->tail);
+
+    for (;;) {
+        ring_cell_t *cell = &r->cells[pos & r->mask];
+        int diff = (int)((unsigned int)atomic_load_acquire(&cell->seq) - pos);
+
+        if (0 == diff) {
+            if (atomic_cas_int(&r->tail, (int)pos, (int)(pos + 1))) {
+                cell->data = p;
+                atomic_store_release(&cell->seq, (int)(pos + 1));
+                return 0;
+            }
+            pos = (unsigned int)atomic_load_int(&r->tail);
+        } else if (diff < 0) {
+            return -1;  /* full */
+        } else {
+            pos = (unsigned int)atomic_load_int(&r->tail);
+        }
+    }
+}
+
+static int mpsc_pop(ring_t *r, void **p, int max) {
+    unsigned int head = (unsigned int)r->head;
+    int n = 0;
+
+    while (n < max) {
+        ring_cell_t *cell = &r->cells[head & r->mask];
+
+        if ((unsigned int)atomic_load_acquire(&cell->seq) != head + 1) {
+            break;
+        }
+
+        p[n++] = cell->data;
+        atomic_store_release(&cell->seq, (int)(head + r->mask + 1));
+        head += 1;
+    }
+
+    if (n > 0) {
+        atomic_store_release(&r->head, (int)head);
+    }
+    return n;
+}
+
+int ring_push_many(ring_t *r, void **p, int n) {
+    int i;
+
+    if (!r->multi) {
+        return spsc_push(r, p, n);
+    }
+
+    for (i = 0; i < n; ++i) {
+        if (0 != mpsc_push_one(r, p[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+int ring_pop_many(ring_t *r, void **p, int max) {
+    return r->multi ? mpsc_pop(r, p, max) : spsc_pop(r, p, max);
+}
+
+int ring_size(ring_t *r) {
+    unsigned int head = (unsigned int)atomic_load_acquire(&r->head);
+    unsigned int tail = (unsigned int)atomic_load_acquire(&r->tail);
+    unsigned int size = tail - head;
+
+    /* tail claimed in mpsc may run one lap ahead of a stale head */
+    return (int)MC_MIN(size, r->mask + 1);
+}
+
+int ring_capacity(ring_t *r) {
+    return (int)(r->mask + 1);
+}
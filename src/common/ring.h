@@ -0,0 +1,42 @@
+/*
+ *  ring.h
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#ifndef __RING_H__
+#define __RING_H__
+
+#include "atomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /*
+     * Bounded lock-free pointer ring, capacity is rounded up to a power
+     * of two. Single consumer, with either one producer (spsc) or many
+     * (mpsc). Never blocks, callers decide how to wait.
+     */
+    typedef struct ring_t ring_t;
+
+    ring_t *ring_create(int capacity, int multi_producer);
+    void ring_destroy(ring_t *r);
+
+    /* Producer side, returns the count pushed. */
+    int ring_push_many(ring_t *r, void **p, int n);
+
+    /* Consumer side, returns the count popped. */
+    int ring_pop_many(ring_t *r, void **p, int max);
+
+    int ring_size(ring_t *r);
+    int ring_capacity(ring_t *r);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif  /* __RING_H__ */
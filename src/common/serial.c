@@ -0,0 +1,394 @@
+/*
+ *  serial.c
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#include "serial.h"
+#include "atomic.h"
+#include <string.h>
+
+#define TAG_NIL         0
+#define TAG_FALSE       1
+#define TAG_TRUE        2
+#define TAG_INTEGER     3
+#define TAG_NUMBER      4
+#define TAG_STRING      5
+#define TAG_TABLE       6
+#define TAG_END         7
+#define TAG_BLOB        8
+
+#define MAX_DEPTH       32
+
+#define BUF_INITSIZE    256
+#define POOL_MAXSIZE    (64 * 1024)
+#define POOL_MAXNUM     1024
+
+typedef struct reader_t {
+    const char  *ptr;
+    const char  *end;
+} reader_t;
+
+static serial_buf_t *g_pool = NULL;
+static int g_pool_num = 0;
+static int g_pool_lock = 0;
+
+static serial_buf_t *buf_alloc(void) {
+    serial_buf_t *buf;
+
+    mc_spin_lock(&g_pool_lock);
+
+    buf = g_pool;
+    if (buf) {
+        g_pool = buf->next;
+        g_pool_num -= 1;
+    }
+
+    mc_spin_unlock(&g_pool_lock);
+
+    if (!buf) {
+        buf = (serial_buf_t *)mc_malloc(sizeof(serial_buf_t) + BUF_INITSIZE);
+        buf->capacity = BUF_INITSIZE;
+    }
+
+    buf->next = NULL;
+    buf->size = 0;
+    buf->blobs = 0;
+
+    return buf;
+}
+
+static int buf_put(serial_buf_t **pbuf, const void *p, int n) {
+    serial_buf_t *buf = *pbuf;
+
+    if (buf->size + n > buf->capacity) {
+        int capacity = buf->capacity * 2;
+
+        while (buf->size + n > capacity) {
+            capacity *= 2;
+        }
+
+        buf = (serial_buf_t *)mc_realloc(buf, sizeof(serial_buf_t) + capacity);
+
+        if (!buf) {
+            return -1;
+        }
+
+        buf->capacity = capacity;
+        *pbuf = buf;
+    }
+
+    memcpy(buf->data + buf->size, p, n);
+    buf->size += n;
+
+    return 0;
+}
+
+static int buf_tag(serial_buf_t **pbuf, unsigned char tag) {
+    return buf_put(pbuf, &tag, 1);
+}
+
+static int read_bytes(reader_t *r, void *p, int n) {
+    if (r->end - r->ptr < n) {
+        return -1;
+    }
+    memcpy(p, r->ptr, n);
+    r->ptr += n;
+    return 0;
+}
+
+/* Release the blob references held by a buffer that was never decoded. */
+static void buf_release(serial_buf_t *buf) {
+    reader_t r = { buf->data, buf->data + buf->size };
+    unsigned char tag;
+
+    while (buf->blobs > 0 && 0 == read_bytes(&r, &tag, 1)) {
+        switch (tag) {
+        case TAG_INTEGER:
+            r.ptr += sizeof(lua_Integer);
+            break;
+        case TAG_NUMBER:
+            r.ptr += sizeof(lua_Number);
+            break;
+        case TAG_STRING: {
+            unsigned int len = 0;
+            read_bytes(&r, &len, sizeof(len));
+            r.ptr += len;
+            break;
+        }
+        case TAG_BLOB: {
+            serial_blob_t *blob = NULL;
+            if (0 == read_bytes(&r, &blob, sizeof(blob))) {
+                serial_blob_unref(blob);
+                buf->blobs -= 1;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+void serial_free(serial_buf_t *buf) {
+    if (!buf) {
+        return;
+    }
+
+    if (buf->blobs > 0) {
+        buf_release(buf);
+    }
+
+    if (buf->capacity <= POOL_MAXSIZE) {
+        mc_spin_lock(&g_pool_lock);
+
+        if (g_pool_num < POOL_MAXNUM) {
+            buf->next = g_pool;
+            g_pool = buf;
+            g_pool_num += 1;
+            buf = NULL;
+        }
+
+        mc_spin_unlock(&g_pool_lock);
+    }
+
+    if (buf) {
+        mc_free(buf);
+    }
+}
+
+void serial_deinit(void) {
+    mc_spin_lock(&g_pool_lock);
+
+    while (g_pool) {
+        serial_buf_t *buf = g_pool;
+        g_pool = buf->next;
+        mc_free(buf);
+    }
+    g_pool_num = 0;
+
+    mc_spin_unlock(&g_pool_lock);
+}
+
+static int pack_value(lua_State *L, int index, serial_buf_t **pbuf, int depth, const char **err) {
+    switch (lua_type(L, index)) {
+    case LUA_TNIL:
+        return buf_tag(pbuf, TAG_NIL);
+    case LUA_TBOOLEAN:
+        return buf_tag(pbuf, lua_toboolean(L, index) ? TAG_TRUE : TAG_FALSE);
+    case LUA_TNUMBER:
+        if (lua_isinteger(L, index)) {
+            lua_Integer i = lua_tointeger(L, index);
+            buf_tag(pbuf, TAG_INTEGER);
+            return buf_put(pbuf, &i, sizeof(i));
+        } else {
+            lua_Number n = lua_tonumber(L, index);
+            buf_tag(pbuf, TAG_NUMBER);
+            return buf_put(pbuf, &n, sizeof(n));
+        }
+    case LUA_TSTRING: {
+        size_t l = 0;
+        const char *s = lua_tolstring(L, index, &l);
+        unsigned int len = (unsigned int)l;
+
+        buf_tag(pbuf, TAG_STRING);
+        buf_put(pbuf, &len, sizeof(len));
+        return buf_put(pbuf, s, (int)len);
+    }
+    case LUA_TTABLE:
+        if (depth >= MAX_DEPTH) {
+            *err = "table nesting too deep";
+            return -1;
+        }
+
+        if (!lua_checkstack(L, 3)) {
+            *err = "stack overflow";
+            return -1;
+        }
+
+        index = lua_absindex(L, index);
+        buf_tag(pbuf, TAG_TABLE);
+
+        lua_pushnil(L);
+        while (lua_next(L, index)) {
+            if ((0 != pack_value(L, -2, pbuf, depth + 1, err))
+                || (0 != pack_value(L, -1, pbuf, depth + 1, err))) {
+                lua_pop(L, 2);
+                return -1;
+            }
+            lua_pop(L, 1);
+        }
+        return buf_tag(pbuf, TAG_END);
+    case LUA_TUSERDATA: {
+        serial_blob_t *blob = serial_toblob(L, index);
+
+        if (blob) {
+            serial_blob_ref(blob);
+            (*pbuf)->blobs += 1;
+
+            buf_tag(pbuf, TAG_BLOB);
+            return buf_put(pbuf, &blob, sizeof(blob));
+        }
+    }
+    /* fall through */
+    default:
+        *err = lua_typename(L, lua_type(L, index));
+        return -1;
+    }
+}
+
+serial_buf_t *serial_pack(lua_State *L, int from, int to, const char **err) {
+    serial_buf_t *buf = buf_alloc();
+    int i;
+
+    *err = NULL;
+
+    for (i = from; i <= to; ++i) {
+        if (0 != pack_value(L, i, &buf, 0, err)) {
+            if (!*err) {
+                *err = "out of memory";
+            }
+            serial_free(buf);
+            return NULL;
+        }
+    }
+
+    return buf;
+}
+
+/* Push one value, returns its tag or -1 if malformed. */
+static int unpack_value(lua_State *L, reader_t *r, int depth) {
+    unsigned char tag;
+
+    if (0 != read_bytes(r, &tag, 1)) {
+        return -1;
+    }
+
+    switch (tag) {
+    case TAG_NIL:
+        lua_pushnil(L);
+        break;
+    case TAG_FALSE:
+    case TAG_TRUE:
+        lua_pushboolean(L, TAG_TRUE == tag);
+        break;
+    case TAG_INTEGER: {
+        lua_Integer i;
+        if (0 != read_bytes(r, &i, sizeof(i))) {
+            return -1;
+        }
+        lua_pushinteger(L, i);
+        break;
+    }
+    case TAG_NUMBER: {
+        lua_Number n;
+        if (0 != read_bytes(r, &n, sizeof(n))) {
+            return -1;
+        }
+        lua_pushnumber(L, n);
+        break;
+    }
+    case TAG_STRING: {
+        unsigned int len;
+        if ((0 != read_bytes(r, &len, sizeof(len))) || ((unsigned int)(r->end - r->ptr) < len)) {
+            return -1;
+        }
+        lua_pushlstring(L, r->ptr, len);
+        r->ptr += len;
+        break;
+    }
+    case TAG_TABLE:
+        if ((depth >= MAX_DEPTH) || !lua_checkstack(L, 3)) {
+            return -1;
+        }
+
+        lua_newtable(L);
+
+        for (;;) {
+            int t = unpack_value(L, r, depth + 1);
+
+            if (TAG_END == t) {
+                break;
+            }
+            if ((t < 0) || (unpack_value(L, r, depth + 1) < 0)) {
+                return -1;
+            }
+            if (lua_isnil(L, -2)) {
+                return -1;
+            }
+            lua_rawset(L, -3);
+        }
+        break;
+    case TAG_END:
+        if (0 == depth) {
+            return -1;
+        }
+        break;
+    case TAG_BLOB: {
+        serial_blob_t *blob;
+        if (0 != read_bytes(r, &blob, sizeof(blob))) {
+            return -1;
+        }
+        serial_push_blob(L, blob);
+        break;
+    }
+    default:
+        return -1;
+    }
+
+    return tag;
+}
+
+int serial_unpack(lua_State *L, const serial_buf_t *buf) {
+    reader_t r = { buf->data, buf->data + buf->size };
+    int top = lua_gettop(L);
+    int count = 0;
+
+    while (r.ptr < r.end) {
+        if (!lua_checkstack(L, 1) || (unpack_value(L, &r, 0) < 0)) {
+            lua_settop(L, top);
+            return -1;
+        }
+        count += 1;
+    }
+
+    return count;
+}
+
+serial_blob_t *serial_blob_new(const void *data, int size) {
+    serial_blob_t *blob = (serial_blob_t *)mc_malloc(sizeof(serial_blob_t) + size);
+
+    blob->ref = 1;
+    blob->size = size;
+    memcpy(blob->data, data, size);
+    blob->data[size] = 0;
+
+    return blob;
+}
+
+void serial_blob_ref(serial_blob_t *blob) {
+    atomic_add_int(&blob->ref, 1);
+}
+
+void serial_blob_unref(serial_blob_t *blob) {
+    if (1 == atomic_add_int(&blob->ref, -1)) {
+        mc_free(blob);
+    }
+}
+
+void serial_push_blob(lua_State *L, serial_blob_t *blob) {
+    serial_blob_t **ud = (serial_blob_t **)lua_newuserdata(L, sizeof(serial_blob_t *));
+
+    *ud = blob;
+    serial_blob_ref(blob);
+
+    luaL_setmetatable(L, SERIAL_META_BLOB);
+}
+
+serial_blob_t *serial_toblob(lua_State *L, int index) {
+    serial_blob_t **ud = (serial_blob_t **)luaL_testudata(L, index, SERIAL_META_BLOB);
+    return ud ? *ud : NULL;
+}
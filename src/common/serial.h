@@ -0,0 +1,67 @@
+/*
+ *  serial.h
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#ifndef __SERIAL_H__
+#define __SERIAL_H__
+
+#include "typedef.h"
+#include "version.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /*
+     * Binary encoding of Lua values so they can cross between states.
+     * Supports nil, boolean, integer, number, string, nested tables and
+     * shared blobs. Buffers come from a process-wide pool and are handed
+     * over by pointer, the receiver decodes then releases them.
+     */
+
+    #define SERIAL_META_BLOB    CODE_NAME ".meta.blob"
+
+    typedef struct serial_buf_t {
+        struct serial_buf_t *next;
+        int         size;
+        int         capacity;
+        int         blobs;
+        char        data[1];
+    } serial_buf_t;
+
+    /* Immutable, reference counted bytes shared across states. */
+    typedef struct serial_blob_t {
+        volatile int    ref;
+        int             size;
+        char            data[1];
+    } serial_blob_t;
+
+    void serial_deinit(void);
+
+    /* Encode the values in [from, to], returns NULL and sets err on failure. */
+    serial_buf_t *serial_pack(lua_State *L, int from, int to, const char **err);
+
+    /* Push the decoded values, returns their count or -1 if malformed. */
+    int serial_unpack(lua_State *L, const serial_buf_t *buf);
+
+    /* Give the buffer back to the pool. */
+    void serial_free(serial_buf_t *buf);
+
+    serial_blob_t *serial_blob_new(const void *data, int size);
+    void serial_blob_ref(serial_blob_t *blob);
+    void serial_blob_unref(serial_blob_t *blob);
+
+    /* Wrap as a SERIAL_META_BLOB userdata, takes a reference. */
+    void serial_push_blob(lua_State *L, serial_blob_t *blob);
+    serial_blob_t *serial_toblob(lua_State *L, int index);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif  /* __SERIAL_H__ */
@@ -0,0 +1,334 @@
+/*
+ *  timewheel.c
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#include "timewheel.h"
+
+#define NEAR_SHIFT      8
+#define NEAR            (1 << NEAR_SHIFT)
+#define NEAR_MASK       (NEAR - 1)
+#define LEVEL_SHIFT     6
+#define LEVEL           (1 << LEVEL_SHIFT)
+#define LEVEL_MASK      (LEVEL - 1)
+#define LEVELS          4
+
+#define SLOT_FREE       -1
+#define SLOT_EXPIRED    (NEAR + LEVELS * LEVEL)
+#define SLOT_NUM        (SLOT_EXPIRED + 1)
+
+#define NODE_NIL        -1
+#define NODE_INITNUM    64
+
+#define id_index(id)        ((int)((id) & 0xFFFFFFFF))
+#define id_gen(id)          ((unsigned int)((id) >> 32))
+#define id_make(gen, idx)   (((long long)(gen) << 32) | (long long)(idx))
+
+typedef struct tnode_t {
+    unsigned int    expire;
+    unsigned int    interval;
+    unsigned int    gen;
+    int             slot;
+    int             prev;
+    int             next;
+} tnode_t;
+
+struct timewheel_t {
+    unsigned int    time;
+    int             size;
+    int             capacity;
+    int             freelist;
+    tnode_t         *nodes;
+    int             head[SLOT_NUM];
+    int             tail[SLOT_NUM];
+};
+
+static void list_append(timewheel_t *tw, int slot, int idx) {
+    tnode_t *n = tw->nodes + idx;
+
+    n->slot = slot;
+    n->next = NODE_NIL;
+    n->prev = tw->tail[slot];
+
+    if (NODE_NIL != n->prev) {
+        tw->nodes[n->prev].next = idx;
+    } else {
+        tw->head[slot] = idx;
+    }
+    tw->tail[slot] = idx;
+}
+
+static void list_remove(timewheel_t *tw, int idx) {
+    tnode_t *n = tw->nodes + idx;
+
+    if (NODE_NIL != n->prev) {
+        tw->nodes[n->prev].next = n->next;
+    } else {
+        tw->head[n->slot] = n->next;
+    }
+
+    if (NODE_NIL != n->next) {
+        tw->nodes[n->next].prev = n->prev;
+    } else {
+        tw->tail[n->slot] = n->prev;
+    }
+
+    n->prev = n->next = NODE_NIL;
+}
+
+/* Detach a whole slot, the returned chain is still linked by next. */
+static int list_take(timewheel_t *tw, int slot) {
+    int idx = tw->head[slot];
+    tw->head[slot] = tw->tail[slot] = NODE_NIL;
+    return idx;
+}
+
+static int node_alloc(timewheel_t *tw) {
+    tnode_t *n;
+    int idx;
+
+    if (NODE_NIL == tw->freelist) {
+        int i, capacity = tw->capacity * 2;
+        tnode_t *nodes = (tnode_t *)mc_realloc(tw->nodes, capacity * sizeof(tnode_t));
+
+        if (!nodes) {
+            return NODE_NIL;
+        }
+
+        for (i = tw->capacity; i < capacity; ++i) {
+            nodes[i].gen = 1;
+            nodes[i].slot = SLOT_FREE;
+            nodes[i].next = (i + 1 < capacity) ? (i + 1) : NODE_NIL;
+        }
+
+        tw->freelist = tw->capacity;
+        tw->capacity = capacity;
+        tw->nodes = nodes;
+    }
+
+    idx = tw->freelist;
+    n = tw->nodes + idx;
+    tw->freelist = n->next;
+
+    n->prev = n->next = NODE_NIL;
+    tw->size += 1;
+
+    return idx;
+}
+
+static void node_free(timewheel_t *tw, int idx) {
+    tnode_t *n = tw->nodes + idx;
+
+    /* Bump generation so stale ids can't hit the recycled node. */
+    n->gen = (n->gen + 1) & 0x7FFFFFFF;
+    if (0 == n->gen) {
+        n->gen = 1;
+    }
+
+    n->slot = SLOT_FREE;
+    n->next = tw->freelist;
+    tw->freelist = idx;
+    tw->size -= 1;
+}
+
+static void node_place(timewheel_t *tw, int idx) {
+    unsigned int expire = tw->nodes[idx].expire;
+    unsigned int current = tw->time;
+    int slot;
+
+    if ((expire | NEAR_MASK) == (current | NEAR_MASK)) {
+        slot = expire & NEAR_MASK;
+    } else {
+        unsigned int mask = NEAR << LEVEL_SHIFT;
+        int i;
+
+        for (i = 0; i < LEVELS - 1; ++i) {
+            if ((expire | (mask - 1)) == (current | (mask - 1))) {
+                break;
+            }
+            mask <<= LEVEL_SHIFT;
+        }
+        slot = NEAR + i * LEVEL + ((expire >> (NEAR_SHIFT + i * LEVEL_SHIFT)) & LEVEL_MASK);
+    }
+
+    list_append(tw, slot, idx);
+}
+
+static void wheel_cascade(timewheel_t *tw, int slot) {
+    int idx = list_take(tw, slot);
+
+    while (NODE_NIL != idx) {
+        int next = tw->nodes[idx].next;
+        node_place(tw, idx);
+        idx = next;
+    }
+}
+
+static void wheel_shift(timewheel_t *tw) {
+    unsigned int ct = ++tw->time;
+
+    if (0 == ct) {
+        wheel_cascade(tw, NEAR + (LEVELS - 1) * LEVEL);
+    } else {
+        unsigned int mask = NEAR;
+        unsigned int time = ct >> NEAR_SHIFT;
+        int i = 0;
+
+        while ((i < LEVELS) && (0 == (ct & (mask - 1)))) {
+            int idx = time & LEVEL_MASK;
+
+            if (0 != idx) {
+                wheel_cascade(tw, NEAR + i * LEVEL + idx);
+                break;
+            }
+
+            mask <<= LEVEL_SHIFT;
+            time >>= LEVEL_SHIFT;
+            i += 1;
+        }
+    }
+}
+
+static void wheel_execute(timewheel_t *tw) {
+    int idx = list_take(tw, tw->time & NEAR_MASK);
+
+    while (NODE_NIL != idx) {
+        int next = tw->nodes[idx].next;
+        list_append(tw, SLOT_EXPIRED, idx);
+        idx = next;
+    }
+}
+
+timewheel_t *timewheel_create(void) {
+    timewheel_t *tw = (timewheel_t *)mc_malloc(sizeof(timewheel_t));
+    int i;
+
+    tw->time = 0;
+    tw->size = 0;
+    tw->capacity = NODE_INITNUM;
+    tw->nodes = (tnode_t *)mc_malloc(tw->capacity * sizeof(tnode_t));
+
+    for (i = 0; i < tw->capacity; ++i) {
+        tw->nodes[i].gen = 1;
+        tw->nodes[i].slot = SLOT_FREE;
+        tw->nodes[i].next = (i + 1 < tw->capacity) ? (i + 1) : NODE_NIL;
+    }
+    tw->freelist = 0;
+
+    for (i = 0; i < SLOT_NUM; ++i) {
+        tw->head[i] = tw->tail[i] = NODE_NIL;
+    }
+
+    return tw;
+}
+
+void timewheel_destroy(timewheel_t *tw) {
+    if (tw) {
+        mc_free(tw->nodes);
+        mc_free(tw);
+    }
+}
+
+long long timewheel_add(timewheel_t *tw, unsigned int delay, unsigned int interval) {
+    int idx = node_alloc(tw);
+    tnode_t *n;
+
+    if (NODE_NIL == idx) {
+        return 0;
+    }
+
+    n = tw->nodes + idx;
+    n->expire = tw->time + delay;
+    n->interval = interval;
+
+    node_place(tw, idx);
+
+    return id_make(n->gen, idx);
+}
+
+int timewheel_cancel(timewheel_t *tw, long long id) {
+    int idx = id_index(id);
+    tnode_t *n;
+
+    if ((id <= 0) || (idx >= tw->capacity)) {
+        return -1;
+    }
+
+    n = tw->nodes + idx;
+
+    if ((SLOT_FREE == n->slot) || (n->gen != id_gen(id))) {
+        return -1;
+    }
+
+    list_remove(tw, idx);
+    node_free(tw, idx);
+
+    return 0;
+}
+
+void timewheel_update(timewheel_t *tw, unsigned int elapsed) {
+    /* Timers added with zero delay are due in the current slot. */
+    wheel_execute(tw);
+
+    while (elapsed-- > 0) {
+        wheel_shift(tw);
+        wheel_execute(tw);
+    }
+}
+
+long long timewheel_expired(timewheel_t *tw, int *repeat) {
+    int idx = tw->head[SLOT_EXPIRED];
+    tnode_t *n;
+    long long id;
+
+    if (NODE_NIL == idx) {
+        return 0;
+    }
+
+    n = tw->nodes + idx;
+    id = id_make(n->gen, idx);
+
+    list_remove(tw, idx);
+
+    if (repeat) {
+        *repeat = (n->interval > 0);
+    }
+
+    if (n->interval > 0) {
+        n->expire = tw->time + n->interval;
+        node_place(tw, idx);
+    } else {
+        node_free(tw, idx);
+    }
+
+    return id;
+}
+
+int timewheel_next(timewheel_t *tw) {
+    int i, current = tw->time & NEAR_MASK;
+
+    if (0 == tw->size) {
+        return -1;
+    }
+
+    if (NODE_NIL != tw->head[SLOT_EXPIRED]) {
+        return 0;
+    }
+
+    for (i = current; i < NEAR; ++i) {
+        if (NODE_NIL != tw->head[i]) {
+            return i - current;
+        }
+    }
+
+    /* Only far timers left, wake for the next cascade. */
+    return NEAR - current;
+}
+
+int timewheel_size(timewheel_t *tw) {
+    return tw->size;
+}
@@ -0,0 +1,44 @@
+/*
+ *  timewheel.h
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#ifndef __TIMEWHEEL_H__
+#define __TIMEWHEEL_H__
+
+#include "typedef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /* Hierarchical timing wheel, one tick per millisecond. */
+    typedef struct timewheel_t timewheel_t;
+
+    timewheel_t *timewheel_create(void);
+    void timewheel_destroy(timewheel_t *tw);
+
+    /* Returns a timer id (> 0), or 0 when out of memory. */
+    long long timewheel_add(timewheel_t *tw, unsigned int delay, unsigned int interval);
+    int timewheel_cancel(timewheel_t *tw, long long id);
+
+    /* Advance the wheel, due timers are queued for timewheel_expired. */
+    void timewheel_update(timewheel_t *tw, unsigned int elapsed);
+
+    /* Pop the next due timer, 0 if none. Intervals are re-armed. */
+    long long timewheel_expired(timewheel_t *tw, int *repeat);
+
+    /* Ticks until the wheel next needs an update, -1 if empty. Never late. */
+    int timewheel_next(timewheel_t *tw);
+
+    int timewheel_size(timewheel_t *tw);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif  /* __TIMEWHEEL_H__ */
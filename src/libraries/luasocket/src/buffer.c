@@ -2,6 +2,9 @@
 * Input/Output interface for Lua programs
 * LuaSocket toolkit
 \*=========================================================================*/
+#include <stdlib.h>
+#include <string.h>
+
 #include "lua.h"
 #include "lauxlib.h"
 #include "compat.h"
@@ -17,6 +20,19 @@ static int recvall(p_buffer buf, luaL_Buffer *b);
 static int buffer_get(p_buffer buf, const char **data, size_t *count);
 static void buffer_skip(p_buffer buf, size_t count);
 static int sendraw(p_buffer buf, const char *data, size_t count, size_t *sent);
+static int frame_cut(p_frame f, const char *data, size_t count, size_t from,
+        size_t *start, size_t *len, size_t *used);
+static void frame_append(p_frame f, const char *data, size_t count);
+static void frame_queue(p_frame f, const char *data, size_t count);
+static int frame_flush(p_buffer buf, size_t *sent);
+static int frame_recv(lua_State *L, p_buffer buf);
+static const char *frame_error(p_buffer buf, int err);
+
+/* frame error, beyond the IO_* codes */
+#define FRAME_BAD (-100)
+
+/* default limit of a frame payload */
+#define FRAME_MAX (16*1024*1024)
 
 /* min and max macros */
 #ifndef MIN
@@ -41,6 +57,7 @@ int buffer_open(lua_State *L) {
 * Initializes C structure
 \*-------------------------------------------------------------------------*/
 void buffer_init(p_buffer buf, p_io io, p_timeout tm) {
+    memset(&buf->frame, 0, sizeof(buf->frame));
     buf->first = buf->last = 0;
     buf->io = io;
     buf->tm = tm;
@@ -158,6 +175,185 @@ int buffer_isempty(p_buffer buf) {
     return buf->first >= buf->last;
 }
 
+/*-------------------------------------------------------------------------*\
+* Releases the frame storage, the buffer can still be used afterwards
+\*-------------------------------------------------------------------------*/
+void buffer_free(p_buffer buf) {
+    if (buf->frame.data) free(buf->frame.data);
+    buf->frame.data = NULL;
+    buf->frame.first = buf->frame.last = buf->frame.scan = 0;
+    buf->frame.cap = 0;
+    if (buf->frame.out) free(buf->frame.out);
+    buf->frame.out = NULL;
+    buf->frame.outfirst = buf->frame.outlast = buf->frame.outcap = 0;
+}
+
+/*-------------------------------------------------------------------------*\
+* Determines if a complete frame can be taken without reading the socket
+\*-------------------------------------------------------------------------*/
+int buffer_hasframe(p_buffer buf) {
+    p_frame f = &buf->frame;
+    size_t start, len, used;
+    if (f->mode == FRAME_NONE || f->last <= f->first) return 0;
+    return frame_cut(f, f->data + f->first, f->last - f->first, f->scan,
+        &start, &len, &used) > 0;
+}
+
+/*-------------------------------------------------------------------------*\
+* object:setframing(mode [, param] [, max]) interface
+* mode is "length" (param is the prefix size 1, 2 or 4, default 4),
+* "varint", "delimiter" (param is the delimiter, default "\n") or "none"
+\*-------------------------------------------------------------------------*/
+int buffer_meth_setframing(lua_State *L, p_buffer buf) {
+    static const char *modes[] = { "none", "length", "varint", "delimiter", NULL };
+    p_frame f = &buf->frame;
+    int mode = luaL_checkoption(L, 2, NULL, modes);
+    lua_Number max = luaL_optnumber(L, 4, FRAME_MAX);
+    /* the largest frame the prefix can encode, 5 varint bytes hold 35 bits */
+    size_t limit = (size_t) -1;
+    luaL_argcheck(L, max > 0, 4, "invalid frame size limit");
+    if (mode == FRAME_LENGTH) {
+        int size = (int) luaL_optinteger(L, 3, 4);
+        luaL_argcheck(L, size == 1 || size == 2 || size == 4, 3,
+            "prefix size must be 1, 2 or 4");
+        f->size = size;
+        limit = size == 4 ? (size_t) 0xffffffffUL : ((size_t) 1 << (8 * size)) - 1;
+    } else if (mode == FRAME_VARINT) {
+        if (sizeof(size_t) * 8 > 35) limit >>= sizeof(size_t) * 8 - 35;
+    } else if (mode == FRAME_DELIMITER) {
+        size_t len;
+        const char *delim = luaL_optlstring(L, 3, "\n", &len);
+        luaL_argcheck(L, len > 0 && len <= sizeof(f->delim), 3,
+            "delimiter must be 1 to 16 bytes");
+        memcpy(f->delim, delim, len);
+        f->delimlen = len;
+    }
+    f->mode = mode;
+    f->max = max < (lua_Number) limit ? (size_t) max : limit;
+    f->scan = 0;
+    lua_pushnumber(L, 1);
+    return 1;
+}
+
+/*-------------------------------------------------------------------------*\
+* object:receiveframe() interface
+* Returns the next complete frame, partial frames stay in the object
+\*-------------------------------------------------------------------------*/
+int buffer_meth_receiveframe(lua_State *L, p_buffer buf) {
+    int err;
+    if (buf->frame.mode == FRAME_NONE)
+        return luaL_error(L, "framing not set, call setframing first");
+    timeout_markstart(buf->tm);
+    err = frame_recv(L, buf);
+    if (err != IO_DONE) {
+        lua_pushnil(L);
+        lua_pushstring(L, frame_error(buf, err));
+        return 2;
+    }
+    return 1;
+}
+
+/*-------------------------------------------------------------------------*\
+* object:receiveframes([max] [, table]) interface
+* Waits like receiveframe for the first frame, then takes the frames
+* that can be read without waiting. Returns the table, the count and an
+* error, if any.
+* The slot after the last frame is cleared so ipairs stops there.
+\*-------------------------------------------------------------------------*/
+int buffer_meth_receiveframes(lua_State *L, p_buffer buf) {
+    lua_Integer max = luaL_optinteger(L, 2, 64);
+    lua_Integer count = 0;
+    int err = IO_DONE;
+    t_timeout saved = *buf->tm;
+    if (buf->frame.mode == FRAME_NONE)
+        return luaL_error(L, "framing not set, call setframing first");
+    if (lua_istable(L, 3)) lua_settop(L, 3);
+    else {
+        lua_settop(L, 2);
+        lua_createtable(L, (int) MIN(MAX(max, 0), 64), 0);
+    }
+    timeout_markstart(buf->tm);
+    while (count < max) {
+        err = frame_recv(L, buf);
+        if (err != IO_DONE) break;
+        lua_rawseti(L, 3, ++count);
+        /* after the first frame, only poll */
+        if (count == 1) timeout_init(buf->tm, 0.0, -1.0);
+    }
+    *buf->tm = saved;
+    lua_pushnil(L);
+    lua_rawseti(L, 3, count + 1);
+    lua_pushinteger(L, count);
+    /* running out of buffered frames is not an error */
+    if (err == IO_DONE || (err == IO_TIMEOUT && count > 0)) lua_pushnil(L);
+    else lua_pushstring(L, frame_error(buf, err));
+    return 3;
+}
+
+/*-------------------------------------------------------------------------*\
+* object:sendframe([data]) interface
+* Sends data framed in the current mode, small frames in a single write.
+* Whatever a timeout leaves unsent is kept and goes out ahead of the next
+* frame, so frames are never cut. Without data, only flushes what is kept.
+* Returns the bytes written and the bytes still kept
+\*-------------------------------------------------------------------------*/
+int buffer_meth_sendframe(lua_State *L, p_buffer buf) {
+    p_frame f = &buf->frame;
+    size_t size = 0, sent = 0, total, head = 0, tail = 0;
+    const char *data = luaL_optlstring(L, 2, NULL, &size);
+    const char *part[3];
+    size_t len[3];
+    char header[16], local[BUF_SIZE];
+    int err, i, n;
+    if (f->mode == FRAME_NONE)
+        return luaL_error(L, "framing not set, call setframing first");
+    luaL_argcheck(L, size <= f->max, 2, "frame larger than the limit");
+    timeout_markstart(buf->tm);
+    err = frame_flush(buf, &sent);
+    if (data && (err == IO_DONE || err == IO_TIMEOUT)) {
+        if (f->mode == FRAME_LENGTH) {
+            for (i = f->size - 1; i >= 0; i--) header[head++] = (char) (size >> (8 * i));
+        } else if (f->mode == FRAME_VARINT) {
+            size_t v = size;
+            do {
+                header[head++] = (char) ((v & 0x7f) | (v > 0x7f ? 0x80 : 0));
+                v >>= 7;
+            } while (v);
+        } else tail = f->delimlen;
+        total = head + size + tail;
+        if (total <= sizeof(local)) {
+            memcpy(local, header, head);
+            memcpy(local + head, data, size);
+            memcpy(local + head + size, f->delim, tail);
+            part[0] = local; len[0] = total; n = 1;
+        } else {
+            part[0] = header; len[0] = head;
+            part[1] = data; len[1] = size;
+            part[2] = f->delim; len[2] = tail;
+            n = 3;
+        }
+        for (i = 0; i < n; i++) {
+            size_t done = 0;
+            /* behind kept bytes, or after a timeout, the rest is kept */
+            if (err == IO_DONE && f->outfirst == f->outlast) {
+                err = sendraw(buf, part[i], len[i], &done);
+                sent += done;
+            }
+            if (err == IO_DONE || err == IO_TIMEOUT)
+                frame_queue(f, part[i] + done, len[i] - done);
+        }
+    }
+    if (err != IO_DONE && err != IO_TIMEOUT) {
+        lua_pushnil(L);
+        lua_pushstring(L, buf->io->error(buf->io->ctx, err));
+        lua_pushnumber(L, (lua_Number) sent);
+        return 3;
+    }
+    lua_pushnumber(L, (lua_Number) sent);
+    lua_pushnumber(L, (lua_Number) (f->outlast - f->outfirst));
+    return 2;
+}
+
 /*=========================================================================*\
 * Internal functions
 \*=========================================================================*/
@@ -242,6 +438,154 @@ static int recvline(p_buffer buf, luaL_Buffer *b) {
     return err;
 }
 
+/*-------------------------------------------------------------------------*\
+* Finds the first frame in data. Returns 1 and the payload position, or 0
+* if more data is needed, or -1 if the frame is malformed or too large.
+* Delimiter search starts at from, the bytes before were already seen.
+\*-------------------------------------------------------------------------*/
+static int frame_cut(p_frame f, const char *data, size_t count, size_t from,
+        size_t *start, size_t *len, size_t *used) {
+    size_t i, v = 0;
+    if (f->mode == FRAME_LENGTH) {
+        if (count < (size_t) f->size) return 0;
+        for (i = 0; i < (size_t) f->size; i++) v = (v << 8) | (unsigned char) data[i];
+        i = (size_t) f->size;
+    } else if (f->mode == FRAME_VARINT) {
+        for (i = 0; i < count; i++) {
+            if (i >= 5) return -1;
+            v |= (size_t) (data[i] & 0x7f) << (7 * i);
+            if (!(data[i] & 0x80)) break;
+        }
+        if (i == count) return 0;
+        i++;
+    } else {
+        const char *hit = NULL;
+        for (i = from; i + f->delimlen <= count; i++) {
+            hit = memchr(data + i, f->delim[0], count - f->delimlen + 1 - i);
+            if (!hit) break;
+            i = (size_t) (hit - data);
+            if (memcmp(hit, f->delim, f->delimlen) == 0) break;
+            hit = NULL;
+        }
+        if (!hit) return (count > f->max + f->delimlen) ? -1 : 0;
+        *start = 0;
+        *len = i;
+        *used = i + f->delimlen;
+        return *len > f->max ? -1 : 1;
+    }
+    if (v > f->max) return -1;
+    if (count - i < v) return 0;
+    *start = i;
+    *len = v;
+    *used = i + v;
+    return 1;
+}
+
+/*-------------------------------------------------------------------------*\
+* Stores data after the partial frame, compacting or growing as needed
+\*-------------------------------------------------------------------------*/
+static void frame_append(p_frame f, const char *data, size_t count) {
+    if (f->cap - f->last < count && f->first > 0) {
+        memmove(f->data, f->data + f->first, f->last - f->first);
+        f->last -= f->first;
+        f->first = 0;
+    }
+    if (f->cap - f->last < count) {
+        size_t cap = MAX(f->cap * 2, BUF_SIZE);
+        while (cap - f->last < count) cap *= 2;
+        f->data = (char *) realloc(f->data, cap);
+        f->cap = cap;
+    }
+    memcpy(f->data + f->last, data, count);
+    f->last += count;
+}
+
+/*-------------------------------------------------------------------------*\
+* Keeps unsent frame bytes, compacting or growing as needed
+\*-------------------------------------------------------------------------*/
+static void frame_queue(p_frame f, const char *data, size_t count) {
+    if (count == 0) return;
+    if (f->outcap - f->outlast < count && f->outfirst > 0) {
+        memmove(f->out, f->out + f->outfirst, f->outlast - f->outfirst);
+        f->outlast -= f->outfirst;
+        f->outfirst = 0;
+    }
+    if (f->outcap - f->outlast < count) {
+        size_t cap = MAX(f->outcap * 2, BUF_SIZE);
+        while (cap - f->outlast < count) cap *= 2;
+        f->out = (char *) realloc(f->out, cap);
+        f->outcap = cap;
+    }
+    memcpy(f->out + f->outlast, data, count);
+    f->outlast += count;
+}
+
+/*-------------------------------------------------------------------------*\
+* Sends what earlier frames left unsent
+\*-------------------------------------------------------------------------*/
+static int frame_flush(p_buffer buf, size_t *sent) {
+    p_frame f = &buf->frame;
+    int err = IO_DONE;
+    *sent = 0;
+    if (f->outlast > f->outfirst) {
+        err = sendraw(buf, f->out + f->outfirst, f->outlast - f->outfirst, sent);
+        f->outfirst += *sent;
+        if (f->outfirst == f->outlast) f->outfirst = f->outlast = 0;
+    }
+    return err;
+}
+
+/*-------------------------------------------------------------------------*\
+* Pushes the next frame. Frames found whole in the read buffer are
+* pushed from there, only partial frames are copied aside
+\*-------------------------------------------------------------------------*/
+static int frame_recv(lua_State *L, p_buffer buf) {
+    p_frame f = &buf->frame;
+    size_t start, len, used, count;
+    const char *data;
+    int err, r;
+    for ( ;; ) {
+        if (f->last > f->first) {
+            count = f->last - f->first;
+            r = frame_cut(f, f->data + f->first, count, f->scan, &start, &len, &used);
+            if (r > 0) {
+                lua_pushlstring(L, f->data + f->first + start, len);
+                f->first += used;
+                f->scan = 0;
+                if (f->first >= f->last) f->first = f->last = 0;
+                return IO_DONE;
+            }
+            if (r < 0) return FRAME_BAD;
+            if (f->mode == FRAME_DELIMITER && count >= f->delimlen)
+                f->scan = count - f->delimlen + 1;
+            err = buffer_get(buf, &data, &count);
+            if (err != IO_DONE) return err;
+            frame_append(f, data, count);
+            buffer_skip(buf, count);
+            continue;
+        }
+        err = buffer_get(buf, &data, &count);
+        if (err != IO_DONE) return err;
+        r = frame_cut(f, data, count, 0, &start, &len, &used);
+        if (r > 0) {
+            lua_pushlstring(L, data + start, len);
+            buffer_skip(buf, used);
+            return IO_DONE;
+        }
+        if (r < 0) return FRAME_BAD;
+        frame_append(f, data, count);
+        buffer_skip(buf, count);
+    }
+}
+
+/*-------------------------------------------------------------------------*\
+* Error message of a frame operation
+\*-------------------------------------------------------------------------*/
+static const char *frame_error(p_buffer buf, int err) {
+    if (err == FRAME_BAD) return "bad frame";
+    return buf->io->error(buf->io->ctx, err);
+}
+
 /*-------------------------------------------------------------------------*\
 * Skips a given number of bytes from read buffer. No data is read from the
 * transport layer
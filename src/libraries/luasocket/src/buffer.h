@@ -23,6 +23,31 @@
 /* buffer size in bytes */
 #define BUF_SIZE 8192
 
+/* framing modes for receiveframe/sendframe */
+enum {
+    FRAME_NONE = 0,         /* framing not set */
+    FRAME_LENGTH,           /* big-endian length prefix of 1, 2 or 4 bytes */
+    FRAME_VARINT,           /* LEB128 varint length prefix */
+    FRAME_DELIMITER         /* frames end with a delimiter string */
+};
+
+/* frame control structure, holds the partial frame between calls */
+typedef struct t_frame_ {
+    int mode;               /* one of the FRAME_* modes */
+    int size;               /* bytes in a length prefix */
+    size_t max;             /* largest frame payload accepted */
+    char delim[16];         /* delimiter and its length */
+    size_t delimlen;
+    char *data;             /* storage for partial frames, grows as needed */
+    size_t first, last;     /* index of first and last bytes of stored data */
+    size_t scan;            /* stored bytes already searched for delimiter */
+    size_t cap;
+    char *out;              /* unsent rest of frames, goes out first */
+    size_t outfirst, outlast;
+    size_t outcap;
+} t_frame;
+typedef t_frame *p_frame;
+
 /* buffer control structure */
 typedef struct t_buffer_ {
     double birthday;        /* throttle support info: creation time, */
@@ -30,6 +55,7 @@ typedef struct t_buffer_ {
     p_io io;                /* IO driver used for this buffer */
     p_timeout tm;           /* timeout management for this buffer */
     size_t first, last;     /* index of first and last bytes of stored data */
+    t_frame frame;          /* framing state, used by the frame methods */
     char data[BUF_SIZE];    /* storage space for buffer data */
 } t_buffer;
 typedef t_buffer *p_buffer;
@@ -41,5 +67,11 @@ int buffer_meth_receive(lua_State *L, p_buffer buf);
 int buffer_meth_getstats(lua_State *L, p_buffer buf);
 int buffer_meth_setstats(lua_State *L, p_buffer buf);
 int buffer_isempty(p_buffer buf);
+int buffer_meth_setframing(lua_State *L, p_buffer buf);
+int buffer_meth_receiveframe(lua_State *L, p_buffer buf);
+int buffer_meth_receiveframes(lua_State *L, p_buffer buf);
+int buffer_meth_sendframe(lua_State *L, p_buffer buf);
+int buffer_hasframe(p_buffer buf);
+void buffer_free(p_buffer buf);
 
 #endif /* BUF_H */
@@ -41,6 +41,10 @@ static int meth_settimeout(lua_State *L);
 static int meth_getfd(lua_State *L);
 static int meth_setfd(lua_State *L);
 static int meth_dirty(lua_State *L);
+static int meth_setframing(lua_State *L);
+static int meth_receiveframe(lua_State *L);
+static int meth_receiveframes(lua_State *L);
+static int meth_sendframe(lua_State *L);
 
 /* tcp object methods */
 static luaL_Reg tcp_methods[] = {
@@ -60,8 +64,12 @@ static luaL_Reg tcp_methods[] = {
     {"setstats",    meth_setstats},
     {"listen",      meth_listen},
     {"receive",     meth_receive},
+    {"receiveframe", meth_receiveframe},
+    {"receiveframes", meth_receiveframes},
     {"send",        meth_send},
+    {"sendframe",   meth_sendframe},
     {"setfd",       meth_setfd},
+    {"setframing",  meth_setframing},
     {"setoption",   meth_setoption},
     {"setpeername", meth_connect},
     {"setsockname", meth_bind},
@@ -135,6 +143,26 @@ static int meth_receive(lua_State *L) {
     return buffer_meth_receive(L, &tcp->buf);
 }
 
+static int meth_setframing(lua_State *L) {
+    p_tcp tcp = (p_tcp) auxiliar_checkclass(L, "tcp{client}", 1);
+    return buffer_meth_setframing(L, &tcp->buf);
+}
+
+static int meth_receiveframe(lua_State *L) {
+    p_tcp tcp = (p_tcp) auxiliar_checkclass(L, "tcp{client}", 1);
+    return buffer_meth_receiveframe(L, &tcp->buf);
+}
+
+static int meth_receiveframes(lua_State *L) {
+    p_tcp tcp = (p_tcp) auxiliar_checkclass(L, "tcp{client}", 1);
+    return buffer_meth_receiveframes(L, &tcp->buf);
+}
+
+static int meth_sendframe(lua_State *L) {
+    p_tcp tcp = (p_tcp) auxiliar_checkclass(L, "tcp{client}", 1);
+    return buffer_meth_sendframe(L, &tcp->buf);
+}
+
 static int meth_getstats(lua_State *L) {
     p_tcp tcp = (p_tcp) auxiliar_checkclass(L, "tcp{client}", 1);
     return buffer_meth_getstats(L, &tcp->buf);
@@ -181,7 +209,7 @@ static int meth_setfd(lua_State *L)
 static int meth_dirty(lua_State *L)
 {
     p_tcp tcp = (p_tcp) auxiliar_checkgroup(L, "tcp{any}", 1);
-    lua_pushboolean(L, !buffer_isempty(&tcp->buf));
+    lua_pushboolean(L, !buffer_isempty(&tcp->buf) || buffer_hasframe(&tcp->buf));
     return 1;
 }
 
@@ -273,6 +301,7 @@ static int meth_close(lua_State *L)
 {
     p_tcp tcp = (p_tcp) auxiliar_checkgroup(L, "tcp{any}", 1);
     socket_destroy(&tcp->sock);
+    buffer_free(&tcp->buf);
     lua_pushnumber(L, 1);
     return 1;
 }
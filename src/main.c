@@ -13,9 +13,11 @@
 #include "common/logger.h"
 #include "common/vfs.h"
 #include "common/handle.h"
+#include "common/serial.h"
 #include "modules/sevo/sevo.h"
 #include "modules/gmp/wrap_gmp.h"
 #include "modules/thread/wrap_thread.h"
+#include "modules/worker/wrap_worker.h"
 #include "modules/env/wrap_env.h"
 #include <string.h>
 #include <stdlib.h>
@@ -109,13 +111,16 @@ static int sevo_main(int argc, char *argv[]) {
     gmp_init();
     logger_init();
     thread_init();
+    worker_init();
 
     do {
         retval = -1;
         done = sevo_run(argc, argv, &retval);
     } while (DONE_QUIT != done);
 
+    worker_deinit();
     thread_deinit();
+    serial_deinit();
     logger_deinit();
     gmp_deinit();
     mc_destroy();
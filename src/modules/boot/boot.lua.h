@@ -99,8 +99,8 @@ static const unsigned char boot_lua[] = {
     0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x05, 0x6D, 0x64, 0x69, 0x72, 0x1E, 0x00, 0x00, 0x00, 0x36,
     0x00, 0x00, 0x00, 0x02, 0x5F, 0x29, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x05, 0x6D, 0x7A,
     0x69, 0x70, 0x29, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x5F,
-    0x45, 0x4E, 0x56, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x02, 0x4D, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xAA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x01, 0x00, 0x0A, 0x80,
+    0x45, 0x4E, 0x56, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x02, 0x4D, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xAC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xD1, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x01, 0x00, 0x0A, 0x80,
     0xC0, 0x80, 0x46, 0x00, 0xC1, 0x00, 0x0A, 0x40, 0x80, 0x81, 0x0A, 0x80, 0xC1, 0x82, 0x0A, 0x00,
     0xC2, 0x83, 0x0A, 0x80, 0xC2, 0x84, 0x0A, 0x00, 0xC3, 0x85, 0x08, 0x00, 0x00, 0x80, 0x04, 0x00,
     0x00, 0x00, 0x46, 0x40, 0xC3, 0x00, 0x47, 0x80, 0xC3, 0x00, 0x81, 0xC0, 0x03, 0x00, 0x64, 0x80,
@@ -140,46 +140,47 @@ static const unsigned char boot_lua[] = {
     0x00, 0x00, 0xCA, 0x00, 0x81, 0x96, 0xC6, 0xC0, 0x4B, 0x01, 0x0B, 0x41, 0x00, 0x00, 0x6C, 0x01,
     0x01, 0x00, 0x0A, 0x41, 0x01, 0x98, 0x4B, 0x41, 0x00, 0x00, 0xAC, 0x41, 0x01, 0x00, 0x4A, 0x81,
     0x81, 0x98, 0xE4, 0x80, 0x80, 0x01, 0x08, 0xC0, 0x00, 0x97, 0xC6, 0x80, 0x4C, 0x01, 0x0B, 0x01,
-    0x00, 0x05, 0x41, 0xC1, 0x0C, 0x00, 0x81, 0x01, 0x0D, 0x00, 0xC1, 0x41, 0x0D, 0x00, 0x01, 0x82,
-    0x0D, 0x00, 0x41, 0xC2, 0x0D, 0x00, 0x81, 0x02, 0x0E, 0x00, 0xC1, 0x42, 0x0E, 0x00, 0x01, 0x83,
-    0x0E, 0x00, 0x41, 0xC3, 0x0E, 0x00, 0x81, 0x03, 0x0F, 0x00, 0x2B, 0x41, 0x00, 0x05, 0xE4, 0x00,
-    0x01, 0x01, 0x1E, 0x00, 0x01, 0x80, 0x06, 0x42, 0x44, 0x01, 0x41, 0x42, 0x0F, 0x00, 0x80, 0x02,
-    0x80, 0x03, 0x5D, 0x82, 0x82, 0x04, 0x24, 0x42, 0x00, 0x01, 0xE9, 0x80, 0x00, 0x00, 0x6A, 0x01,
-    0xFE, 0x7F, 0xC6, 0x40, 0xC3, 0x00, 0xC7, 0x80, 0xC3, 0x01, 0x01, 0x81, 0x0F, 0x00, 0xE4, 0x80,
-    0x00, 0x01, 0xE2, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x01, 0x80, 0xC6, 0xC0, 0xCF, 0x00, 0x01, 0x01,
-    0x10, 0x00, 0xE4, 0x40, 0x00, 0x01, 0xC3, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x01, 0xC6, 0x00,
-    0x44, 0x01, 0x06, 0x41, 0x44, 0x01, 0x46, 0x81, 0x44, 0x00, 0x81, 0x41, 0x10, 0x00, 0xE4, 0x80,
-    0x00, 0x02, 0x00, 0x00, 0x80, 0x01, 0x22, 0x40, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0xC3, 0x00,
-    0x00, 0x00, 0xE6, 0x00, 0x00, 0x01, 0xC6, 0x00, 0x40, 0x00, 0x06, 0x01, 0x40, 0x00, 0x07, 0x41,
-    0x42, 0x02, 0x12, 0x01, 0x81, 0xA1, 0xCA, 0x00, 0x01, 0xA1, 0xC3, 0x00, 0x80, 0x00, 0xE6, 0x00,
-    0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x44, 0x00, 0x00, 0x00, 0x04, 0x05, 0x63, 0x6F, 0x6E, 0x66,
-    0x04, 0x09, 0x6E, 0x6F, 0x64, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x04, 0x08, 0x76, 0x65, 0x72,
-    0x73, 0x69, 0x6F, 0x6E, 0x04, 0x09, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x04, 0x09,
-    0x6C, 0x6F, 0x67, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x04, 0x06, 0x64, 0x65, 0x62, 0x75, 0x67, 0x04,
-    0x07, 0x63, 0x6F, 0x6F, 0x6B, 0x69, 0x65, 0x04, 0x01, 0x04, 0x05, 0x74, 0x69, 0x63, 0x6B, 0x13,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x71,
-    0x75, 0x69, 0x74, 0x01, 0x00, 0x04, 0x04, 0x76, 0x66, 0x73, 0x04, 0x05, 0x69, 0x6E, 0x66, 0x6F,
-    0x04, 0x09, 0x63, 0x6F, 0x6E, 0x66, 0x2E, 0x6C, 0x75, 0x61, 0x04, 0x07, 0x78, 0x70, 0x63, 0x61,
-    0x6C, 0x6C, 0x04, 0x08, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x04, 0x0E, 0x65, 0x72, 0x72,
-    0x6F, 0x72, 0x5F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x04, 0x04, 0x61, 0x72, 0x67, 0x13,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x67, 0x73, 0x75, 0x62, 0x04, 0x02,
-    0x5C, 0x04, 0x02, 0x2F, 0x04, 0x07, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x04, 0x06, 0x6D, 0x61,
-    0x74, 0x63, 0x68, 0x04, 0x0A, 0x5E, 0x2E, 0x2B, 0x2F, 0x28, 0x2E, 0x2B, 0x29, 0x24, 0x04, 0x0B,
-    0x28, 0x2E, 0x2B, 0x29, 0x25, 0x2E, 0x25, 0x77, 0x2B, 0x24, 0x04, 0x05, 0x66, 0x69, 0x6E, 0x64,
-    0x04, 0x02, 0x40, 0x04, 0x07, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x04, 0x04, 0x64, 0x6E, 0x73,
-    0x04, 0x0C, 0x67, 0x65, 0x74, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x04, 0x05, 0x74,
-    0x6F, 0x69, 0x70, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x03, 0x69, 0x70, 0x04, 0x0B,
-    0x74, 0x6F, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x04, 0x09, 0x25, 0x77, 0x2B, 0x25,
-    0x2E, 0x25, 0x77, 0x2B, 0x04, 0x12, 0x5E, 0x28, 0x25, 0x61, 0x5B, 0x25, 0x77, 0x5F, 0x5D, 0x2A,
-    0x29, 0x40, 0x28, 0x2E, 0x2B, 0x29, 0x24, 0x04, 0x05, 0x6E, 0x6F, 0x64, 0x65, 0x04, 0x09, 0x69,
-    0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x04, 0x06, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x04, 0x05,
-    0x70, 0x75, 0x6D, 0x70, 0x04, 0x05, 0x70, 0x6F, 0x6C, 0x6C, 0x04, 0x05, 0x70, 0x75, 0x73, 0x68,
-    0x04, 0x05, 0x71, 0x75, 0x69, 0x74, 0x04, 0x09, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73,
-    0x04, 0x0D, 0x73, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x04, 0x05,
-    0x71, 0x75, 0x69, 0x74, 0x04, 0x08, 0x5F, 0x5F, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x04, 0x07, 0x69,
-    0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x03, 0x69, 0x64, 0x04, 0x05, 0x74, 0x69, 0x6D, 0x65, 0x04,
-    0x05, 0x68, 0x61, 0x73, 0x68, 0x04, 0x05, 0x72, 0x61, 0x6E, 0x64, 0x04, 0x04, 0x6E, 0x65, 0x74,
-    0x04, 0x07, 0x73, 0x65, 0x63, 0x75, 0x72, 0x65, 0x04, 0x07, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+    0x00, 0x06, 0x41, 0xC1, 0x0C, 0x00, 0x81, 0x01, 0x0D, 0x00, 0xC1, 0x41, 0x0D, 0x00, 0x01, 0x82,
+    0x0D, 0x00, 0x41, 0xC2, 0x0D, 0x00, 0x81, 0xC2, 0x0A, 0x00, 0xC1, 0x02, 0x0E, 0x00, 0x01, 0x43,
+    0x0E, 0x00, 0x41, 0x83, 0x0E, 0x00, 0x81, 0xC3, 0x0E, 0x00, 0xC1, 0x03, 0x0F, 0x00, 0x01, 0x44,
+    0x0F, 0x00, 0x2B, 0x41, 0x00, 0x06, 0xE4, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x01, 0x80, 0x06, 0x42,
+    0x44, 0x01, 0x41, 0x82, 0x0F, 0x00, 0x80, 0x02, 0x80, 0x03, 0x5D, 0x82, 0x82, 0x04, 0x24, 0x42,
+    0x00, 0x01, 0xE9, 0x80, 0x00, 0x00, 0x6A, 0x01, 0xFE, 0x7F, 0xC6, 0x40, 0xC3, 0x00, 0xC7, 0x80,
+    0xC3, 0x01, 0x01, 0xC1, 0x0F, 0x00, 0xE4, 0x80, 0x00, 0x01, 0xE2, 0x40, 0x00, 0x00, 0x1E, 0x00,
+    0x01, 0x80, 0xC6, 0x00, 0xD0, 0x00, 0x01, 0x41, 0x10, 0x00, 0xE4, 0x40, 0x00, 0x01, 0xC3, 0x00,
+    0x00, 0x00, 0xE6, 0x00, 0x00, 0x01, 0xC6, 0x00, 0x44, 0x01, 0x06, 0x41, 0x44, 0x01, 0x46, 0x81,
+    0x44, 0x00, 0x81, 0x81, 0x10, 0x00, 0xE4, 0x80, 0x00, 0x02, 0x00, 0x00, 0x80, 0x01, 0x22, 0x40,
+    0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0xC3, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x01, 0xC6, 0x00,
+    0x40, 0x00, 0x06, 0x01, 0x40, 0x00, 0x07, 0x41, 0x42, 0x02, 0x12, 0x01, 0x01, 0xA2, 0xCA, 0x00,
+    0x81, 0xA1, 0xC3, 0x00, 0x80, 0x00, 0xE6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x45, 0x00,
+    0x00, 0x00, 0x04, 0x05, 0x63, 0x6F, 0x6E, 0x66, 0x04, 0x09, 0x6E, 0x6F, 0x64, 0x65, 0x6E, 0x61,
+    0x6D, 0x65, 0x00, 0x04, 0x08, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x04, 0x09, 0x5F, 0x56,
+    0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x04, 0x09, 0x6C, 0x6F, 0x67, 0x6C, 0x65, 0x76, 0x65, 0x6C,
+    0x04, 0x06, 0x64, 0x65, 0x62, 0x75, 0x67, 0x04, 0x07, 0x63, 0x6F, 0x6F, 0x6B, 0x69, 0x65, 0x04,
+    0x01, 0x04, 0x05, 0x74, 0x69, 0x63, 0x6B, 0x13, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x0A, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x71, 0x75, 0x69, 0x74, 0x01, 0x00, 0x04, 0x04, 0x76,
+    0x66, 0x73, 0x04, 0x05, 0x69, 0x6E, 0x66, 0x6F, 0x04, 0x09, 0x63, 0x6F, 0x6E, 0x66, 0x2E, 0x6C,
+    0x75, 0x61, 0x04, 0x07, 0x78, 0x70, 0x63, 0x61, 0x6C, 0x6C, 0x04, 0x08, 0x72, 0x65, 0x71, 0x75,
+    0x69, 0x72, 0x65, 0x04, 0x0E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x68, 0x61, 0x6E, 0x64, 0x6C,
+    0x65, 0x72, 0x04, 0x04, 0x61, 0x72, 0x67, 0x13, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x05, 0x67, 0x73, 0x75, 0x62, 0x04, 0x02, 0x5C, 0x04, 0x02, 0x2F, 0x04, 0x07, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x04, 0x06, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x04, 0x0A, 0x5E, 0x2E, 0x2B,
+    0x2F, 0x28, 0x2E, 0x2B, 0x29, 0x24, 0x04, 0x0B, 0x28, 0x2E, 0x2B, 0x29, 0x25, 0x2E, 0x25, 0x77,
+    0x2B, 0x24, 0x04, 0x05, 0x66, 0x69, 0x6E, 0x64, 0x04, 0x02, 0x40, 0x04, 0x07, 0x73, 0x6F, 0x63,
+    0x6B, 0x65, 0x74, 0x04, 0x04, 0x64, 0x6E, 0x73, 0x04, 0x0C, 0x67, 0x65, 0x74, 0x68, 0x6F, 0x73,
+    0x74, 0x6E, 0x61, 0x6D, 0x65, 0x04, 0x05, 0x74, 0x6F, 0x69, 0x70, 0x04, 0x06, 0x70, 0x61, 0x69,
+    0x72, 0x73, 0x04, 0x03, 0x69, 0x70, 0x04, 0x0B, 0x74, 0x6F, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61,
+    0x6D, 0x65, 0x04, 0x09, 0x25, 0x77, 0x2B, 0x25, 0x2E, 0x25, 0x77, 0x2B, 0x04, 0x12, 0x5E, 0x28,
+    0x25, 0x61, 0x5B, 0x25, 0x77, 0x5F, 0x5D, 0x2A, 0x29, 0x40, 0x28, 0x2E, 0x2B, 0x29, 0x24, 0x04,
+    0x05, 0x6E, 0x6F, 0x64, 0x65, 0x04, 0x09, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x04,
+    0x06, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x04, 0x05, 0x70, 0x75, 0x6D, 0x70, 0x04, 0x05, 0x70, 0x6F,
+    0x6C, 0x6C, 0x04, 0x05, 0x70, 0x75, 0x73, 0x68, 0x04, 0x05, 0x71, 0x75, 0x69, 0x74, 0x04, 0x09,
+    0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73, 0x04, 0x0D, 0x73, 0x65, 0x74, 0x6D, 0x65, 0x74,
+    0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x04, 0x05, 0x71, 0x75, 0x69, 0x74, 0x04, 0x08, 0x5F, 0x5F,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x04, 0x07, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x03, 0x69,
+    0x64, 0x04, 0x05, 0x74, 0x69, 0x6D, 0x65, 0x04, 0x05, 0x68, 0x61, 0x73, 0x68, 0x04, 0x05, 0x72,
+    0x61, 0x6E, 0x64, 0x04, 0x04, 0x6E, 0x65, 0x74, 0x04, 0x07, 0x73, 0x65, 0x63, 0x75, 0x72, 0x65,
+    0x04, 0x07, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x04, 0x07, 0x77, 0x6F, 0x72, 0x6B, 0x65, 0x72,
     0x04, 0x04, 0x64, 0x62, 0x6D, 0x04, 0x04, 0x65, 0x6E, 0x76, 0x04, 0x05, 0x6D, 0x61, 0x74, 0x68,
     0x04, 0x06, 0x73, 0x65, 0x76, 0x6F, 0x2E, 0x04, 0x0A, 0x73, 0x65, 0x72, 0x76, 0x6F, 0x2E, 0x6C,
     0x75, 0x61, 0x04, 0x06, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x14, 0x31, 0x27, 0x73, 0x65, 0x72, 0x76,
@@ -239,7 +240,7 @@ static const unsigned char boot_lua[] = {
     0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x8A, 0x00,
     0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x00,
     0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0xCF, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0xD1, 0x00, 0x00,
     0x00, 0x3D, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
     0x00, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00,
     0x00, 0x44, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00,
@@ -281,163 +282,192 @@ static const unsigned char boot_lua[] = {
     0x00, 0x8B, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00,
     0x00, 0x8E, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
     0x00, 0x91, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00,
-    0x00, 0x95, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00,
-    0x00, 0x99, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00,
-    0x00, 0x9A, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00,
-    0x00, 0x8E, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00,
-    0x00, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00,
-    0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00,
-    0x00, 0xA3, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00,
-    0x00, 0xA4, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00,
-    0x00, 0xA7, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00,
-    0x00, 0xA9, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x07, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x0A, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00,
-    0x03, 0x6E, 0x70, 0x35, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x06, 0x65, 0x6E, 0x74, 0x72,
-    0x79, 0x3D, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74,
-    0x52, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x09, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D,
-    0x65, 0x55, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x02, 0x5F, 0x59, 0x00, 0x00, 0x00, 0x77,
-    0x00, 0x00, 0x00, 0x09, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x72, 0x59, 0x00, 0x00, 0x00,
-    0x77, 0x00, 0x00, 0x00, 0x05, 0x66, 0x71, 0x64, 0x6E, 0x5A, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00,
-    0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72,
-    0x29, 0x5D, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73,
-    0x74, 0x61, 0x74, 0x65, 0x29, 0x5D, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66,
-    0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x5D, 0x00, 0x00, 0x00, 0x6E,
-    0x00, 0x00, 0x00, 0x02, 0x5F, 0x5E, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x02, 0x76, 0x5E,
-    0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x6F, 0x64, 0x65, 0x7D, 0x00, 0x00, 0x00,
-    0xCF, 0x00, 0x00, 0x00, 0x05, 0x68, 0x6F, 0x73, 0x74, 0x7D, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00,
-    0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72,
-    0x29, 0xAA, 0x00, 0x00, 0x00, 0xB2, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73,
-    0x74, 0x61, 0x74, 0x65, 0x29, 0xAA, 0x00, 0x00, 0x00, 0xB2, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66,
-    0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0xAA, 0x00, 0x00, 0x00, 0xB2,
-    0x00, 0x00, 0x00, 0x02, 0x69, 0xAB, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x02, 0x76, 0xAB,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x73, 0x65,
-    0x76, 0x6F, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0xAC, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1E,
-    0x80, 0x00, 0x80, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0xC0, 0x00, 0x24, 0x40, 0x00, 0x01, 0x06,
-    0x80, 0x40, 0x00, 0x07, 0xC0, 0x40, 0x00, 0x46, 0x00, 0x41, 0x01, 0x47, 0xC0, 0xC0, 0x00, 0x24,
-    0x80, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x04, 0x05, 0x6C, 0x6F, 0x61, 0x64, 0x04, 0x04, 0x61, 0x72, 0x67, 0x04, 0x05,
-    0x74, 0x69, 0x6D, 0x65, 0x04, 0x04, 0x66, 0x70, 0x73, 0x04, 0x05, 0x63, 0x6F, 0x6E, 0x66, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB1, 0x00,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x4C, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x0C, 0x00, 0x40, 0x00, 0x24, 0x40, 0x00, 0x01, 0x06, 0x40, 0xC0, 0x00, 0x45, 0x00, 0x00,
-    0x00, 0x4C, 0x80, 0xC0, 0x00, 0x64, 0x00, 0x00, 0x01, 0x24, 0x80, 0x00, 0x00, 0x46, 0xC0, 0xC0,
-    0x00, 0x62, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0D, 0x80, 0x46, 0xC0, 0xC0, 0x00, 0x47, 0x00, 0xC1,
-    0x00, 0x64, 0x40, 0x80, 0x00, 0x46, 0xC0, 0xC0, 0x00, 0x47, 0x40, 0xC1, 0x00, 0x64, 0x00, 0x81,
-    0x00, 0x1E, 0xC0, 0x0A, 0x80, 0x1F, 0x80, 0x41, 0x02, 0x1E, 0x00, 0x08, 0x80, 0xC6, 0x82, 0xC1,
-    0x00, 0xE2, 0x02, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0xC6, 0x82, 0xC1, 0x00, 0xE4, 0x42, 0x80,
-    0x00, 0x22, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x05, 0x80, 0xC6, 0xC2, 0x41, 0x01, 0xC7, 0x02, 0xC2,
-    0x05, 0xE2, 0x42, 0x00, 0x00, 0x1E, 0x40, 0x04, 0x80, 0xC6, 0x42, 0xC2, 0x00, 0x01, 0x83, 0x02,
-    0x00, 0xE4, 0x42, 0x00, 0x01, 0x22, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0x80, 0xC5, 0x02, 0x00,
-    0x00, 0xCC, 0x02, 0xC0, 0x05, 0xE4, 0x42, 0x00, 0x01, 0xC6, 0x42, 0xC0, 0x00, 0x05, 0x03, 0x00,
-    0x00, 0x0C, 0x83, 0x40, 0x06, 0x24, 0x03, 0x00, 0x01, 0xE4, 0x82, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x05, 0xC5, 0x02, 0x00, 0x00, 0xCC, 0xC2, 0xC2, 0x05, 0xE4, 0x42, 0x00, 0x01, 0x1E, 0x00, 0xFC,
-    0x7F, 0xE3, 0x42, 0x80, 0x02, 0x1E, 0x00, 0x00, 0x80, 0xC1, 0x02, 0x03, 0x00, 0xE6, 0x02, 0x00,
-    0x01, 0xC6, 0x42, 0x43, 0x01, 0xC7, 0x02, 0x81, 0x05, 0x00, 0x03, 0x80, 0x02, 0x40, 0x03, 0x00,
+    0x00, 0x95, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00,
+    0x00, 0x99, 0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00,
+    0x00, 0x9B, 0x00, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x9C, 0x00, 0x00,
+    0x00, 0x9C, 0x00, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00,
+    0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
+    0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00,
+    0x00, 0xA1, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x00,
+    0x00, 0xA5, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x00,
+    0x00, 0xA5, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00,
+    0x00, 0xA6, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00,
+    0x00, 0xA9, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00,
+    0x00, 0xAC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74,
+    0x0A, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x03, 0x6E, 0x70, 0x35, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x06, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x3D, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00,
+    0x00, 0x07, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x52, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00,
+    0x09, 0x68, 0x6F, 0x73, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x55, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00,
+    0x00, 0x02, 0x5F, 0x59, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x09, 0x72, 0x65, 0x73, 0x6F,
+    0x6C, 0x76, 0x65, 0x72, 0x59, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x05, 0x66, 0x71, 0x64,
+    0x6E, 0x5A, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67,
+    0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x5D, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00,
+    0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x5D, 0x00, 0x00,
+    0x00, 0x6E, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72,
+    0x6F, 0x6C, 0x29, 0x5D, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x02, 0x5F, 0x5E, 0x00, 0x00,
+    0x00, 0x6C, 0x00, 0x00, 0x00, 0x02, 0x76, 0x5E, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x05,
+    0x6E, 0x6F, 0x64, 0x65, 0x7D, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x05, 0x68, 0x6F, 0x73,
+    0x74, 0x7D, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67,
+    0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0xAC, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
+    0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0xAC, 0x00, 0x00,
+    0x00, 0xB4, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72,
+    0x6F, 0x6C, 0x29, 0xAC, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x02, 0x69, 0xAD, 0x00, 0x00,
+    0x00, 0xB2, 0x00, 0x00, 0x00, 0x02, 0x76, 0xAD, 0x00, 0x00, 0x00, 0xB2, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00,
+    0xAE, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0E, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x40, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x06, 0x00, 0x40, 0x00, 0x46,
+    0x40, 0xC0, 0x00, 0x24, 0x40, 0x00, 0x01, 0x06, 0x80, 0x40, 0x00, 0x07, 0xC0, 0x40, 0x00, 0x46,
+    0x00, 0x41, 0x01, 0x47, 0xC0, 0xC0, 0x00, 0x24, 0x80, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x05, 0x6C, 0x6F, 0x61,
+    0x64, 0x04, 0x04, 0x61, 0x72, 0x67, 0x04, 0x05, 0x74, 0x69, 0x6D, 0x65, 0x04, 0x04, 0x66, 0x70,
+    0x73, 0x04, 0x05, 0x63, 0x6F, 0x6E, 0x66, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB3, 0x00, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x79, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x24, 0x40, 0x00,
+    0x01, 0x06, 0x40, 0xC0, 0x00, 0x07, 0x80, 0x40, 0x00, 0x24, 0x80, 0x80, 0x00, 0x46, 0xC0, 0xC0,
+    0x00, 0x85, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x41, 0x01, 0xA4, 0x00, 0x00, 0x01, 0x64, 0x80, 0x00,
+    0x00, 0x86, 0x40, 0xC0, 0x00, 0x87, 0x00, 0x40, 0x01, 0xC5, 0x00, 0x00, 0x00, 0xCC, 0x00, 0xC1,
+    0x01, 0xE4, 0x00, 0x00, 0x01, 0xA4, 0x40, 0x00, 0x00, 0x86, 0x40, 0xC1, 0x00, 0xA2, 0x00, 0x00,
+    0x00, 0x1E, 0x80, 0x0E, 0x80, 0x86, 0x40, 0xC1, 0x00, 0x87, 0x80, 0x41, 0x01, 0xA4, 0x40, 0x80,
+    0x00, 0x86, 0x40, 0xC1, 0x00, 0x87, 0xC0, 0x41, 0x01, 0xA4, 0x00, 0x81, 0x00, 0x1E, 0x40, 0x0C,
+    0x80, 0x1F, 0x00, 0xC2, 0x02, 0x1E, 0x80, 0x09, 0x80, 0x06, 0x03, 0xC2, 0x00, 0x22, 0x03, 0x00,
+    0x00, 0x1E, 0x40, 0x00, 0x80, 0x06, 0x03, 0xC2, 0x00, 0x24, 0x43, 0x80, 0x00, 0x62, 0x00, 0x00,
+    0x00, 0x1E, 0xC0, 0x06, 0x80, 0x06, 0x43, 0x42, 0x01, 0x07, 0x83, 0x42, 0x06, 0x22, 0x43, 0x00,
+    0x00, 0x1E, 0xC0, 0x05, 0x80, 0x06, 0xC3, 0xC2, 0x00, 0x41, 0x03, 0x03, 0x00, 0x24, 0x43, 0x00,
+    0x01, 0x62, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x04, 0x80, 0x05, 0x03, 0x00, 0x00, 0x0C, 0x03, 0x40,
+    0x06, 0x24, 0x43, 0x00, 0x01, 0x06, 0xC3, 0xC0, 0x00, 0x45, 0x03, 0x00, 0x00, 0x4C, 0x03, 0xC1,
+    0x06, 0x64, 0x03, 0x00, 0x01, 0x24, 0x83, 0x00, 0x00, 0x40, 0x00, 0x00, 0x06, 0x06, 0x43, 0xC0,
+    0x00, 0x07, 0x03, 0x40, 0x06, 0x45, 0x03, 0x00, 0x00, 0x4C, 0x03, 0xC1, 0x06, 0x64, 0x03, 0x00,
+    0x01, 0x24, 0x43, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x0C, 0x43, 0x43, 0x06, 0x24, 0x43, 0x00,
+    0x01, 0x1E, 0x80, 0xFA, 0x7F, 0x23, 0x43, 0x00, 0x03, 0x1E, 0x00, 0x00, 0x80, 0x01, 0x83, 0x03,
+    0x00, 0x26, 0x03, 0x00, 0x01, 0x06, 0xC3, 0x43, 0x01, 0x07, 0x43, 0x01, 0x06, 0x40, 0x03, 0x00,
     0x03, 0x80, 0x03, 0x80, 0x03, 0xC0, 0x03, 0x00, 0x04, 0x00, 0x04, 0x80, 0x04, 0x40, 0x04, 0x00,
-    0x05, 0xE4, 0x42, 0x80, 0x03, 0x69, 0xC0, 0x01, 0x00, 0xEA, 0x40, 0xF4, 0x7F, 0x46, 0x00, 0xC0,
-    0x00, 0x62, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x01, 0x80, 0x46, 0x00, 0xC0, 0x00, 0x85, 0x00, 0x00,
-    0x00, 0x8C, 0x80, 0x40, 0x01, 0xA4, 0x00, 0x00, 0x01, 0x64, 0x40, 0x00, 0x00, 0x45, 0x00, 0x00,
-    0x00, 0x4C, 0xC0, 0xC2, 0x00, 0x64, 0x40, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x04, 0x07, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x04, 0x0A, 0x73, 0x63, 0x68, 0x65, 0x64,
-    0x75, 0x6C, 0x65, 0x72, 0x04, 0x06, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x04, 0x06, 0x65, 0x76, 0x65,
-    0x6E, 0x74, 0x04, 0x05, 0x70, 0x75, 0x6D, 0x70, 0x04, 0x05, 0x70, 0x6F, 0x6C, 0x6C, 0x04, 0x05,
-    0x71, 0x75, 0x69, 0x74, 0x04, 0x05, 0x63, 0x6F, 0x6E, 0x66, 0x04, 0x0A, 0x66, 0x6F, 0x72, 0x63,
-    0x65, 0x71, 0x75, 0x69, 0x74, 0x04, 0x05, 0x77, 0x61, 0x72, 0x6E, 0x14, 0x33, 0x53, 0x6F, 0x6D,
-    0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20,
-    0x61, 0x6C, 0x69, 0x76, 0x65, 0x64, 0x2C, 0x20, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20,
-    0x66, 0x6F, 0x72, 0x20, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x69, 0x6E, 0x67, 0x2E, 0x04,
-    0x05, 0x77, 0x61, 0x69, 0x74, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09,
-    0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0xB2, 0x00, 0x00, 0x00, 0xB2, 0x00,
-    0x00, 0x00, 0xB2, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0xB6, 0x00,
-    0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0xB7, 0x00,
-    0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xB9, 0x00,
-    0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
-    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0xC1, 0x00,
-    0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC2, 0x00,
-    0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC3, 0x00,
-    0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0xC7, 0x00,
-    0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC9, 0x00,
-    0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xC9, 0x00,
-    0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xC9, 0x00,
-    0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0xCD, 0x00,
-    0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0xCD, 0x00,
-    0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0xCF, 0x00,
-    0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x06, 0x61,
-    0x6C, 0x69, 0x76, 0x65, 0x08, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F,
-    0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x11, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29,
-    0x11, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F,
-    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x11, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x05, 0x6E,
-    0x61, 0x6D, 0x65, 0x12, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x61, 0x12, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x62, 0x12, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02,
-    0x63, 0x12, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x64, 0x12, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x02, 0x65, 0x12, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x66, 0x12,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x66, 0x70, 0x73, 0x05,
-    0x73, 0x65, 0x76, 0x6F, 0x02, 0x4D, 0x0E, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0xAD, 0x00,
-    0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0xAD, 0x00,
-    0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00,
-    0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xD1, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x66, 0x70, 0x73, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x05, 0x5F, 0x45, 0x4E, 0x56,
-    0x02, 0x4D, 0x00, 0xD3, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x22, 0x00,
-    0x00, 0x00, 0x1E, 0x80, 0x02, 0x80, 0x86, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x06, 0x41,
-    0x40, 0x01, 0xA4, 0xC0, 0x80, 0x01, 0xE2, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0xE6, 0x00,
-    0x00, 0x01, 0x06, 0x81, 0x40, 0x00, 0x07, 0xC1, 0x40, 0x02, 0x24, 0x41, 0x80, 0x00, 0x1E, 0x80,
-    0xFC, 0x7F, 0x81, 0x00, 0x01, 0x00, 0xA6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x04, 0x07, 0x78, 0x70, 0x63, 0x61, 0x6C, 0x6C, 0x04, 0x0E, 0x65, 0x72, 0x72, 0x6F,
-    0x72, 0x5F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75,
-    0x74, 0x69, 0x6E, 0x65, 0x04, 0x06, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x13, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1A, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0xC0, 0x00, 0x86, 0x80, 0x40, 0x01, 0x24, 0xC0,
-    0x80, 0x01, 0x62, 0x40, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0x81, 0xC0, 0x00, 0x00, 0xA6, 0x00,
-    0x00, 0x01, 0x86, 0x00, 0x40, 0x00, 0xC6, 0x00, 0xC1, 0x00, 0x06, 0x81, 0x40, 0x01, 0xA4, 0xC0,
-    0x80, 0x01, 0xE2, 0x40, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0x01, 0xC1, 0x00, 0x00, 0x26, 0x01,
-    0x00, 0x01, 0x06, 0x01, 0x40, 0x00, 0x46, 0x41, 0xC1, 0x00, 0x86, 0x81, 0x40, 0x01, 0x24, 0xC1,
-    0x80, 0x01, 0x22, 0x41, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0x81, 0xC1, 0x00, 0x00, 0xA6, 0x01,
-    0x00, 0x01, 0x49, 0x01, 0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07,
-    0x78, 0x70, 0x63, 0x61, 0x6C, 0x6C, 0x04, 0x05, 0x62, 0x6F, 0x6F, 0x74, 0x04, 0x0E, 0x65, 0x72,
-    0x72, 0x6F, 0x72, 0x5F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x13, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x69, 0x6E, 0x69, 0x74, 0x04, 0x04, 0x72, 0x75, 0x6E, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD7,
-    0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0xD8,
-    0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0xDA,
-    0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xDB,
-    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xDD,
-    0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02,
-    0x5F, 0x04, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x09, 0x69, 0x73, 0x62, 0x6F, 0x6F, 0x74,
-    0x65, 0x64, 0x04, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x02, 0x5F, 0x0C, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x09, 0x69, 0x73, 0x69, 0x6E, 0x69, 0x74, 0x65, 0x64, 0x0C, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x14, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x05, 0x6D, 0x61, 0x69, 0x6E, 0x14, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x02,
-    0x4D, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x13, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0xE1, 0x00,
-    0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, 0xE6, 0x00,
-    0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0xE7, 0x00,
-    0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0xE8, 0x00,
-    0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0xEB, 0x00,
-    0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x01,
-    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0A, 0x65, 0x61, 0x72, 0x6C, 0x79, 0x69, 0x6E, 0x69,
-    0x74, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x5F, 0x09, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6C, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x05, 0x73, 0x65, 0x76, 0x6F,
-    0x02, 0x4D, 0x11, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0xAA, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0xEC, 0x00,
-    0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x73,
-    0x65, 0x76, 0x6F, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x04, 0x00, 0x00,
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56,
+    0x05, 0x80, 0x04, 0x80, 0x05, 0x24, 0x43, 0x80, 0x03, 0xA9, 0xC0, 0x01, 0x00, 0x2A, 0xC1, 0xF2,
+    0x7F, 0x86, 0x00, 0xC0, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x01, 0x80, 0x86, 0x00, 0xC0,
+    0x00, 0xC5, 0x00, 0x00, 0x00, 0xCC, 0x00, 0xC1, 0x01, 0xE4, 0x00, 0x00, 0x01, 0xA4, 0x40, 0x00,
+    0x00, 0x86, 0xC0, 0xC1, 0x00, 0x87, 0x00, 0x44, 0x01, 0xA4, 0x80, 0x80, 0x00, 0x20, 0x80, 0x00,
+    0x87, 0x1E, 0x00, 0x06, 0x80, 0x86, 0x40, 0x42, 0x01, 0x87, 0x40, 0x44, 0x01, 0x8D, 0x80, 0x00,
+    0x00, 0xC6, 0x40, 0xC0, 0x00, 0xC7, 0x80, 0xC0, 0x01, 0xE4, 0x80, 0x80, 0x00, 0x06, 0xC1, 0xC1,
+    0x00, 0x07, 0x41, 0x43, 0x02, 0x46, 0x81, 0xC4, 0x01, 0x47, 0xC1, 0xC4, 0x02, 0x8E, 0xC1, 0x00,
+    0x01, 0xC1, 0x81, 0x03, 0x00, 0x64, 0x01, 0x80, 0x01, 0x24, 0x41, 0x00, 0x00, 0x06, 0x41, 0xC0,
+    0x00, 0x07, 0x81, 0x40, 0x02, 0x24, 0x81, 0x80, 0x00, 0xC0, 0x00, 0x00, 0x02, 0x61, 0xC0, 0x00,
+    0x01, 0x1E, 0x00, 0x01, 0x80, 0x06, 0xC1, 0xC1, 0x00, 0x07, 0x01, 0x44, 0x02, 0x24, 0x81, 0x80,
+    0x00, 0x1F, 0x80, 0x43, 0x02, 0x1E, 0x00, 0xFB, 0x7F, 0x85, 0x00, 0x00, 0x00, 0x8C, 0x40, 0x43,
+    0x01, 0xA4, 0x40, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x07, 0x75,
+    0x70, 0x64, 0x61, 0x74, 0x65, 0x04, 0x05, 0x74, 0x69, 0x6D, 0x65, 0x04, 0x09, 0x6D, 0x69, 0x6C,
+    0x6C, 0x69, 0x73, 0x65, 0x63, 0x04, 0x0A, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x65, 0x72,
+    0x04, 0x06, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x04, 0x06, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x04, 0x05,
+    0x70, 0x75, 0x6D, 0x70, 0x04, 0x05, 0x70, 0x6F, 0x6C, 0x6C, 0x04, 0x05, 0x71, 0x75, 0x69, 0x74,
+    0x04, 0x05, 0x63, 0x6F, 0x6E, 0x66, 0x04, 0x0A, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x71, 0x75, 0x69,
+    0x74, 0x04, 0x05, 0x77, 0x61, 0x72, 0x6E, 0x14, 0x33, 0x53, 0x6F, 0x6D, 0x65, 0x20, 0x70, 0x72,
+    0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x61, 0x6C, 0x69, 0x76,
+    0x65, 0x64, 0x2C, 0x20, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x69, 0x6E, 0x67, 0x2E, 0x04, 0x05, 0x77, 0x61, 0x69,
+    0x74, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x68, 0x61, 0x6E, 0x64,
+    0x6C, 0x65, 0x72, 0x73, 0x04, 0x06, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x04, 0x05, 0x74, 0x69, 0x63,
+    0x6B, 0x04, 0x05, 0x6D, 0x61, 0x74, 0x68, 0x04, 0x04, 0x6D, 0x61, 0x78, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+    0xB4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00,
+    0xB6, 0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00,
+    0xB7, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
+    0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
+    0xB8, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
+    0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
+    0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
+    0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00,
+    0xC1, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00,
+    0xC2, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00,
+    0xC4, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00,
+    0xC6, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00,
+    0xC6, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00,
+    0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00,
+    0xC8, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00,
+    0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00,
+    0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00,
+    0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00,
+    0xCE, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00,
+    0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00,
+    0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00,
+    0xD6, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00,
+    0xD7, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00,
+    0xD8, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00,
+    0xDB, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00,
+    0xDB, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00,
+    0xDC, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00,
+    0xDD, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00,
+    0xDD, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE1, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x61, 0x72, 0x74, 0x06, 0x00,
+    0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x06, 0x61, 0x6C, 0x69, 0x76, 0x65, 0x0B, 0x00, 0x00, 0x00,
+    0x79, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61,
+    0x74, 0x6F, 0x72, 0x29, 0x1A, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F,
+    0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x1A, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00,
+    0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x1A, 0x00,
+    0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x1B, 0x00, 0x00, 0x00, 0x4D,
+    0x00, 0x00, 0x00, 0x02, 0x61, 0x1B, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x02, 0x62, 0x1B,
+    0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x02, 0x63, 0x1B, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00,
+    0x00, 0x02, 0x64, 0x1B, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x02, 0x65, 0x1B, 0x00, 0x00,
+    0x00, 0x4D, 0x00, 0x00, 0x00, 0x02, 0x66, 0x1B, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x09,
+    0x64, 0x65, 0x61, 0x64, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00,
+    0x04, 0x6E, 0x6F, 0x77, 0x62, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x04, 0x66, 0x70, 0x73, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56,
+    0x0E, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00,
+    0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x00, 0x00,
+    0xB1, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x00, 0x00,
+    0xE1, 0x00, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x04, 0x66, 0x70, 0x73, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x05, 0x73, 0x65, 0x76, 0x6F, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x02, 0x4D, 0x00, 0xE4, 0x00, 0x00,
+    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x02, 0x80,
+    0x86, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x06, 0x41, 0x40, 0x01, 0xA4, 0xC0, 0x80, 0x01,
+    0xE2, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0xE6, 0x00, 0x00, 0x01, 0x06, 0x81, 0x40, 0x00,
+    0x07, 0xC1, 0x40, 0x02, 0x24, 0x41, 0x80, 0x00, 0x1E, 0x80, 0xFC, 0x7F, 0x81, 0x00, 0x01, 0x00,
+    0xA6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x07, 0x78, 0x70,
+    0x63, 0x61, 0x6C, 0x6C, 0x04, 0x0E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x68, 0x61, 0x6E, 0x64,
+    0x6C, 0x65, 0x72, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x04, 0x06,
+    0x79, 0x69, 0x65, 0x6C, 0x64, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1A, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00,
+    0x46, 0x40, 0xC0, 0x00, 0x86, 0x80, 0x40, 0x01, 0x24, 0xC0, 0x80, 0x01, 0x62, 0x40, 0x00, 0x00,
+    0x1E, 0x40, 0x00, 0x80, 0x81, 0xC0, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x01, 0x86, 0x00, 0x40, 0x00,
+    0xC6, 0x00, 0xC1, 0x00, 0x06, 0x81, 0x40, 0x01, 0xA4, 0xC0, 0x80, 0x01, 0xE2, 0x40, 0x00, 0x00,
+    0x1E, 0x40, 0x00, 0x80, 0x01, 0xC1, 0x00, 0x00, 0x26, 0x01, 0x00, 0x01, 0x06, 0x01, 0x40, 0x00,
+    0x46, 0x41, 0xC1, 0x00, 0x86, 0x81, 0x40, 0x01, 0x24, 0xC1, 0x80, 0x01, 0x22, 0x41, 0x00, 0x00,
+    0x1E, 0x40, 0x00, 0x80, 0x81, 0xC1, 0x00, 0x00, 0xA6, 0x01, 0x00, 0x01, 0x49, 0x01, 0x80, 0x01,
+    0x26, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 0x78, 0x70, 0x63, 0x61, 0x6C, 0x6C,
+    0x04, 0x05, 0x62, 0x6F, 0x6F, 0x74, 0x04, 0x0E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x68, 0x61,
+    0x6E, 0x64, 0x6C, 0x65, 0x72, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05,
+    0x69, 0x6E, 0x69, 0x74, 0x04, 0x04, 0x72, 0x75, 0x6E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00,
+    0x00, 0xE8, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00,
+    0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00,
+    0x00, 0xEB, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00,
+    0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00,
+    0x00, 0xEE, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00,
+    0x00, 0xEF, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x5F, 0x04, 0x00, 0x00, 0x00, 0x1A,
+    0x00, 0x00, 0x00, 0x09, 0x69, 0x73, 0x62, 0x6F, 0x6F, 0x74, 0x65, 0x64, 0x04, 0x00, 0x00, 0x00,
+    0x1A, 0x00, 0x00, 0x00, 0x02, 0x5F, 0x0C, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x09, 0x69,
+    0x73, 0x69, 0x6E, 0x69, 0x74, 0x65, 0x64, 0x0C, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x07,
+    0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x14, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x05, 0x6D,
+    0x61, 0x69, 0x6E, 0x14, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
+    0x5F, 0x45, 0x4E, 0x56, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x02, 0x4D, 0x05, 0x66, 0x75, 0x6E, 0x63,
+    0x13, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
+    0xF6, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00,
+    0xF7, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00,
+    0x00, 0x0A, 0x65, 0x61, 0x72, 0x6C, 0x79, 0x69, 0x6E, 0x69, 0x74, 0x02, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x02, 0x5F, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65,
+    0x74, 0x76, 0x61, 0x6C, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x05, 0x5F, 0x45, 0x4E, 0x56, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x02, 0x4D, 0x11, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
+    0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+    0x3A, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
+    0xE2, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x03, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56,
 };
 
 #endif
@@ -5,59 +5,119 @@ static const unsigned char parallel_lua[] = {
     0x1B, 0x4C, 0x75, 0x61, 0x53, 0x00, 0x19, 0x93, 0x0D, 0x0A, 0x1A, 0x0A, 0x04, 0x08, 0x04, 0x08,
     0x08, 0x78, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x77,
     0x40, 0x01, 0x0E, 0x40, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x2E, 0x6C, 0x75, 0x61,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x08, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x06,
     0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x00, 0x24, 0x80, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x81, 0x6C, 0x40, 0x00, 0x00, 0x66, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x04, 0x08, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x04, 0x05, 0x73, 0x65,
-    0x76, 0x6F, 0x04, 0x09, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x01, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x00, 0x24, 0x40,
-    0x00, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x80, 0x00, 0x00, 0x24, 0x40, 0x00, 0x01, 0x06, 0x00,
-    0x40, 0x00, 0x41, 0xC0, 0x00, 0x00, 0x24, 0x40, 0x00, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x00,
-    0x01, 0x00, 0x24, 0x40, 0x00, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x01, 0x00, 0x24, 0x40,
-    0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x08, 0x72, 0x65, 0x71, 0x75,
-    0x69, 0x72, 0x65, 0x04, 0x09, 0x73, 0x65, 0x76, 0x6F, 0x2E, 0x69, 0x6E, 0x74, 0x04, 0x0C, 0x73,
-    0x65, 0x76, 0x6F, 0x2E, 0x6C, 0x6F, 0x67, 0x67, 0x65, 0x72, 0x04, 0x09, 0x73, 0x65, 0x76, 0x6F,
-    0x2E, 0x76, 0x66, 0x73, 0x04, 0x0C, 0x73, 0x65, 0x76, 0x6F, 0x2E, 0x74, 0x68, 0x72, 0x65, 0x61,
-    0x64, 0x04, 0x0A, 0x73, 0x65, 0x76, 0x6F, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00,
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x14, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x22, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x24, 0x40, 0x80, 0x00, 0x06,
-    0x40, 0x40, 0x00, 0x07, 0x80, 0x40, 0x00, 0x24, 0xC0, 0x80, 0x00, 0x62, 0x40, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x80, 0x41, 0xC0, 0x00, 0x00, 0x83, 0x00, 0x80, 0x00, 0xC6, 0x00, 0x41, 0x00, 0xC7,
-    0x40, 0xC1, 0x01, 0x12, 0x41, 0x00, 0x83, 0xE4, 0x80, 0x00, 0x01, 0xA2, 0x00, 0x00, 0x00, 0x1E,
-    0x40, 0x04, 0x80, 0x0C, 0xC1, 0xC1, 0x01, 0x24, 0x41, 0x00, 0x01, 0x06, 0x01, 0x42, 0x00, 0x4C,
-    0x41, 0xC2, 0x01, 0x64, 0x01, 0x00, 0x01, 0x24, 0x81, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0xA2,
-    0x00, 0x00, 0x00, 0x1E, 0x40, 0x01, 0x80, 0x22, 0x00, 0x00, 0x00, 0x1E, 0xC0, 0x00, 0x80, 0x00,
-    0x01, 0x00, 0x00, 0x4C, 0x41, 0xC2, 0x01, 0x64, 0x01, 0x00, 0x01, 0x24, 0x41, 0x00, 0x00, 0x0C,
-    0x81, 0xC2, 0x01, 0x24, 0x41, 0x00, 0x01, 0x1E, 0xC0, 0xFA, 0x7F, 0x26, 0x00, 0x80, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x04, 0x09, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x04, 0x07, 0x74,
-    0x68, 0x72, 0x65, 0x61, 0x64, 0x04, 0x04, 0x72, 0x75, 0x6E, 0x13, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x05, 0x74, 0x69, 0x6D, 0x65, 0x04, 0x04, 0x66, 0x70, 0x73, 0x13, 0xE8,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x04,
-    0x0A, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x65, 0x72, 0x04, 0x06, 0x64, 0x65, 0x6C, 0x74,
-    0x61, 0x04, 0x05, 0x77, 0x61, 0x69, 0x74, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x22, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
-    0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00,
-    0x00, 0x1B, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
-    0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x05, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x05, 0x74,
-    0x69, 0x63, 0x6B, 0x05, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x06, 0x61, 0x6C, 0x69, 0x76,
-    0x65, 0x09, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x04, 0x66, 0x70, 0x73, 0x0D, 0x00, 0x00,
-    0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x08, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x12, 0x00,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x03, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56,
+    0x40, 0x00, 0x81, 0x41, 0xC0, 0x00, 0x00, 0xAC, 0x40, 0x00, 0x00, 0xEC, 0x80, 0x00, 0x00, 0xE6,
+    0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x08, 0x72, 0x65, 0x71,
+    0x75, 0x69, 0x72, 0x65, 0x04, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x04, 0x09, 0x70, 0x61, 0x72, 0x61,
+    0x6C, 0x6C, 0x65, 0x6C, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x00, 0x24,
+    0x40, 0x00, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x80, 0x00, 0x00, 0x24, 0x40, 0x00, 0x01, 0x06,
+    0x00, 0x40, 0x00, 0x41, 0xC0, 0x00, 0x00, 0x24, 0x40, 0x00, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41,
+    0x00, 0x01, 0x00, 0x24, 0x40, 0x00, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x01, 0x00, 0x24,
+    0x40, 0x00, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x80, 0x01, 0x00, 0x24, 0x40, 0x00, 0x01, 0x26,
+    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x08, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+    0x04, 0x09, 0x73, 0x65, 0x76, 0x6F, 0x2E, 0x69, 0x6E, 0x74, 0x04, 0x0C, 0x73, 0x65, 0x76, 0x6F,
+    0x2E, 0x6C, 0x6F, 0x67, 0x67, 0x65, 0x72, 0x04, 0x09, 0x73, 0x65, 0x76, 0x6F, 0x2E, 0x76, 0x66,
+    0x73, 0x04, 0x0C, 0x73, 0x65, 0x76, 0x6F, 0x2E, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x04, 0x0C,
+    0x73, 0x65, 0x76, 0x6F, 0x2E, 0x77, 0x6F, 0x72, 0x6B, 0x65, 0x72, 0x04, 0x0A, 0x73, 0x65, 0x76,
+    0x6F, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+    0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x1B, 0x00,
+    0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0B, 0x3D, 0x00, 0x00, 0x00, 0x83, 0x00, 0x80,
+    0x00, 0xC6, 0x00, 0x40, 0x00, 0xC7, 0x40, 0xC0, 0x01, 0xE4, 0x80, 0x80, 0x00, 0xA2, 0x00, 0x00,
+    0x00, 0x1E, 0x40, 0x0D, 0x80, 0x06, 0x01, 0x40, 0x00, 0x07, 0x41, 0x40, 0x02, 0x24, 0x81, 0x80,
+    0x00, 0x4E, 0xC1, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x02, 0x86, 0x81, 0x40, 0x00, 0xC0, 0x01, 0x80,
+    0x02, 0xA4, 0x81, 0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0x86, 0x01, 0x40, 0x00, 0x87, 0xC1, 0x40,
+    0x03, 0xC0, 0x01, 0x80, 0x02, 0xA4, 0x41, 0x00, 0x01, 0xA2, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x01,
+    0x80, 0x22, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x80,
+    0x02, 0xA4, 0x41, 0x00, 0x01, 0xA2, 0x00, 0x00, 0x00, 0x1E, 0xC0, 0xF9, 0x7F, 0x86, 0x01, 0x41,
+    0x00, 0xA4, 0x81, 0x80, 0x00, 0xC6, 0x01, 0x40, 0x00, 0xC7, 0x41, 0xC1, 0x03, 0xE4, 0x81, 0x80,
+    0x00, 0xE2, 0x01, 0x00, 0x00, 0x1E, 0x00, 0x01, 0x80, 0xA2, 0x01, 0x00, 0x00, 0x1E, 0x40, 0x00,
+    0x80, 0x20, 0x80, 0x81, 0x03, 0x1E, 0x00, 0x00, 0x80, 0x80, 0x01, 0x80, 0x03, 0x62, 0x00, 0x00,
+    0x00, 0x1E, 0x80, 0x02, 0x80, 0x06, 0x82, 0x41, 0x00, 0x07, 0xC2, 0x41, 0x04, 0x24, 0x82, 0x80,
+    0x00, 0x22, 0x42, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x7F, 0x0C, 0xC2, 0xC0, 0x00, 0xA3, 0x42, 0x00,
+    0x03, 0x1E, 0x00, 0x00, 0x80, 0x85, 0x02, 0x80, 0x00, 0x24, 0x42, 0x80, 0x01, 0x1E, 0x80, 0xF3,
+    0x7F, 0x5F, 0x00, 0x42, 0x03, 0x1E, 0x00, 0xF3, 0x7F, 0x06, 0x82, 0x41, 0x00, 0x07, 0x42, 0x42,
+    0x04, 0x40, 0x02, 0x00, 0x03, 0x24, 0x42, 0x00, 0x01, 0x1E, 0xC0, 0xF1, 0x7F, 0x26, 0x00, 0x80,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x05, 0x74, 0x69, 0x6D, 0x65, 0x04, 0x09, 0x6D, 0x69, 0x6C,
+    0x6C, 0x69, 0x73, 0x65, 0x63, 0x04, 0x0A, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x65, 0x72,
+    0x04, 0x07, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x04, 0x05, 0x69, 0x64, 0x6C, 0x65, 0x04, 0x05,
+    0x6E, 0x65, 0x78, 0x74, 0x04, 0x07, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x04, 0x09, 0x72, 0x65,
+    0x61, 0x64, 0x61, 0x62, 0x6C, 0x65, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x05, 0x77, 0x61, 0x69, 0x74, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
+    0x00, 0x1D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00,
+    0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+    0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x28, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00,
+    0x00, 0x2A, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x2B, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x2B, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00,
+    0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+    0x00, 0x34, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75,
+    0x6E, 0x63, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x04, 0x6E, 0x65, 0x74, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x06, 0x61, 0x6C, 0x69, 0x76, 0x65, 0x01, 0x00, 0x00, 0x00,
+    0x3D, 0x00, 0x00, 0x00, 0x05, 0x6C, 0x61, 0x73, 0x74, 0x04, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
+    0x00, 0x04, 0x6E, 0x6F, 0x77, 0x09, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x06, 0x64, 0x65,
+    0x6C, 0x74, 0x61, 0x0A, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x08, 0x74, 0x69, 0x6D, 0x65,
+    0x6F, 0x75, 0x74, 0x1E, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x06, 0x74, 0x69, 0x6D, 0x65,
+    0x72, 0x21, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x73, 0x65,
+    0x76, 0x6F, 0x08, 0x46, 0x4F, 0x52, 0x45, 0x56, 0x45, 0x52, 0x00, 0x38, 0x00, 0x00, 0x00, 0x4A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x24, 0x40,
+    0x80, 0x00, 0x06, 0x40, 0x40, 0x00, 0x07, 0x80, 0x40, 0x00, 0x24, 0x00, 0x81, 0x00, 0x62, 0x40,
+    0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x41, 0xC0, 0x00, 0x00, 0x21, 0x00, 0xC1, 0x00, 0x1E, 0x00,
+    0x01, 0x80, 0xC5, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x01, 0xE5, 0x00,
+    0x80, 0x01, 0xE6, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x80, 0x00, 0x06, 0x41, 0x41, 0x00, 0x07, 0x81,
+    0x41, 0x02, 0x52, 0x41, 0x80, 0x83, 0x24, 0x81, 0x00, 0x01, 0xE2, 0x00, 0x00, 0x00, 0x1E, 0x80,
+    0x05, 0x80, 0x4C, 0x01, 0x42, 0x02, 0x64, 0x41, 0x00, 0x01, 0x46, 0x41, 0x42, 0x00, 0x8C, 0x81,
+    0x42, 0x02, 0xA4, 0x01, 0x00, 0x01, 0x64, 0x81, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x02, 0x46, 0x41,
+    0x41, 0x00, 0x47, 0x01, 0xC2, 0x02, 0x8C, 0x81, 0x42, 0x02, 0xA4, 0x01, 0x00, 0x01, 0x64, 0x41,
+    0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x01, 0x80, 0x22, 0x00, 0x00, 0x00, 0x1E, 0xC0,
+    0x00, 0x80, 0x40, 0x01, 0x00, 0x00, 0x8C, 0x81, 0x42, 0x02, 0xA4, 0x01, 0x00, 0x01, 0x64, 0x41,
+    0x00, 0x00, 0x4C, 0xC1, 0x42, 0x02, 0x64, 0x41, 0x00, 0x01, 0x1E, 0x80, 0xF9, 0x7F, 0x26, 0x00,
+    0x80, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x04, 0x09, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C,
+    0x04, 0x07, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x04, 0x04, 0x72, 0x75, 0x6E, 0x13, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x05, 0x74, 0x69, 0x6D, 0x65, 0x04, 0x04, 0x66, 0x70, 0x73, 0x13, 0xE8, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x07, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x04, 0x0A, 0x73, 0x63, 0x68,
+    0x65, 0x64, 0x75, 0x6C, 0x65, 0x72, 0x04, 0x06, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x04, 0x05, 0x77,
+    0x61, 0x69, 0x74, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x2E,
+    0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x3B,
+    0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E,
+    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44,
+    0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x45,
+    0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46,
+    0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48,
+    0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05,
+    0x66, 0x75, 0x6E, 0x63, 0x05, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x05, 0x74, 0x69, 0x63,
+    0x6B, 0x05, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x04, 0x6E, 0x65, 0x74, 0x05, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x06, 0x61, 0x6C, 0x69, 0x76, 0x65, 0x10, 0x00, 0x00, 0x00, 0x2E,
+    0x00, 0x00, 0x00, 0x04, 0x66, 0x70, 0x73, 0x14, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x08, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x65, 0x64,
+    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+    0x4A, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x05, 0x73, 0x65, 0x76, 0x6F, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x08, 0x46, 0x4F,
+    0x52, 0x45, 0x56, 0x45, 0x52, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x08, 0x65, 0x76,
+    0x65, 0x6E, 0x74, 0x65, 0x64, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56,
 };
 
 #endif
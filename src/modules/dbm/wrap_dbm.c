@@ -8,139 +8,1585 @@
  */
 
 #include "wrap_dbm.h"
+#include "modules/gmp/wrap_gmp.h"
 #include "common/logger.h"
+#include "common/atomic.h"
 #include "common/vfs.h"
 #include <lmdb.h>
 #include <string.h>
 
-typedef struct dbm_t {
+/* Named tables an env holds unless told otherwise */
+#define DBM_MAXDBS      16
+
+/*
+ * Reader slots per worker unless told otherwise. Every handle and
+ * table() keeps one for its reset read txn, snapshots and cursors
+ * take one each, and each worker state opens its own handles.
+ */
+#define DBM_WORKER_READERS  64
+
+/* Times one write retries after growing a full map */
+#define DBM_GROW_TRIES  8
+
+/* Pairs a scan reads per read transaction */
+#define DBM_SCAN_BATCH  256
+
+/* Slots of the scan uservalue table */
+#define SCAN_FROM       1
+#define SCAN_TO         2
+#define SCAN_PREFIX     3
+#define SCAN_LASTK      4
+#define SCAN_LASTV      5
+#define SCAN_BUF        6   /* key, value, key, value, ... */
+
+typedef struct dbm_txn_t dbm_txn_t;
+typedef struct dbm_t dbm_t;
+
+/* Write waiting in the env queue, lives on the stack of its caller. */
+typedef struct dbm_op_t {
+    struct dbm_op_t *next;
+    MDB_dbi     dbi;
+    int         del;
+    int         count;
+    MDB_val     *pairs;     /* key, value, ... a del without value drops the key */
+    int         result;
+    int         skip;   /* failed on its own, left out of the batch */
+    int         done;
+} dbm_op_t;
+
+/*
+ * Env of one path, shared by every state of the process that opens it
+ * and closed with the last handle. Reads count themselves in active,
+ * the map is only resized once it drops to zero.
+ */
+typedef struct dbm_env_t {
+    struct dbm_env_t *next;
     MDB_env     *env;
+    MDB_dbi     dbi;    /* the unnamed table */
+    volatile int refs;  /* drops to zero under g_dbm_mutex */
+    volatile int active;    /* transactions in flight */
+    volatile int pinned;    /* of those, held by cursors, snapshots and begin() */
+    volatile int growing;
+    volatile int writer;    /* thread of the begin() transaction */
+    dbm_op_t    *head;  /* write queue, the head op commits the batch */
+    dbm_op_t    *tail;
+    mc_mutex_t  lock;
+    mc_cond_t   cond;   /* resize finished or readers gone */
+    mc_cond_t   queue;  /* ops done or a new head */
+    char        path[MC_MAX_PATH];
+} dbm_env_t;
+
+/* The dbm itself or one of its named tables. */
+struct dbm_t {
+    dbm_env_t   *e;
     MDB_dbi     dbi;
-} dbm_t;
+    unsigned int flags;
+    MDB_txn     *rtxn;  /* reset read txn, renewed by each read */
+    dbm_txn_t   *txn;   /* open write transaction of this handle */
+};
+
+/* Write transaction, its uservalue keeps the dbm alive. */
+struct dbm_txn_t {
+    MDB_txn     *txn;
+    dbm_t       *dbm;
+    int         full;   /* a write filled the map */
+};
+
+/* Cursor over one snapshot, holds the env until closed. */
+typedef struct dbm_cursor_t {
+    dbm_env_t   *e;
+    unsigned int flags;
+    MDB_txn     *txn;
+    MDB_cursor  *cur;
+} dbm_cursor_t;
+
+/*
+ * Range scan reading a batch per transaction. The transaction is
+ * aborted once its batch is copied out, so an unfinished scan holds
+ * neither a snapshot nor a reader slot.
+ */
+typedef struct dbm_scan_t {
+    dbm_env_t   *e;
+    MDB_dbi     dbi;
+    unsigned int flags;
+    lua_Integer limit;
+    lua_Integer count;
+    int         batch;
+    int         pos;
+    int         size;
+} dbm_scan_t;
+
+/* Read snapshot kept across calls, reset and renewed in place. */
+typedef struct dbm_snap_t {
+    dbm_env_t   *e;
+    MDB_dbi     dbi;
+    unsigned int flags;
+    MDB_txn     *txn;
+    int         active;
+    unsigned int gen;   /* bumped whenever views go stale */
+} dbm_snap_t;
+
+/* Bytes in the map, valid while their snapshot generation lives. */
+typedef struct dbm_view_t {
+    dbm_snap_t  *snap;
+    const char  *data;
+    size_t      len;
+    unsigned int gen;
+} dbm_view_t;
+
+/* Options of a new env. */
+typedef struct dbm_opts_t {
+    size_t      mapsize;    /* 0 keeps the default */
+    MDB_dbi     maxdbs;
+    unsigned int maxreaders;
+    unsigned int flags;
+} dbm_opts_t;
+
+/*
+ * Open envs by path, lmdb must not open one twice in a process. The
+ * mutex is held across env open and close, which can wait on the disk;
+ * the spin lock only guards making the mutex.
+ */
+static dbm_env_t *g_dbm_envs = NULL;
+static mc_mutex_t g_dbm_mutex;
+static int g_dbm_ready = 0;
+static int g_dbm_lock = 0;
+
+static const char g_meta_dbm[] = { CODE_NAME ".meta.dbm" };
+static const char g_meta_txn[] = { CODE_NAME ".meta.txn" };
+static const char g_meta_cursor[] = { CODE_NAME ".meta.cursor" };
+static const char g_meta_scan[] = { CODE_NAME ".meta.scan" };
+static const char g_meta_snap[] = { CODE_NAME ".meta.snapshot" };
+static const char g_meta_view[] = { CODE_NAME ".meta.view" };
+
+static const char *g_dbm_syncs[] = { "full", "meta", "none", NULL };
+
+static int MDB_CHECK(int errcode) {
+    if (MDB_SUCCESS != errcode) {
+        LG_ERR("mdb error: %s", mdb_strerror(errcode));
+        return -1;
+    }
+    return 0;
+}
+
+static dbm_t *luaX_checkdbm(lua_State * L, int idx) {
+    dbm_t *dbm = (dbm_t *)luaL_checkudata(L, idx, g_meta_dbm);
+
+    if (!dbm->e) {
+        luaL_error(L, "dbm is closed.");
+    }
+    return dbm;
+}
+
+/* Counts a transaction in, waiting out a resize of the map. */
+static void dbm_enter(dbm_env_t *e, int pin) {
+    if (pin) {
+        atomic_add_int(&e->pinned, 1);
+    }
+
+    for (;;) {
+        atomic_add_int(&e->active, 1);
+
+        if (!atomic_load_int(&e->growing)) {
+            return;
+        }
+
+        if (1 == atomic_add_int(&e->active, -1)) {
+            mc_mutex_lock(&e->lock);
+            mc_cond_broadcast(&e->cond);
+            mc_mutex_unlock(&e->lock);
+        }
+
+        mc_mutex_lock(&e->lock);
+        while (atomic_load_int(&e->growing)) {
+            mc_cond_wait(&e->cond, &e->lock);
+        }
+        mc_mutex_unlock(&e->lock);
+    }
+}
+
+static void dbm_leave(dbm_env_t *e, int pin) {
+    if (pin) {
+        atomic_add_int(&e->pinned, -1);
+    }
+
+    /* The last one out wakes a pending resize */
+    if (1 == atomic_add_int(&e->active, -1) && atomic_load_int(&e->growing)) {
+        mc_mutex_lock(&e->lock);
+        mc_cond_broadcast(&e->cond);
+        mc_mutex_unlock(&e->lock);
+    }
+}
+
+/*
+ * Sets the map size once no transaction of the process is open, 0
+ * adopts the size another process grew it to. Pinned transactions
+ * would lose their pages, so they fail it instead of being waited on.
+ */
+static int dbm_resize(dbm_env_t *e, size_t size) {
+    int retval = -1;
+
+    mc_mutex_lock(&e->lock);
+
+    /* Another thread is at it, its size will do */
+    if (atomic_load_int(&e->growing)) {
+        while (atomic_load_int(&e->growing)) {
+            mc_cond_wait(&e->cond, &e->lock);
+        }
+        mc_mutex_unlock(&e->lock);
+        return 0;
+    }
+
+    atomic_store_int(&e->growing, 1);
+
+    if (atomic_load_int(&e->pinned) > 0) {
+        LG_WRN("dbm map can't resize, open cursors or snapshots pin it");
+    } else {
+        while (atomic_load_int(&e->active) > 0) {
+            mc_cond_wait(&e->cond, &e->lock);
+        }
+        retval = MDB_CHECK(mdb_env_set_mapsize(e->env, size));
+    }
+
+    atomic_store_int(&e->growing, 0);
+    mc_cond_broadcast(&e->cond);
+    mc_mutex_unlock(&e->lock);
+
+    return retval;
+}
+
+/* Doubles the map. */
+static int dbm_grow(dbm_env_t *e) {
+    MDB_envinfo info;
+    size_t size;
+
+    if (MDB_CHECK(mdb_env_info(e->env, &info))) {
+        return -1;
+    }
+
+    size = info.me_mapsize * 2;
+    LG_INF("dbm map grows to %llu bytes", (unsigned long long)size);
+
+    return dbm_resize(e, size);
+}
+
+static int dbm_txn_open(dbm_env_t *e, unsigned int flags, MDB_txn **txn) {
+    if (*txn) {
+        return mdb_txn_renew(*txn);
+    }
+    return mdb_txn_begin(e->env, NULL, flags, txn);
+}
+
+/*
+ * Begins a counted transaction, or renews *txn when it holds a reset
+ * read handle. Ends with dbm_leave once committed, aborted or reset.
+ */
+static int dbm_txn_begin(dbm_env_t *e, unsigned int flags, int pin, MDB_txn **txn) {
+    int retval;
+
+    dbm_enter(e, pin);
+    retval = dbm_txn_open(e, flags, txn);
+
+    /* Another process grew the map, adopt its size */
+    if (MDB_MAP_RESIZED == retval) {
+        dbm_leave(e, pin);
+        dbm_resize(e, 0);
+        dbm_enter(e, pin);
+        retval = dbm_txn_open(e, flags, txn);
+    }
+
+    if (MDB_SUCCESS != retval) {
+        dbm_leave(e, pin);
+    }
+    return retval;
+}
+
+/* Ends the begin() transaction, growing the map if a write filled it. */
+static int txn_finish(dbm_txn_t *t, int commit) {
+    dbm_env_t *e = t->dbm->e;
+    int retval = MDB_SUCCESS;
+
+    atomic_store_int(&e->writer, 0);
+
+    if (commit) {
+        retval = mdb_txn_commit(t->txn);
+    } else {
+        mdb_txn_abort(t->txn);
+    }
+    dbm_leave(e, 1);
+
+    if (MDB_MAP_FULL == retval || t->full) {
+        dbm_grow(e);
+    }
+
+    t->dbm->txn = NULL;
+    t->dbm = NULL;
+    t->txn = NULL;
+
+    return retval;
+}
+
+/* The caller holds a ref, so refs cannot reach zero meanwhile. */
+static void dbm_ref(dbm_env_t *e) {
+    atomic_add_int(&e->refs, 1);
+}
+
+static void dbm_env_close(dbm_env_t *e) {
+    mdb_env_sync(e->env, 1);
+    mdb_env_close(e->env);
+    mc_cond_destroy(&e->queue);
+    mc_cond_destroy(&e->cond);
+    mc_mutex_destroy(&e->lock);
+    mc_free(e);
+}
+
+/* Closed under the lock, an open of the same path must wait for it. */
+static void dbm_unref(dbm_env_t *e) {
+    dbm_env_t **pe;
+
+    mc_mutex_lock(&g_dbm_mutex);
+
+    if (1 == atomic_add_int(&e->refs, -1)) {
+        for (pe = &g_dbm_envs; *pe; pe = &(*pe)->next) {
+            if (*pe == e) {
+                *pe = e->next;
+                break;
+            }
+        }
+        dbm_env_close(e);
+    }
+
+    mc_mutex_unlock(&g_dbm_mutex);
+}
+
+/* Drops the handle, the env goes with its last user. */
+static void dbm_release(dbm_t *dbm) {
+    dbm_env_t *e = dbm->e;
+
+    if (!e) {
+        return;
+    }
+
+    /* The env must not close under the transaction */
+    if (dbm->txn) {
+        txn_finish(dbm->txn, 0);
+    }
+
+    if (dbm->rtxn) {
+        mdb_txn_abort(dbm->rtxn);
+        dbm->rtxn = NULL;
+    }
+
+    dbm_unref(e);
+    dbm->e = NULL;
+}
+
+/*
+ * A second write on the thread holding the writer lock would block on
+ * it forever, writes go through the open transaction instead. Other
+ * threads queue behind it.
+ */
+static dbm_t *dbm_checkwrite(lua_State * L, int idx) {
+    dbm_t *dbm = luaX_checkdbm(L, idx);
+
+    if (atomic_load_int(&dbm->e->writer) == mc_thread_id()) {
+        luaL_error(L, "dbm write transaction in progress.");
+    }
+    return dbm;
+}
+
+static dbm_txn_t *luaX_checktxn(lua_State * L, int idx) {
+    dbm_txn_t *t = (dbm_txn_t *)luaL_checkudata(L, idx, g_meta_txn);
+
+    if (!t->txn) {
+        luaL_error(L, "dbm transaction is finished.");
+    }
+    return t;
+}
+
+/*
+ * Reads renew the reset txn of the handle, which keeps its reader slot
+ * in between. err gets the LMDB code when no txn could be had, such as
+ * MDB_READERS_FULL.
+ */
+static MDB_txn *dbm_read(dbm_t *dbm, int *err) {
+    if (MDB_CHECK(*err = dbm_txn_begin(dbm->e, MDB_RDONLY, 0, &dbm->rtxn))) {
+        if (dbm->rtxn) {
+            mdb_txn_abort(dbm->rtxn);
+            dbm->rtxn = NULL;
+        }
+        return NULL;
+    }
+    return dbm->rtxn;
+}
+
+static void dbm_read_end(dbm_t *dbm) {
+    mdb_txn_reset(dbm->rtxn);
+    dbm_leave(dbm->e, 0);
+}
+
+/* Keys of an integerkey table are Lua integers stored as size_t. */
+static void dbm_checkkey(lua_State * L, dbm_t *dbm, int idx, MDB_val *k, size_t *ik) {
+    if (dbm->flags & MDB_INTEGERKEY) {
+        *ik = (size_t)luaL_checkinteger(L, idx);
+        k->mv_size = sizeof(size_t);
+        k->mv_data = ik;
+    } else {
+        k->mv_data = (void *)luaL_checklstring(L, idx, &k->mv_size);
+    }
+}
+
+static void dbm_pushkey(lua_State * L, dbm_t *dbm, const MDB_val *k) {
+    if ((dbm->flags & MDB_INTEGERKEY) && sizeof(size_t) == k->mv_size) {
+        size_t ik;
+        memcpy(&ik, k->mv_data, sizeof(size_t));
+        lua_pushinteger(L, (lua_Integer)ik);
+    } else {
+        lua_pushlstring(L, (const char *)k->mv_data, k->mv_size);
+    }
+}
+
+#define dbm_isvalue(L, idx)     (LUA_TSTRING == lua_type(L, idx) || LUA_TNUMBER == lua_type(L, idx))
+
+static int dbm_apply(MDB_txn *txn, dbm_op_t *op) {
+    int i, retval = MDB_SUCCESS;
+
+    for (i = 0; i < op->count && MDB_SUCCESS == retval; ++i) {
+        MDB_val *kv = op->pairs + 2 * i;
+
+        if (op->del) {
+            retval = mdb_del(txn, op->dbi, kv, kv[1].mv_data ? kv + 1 : NULL);
+        } else {
+            retval = mdb_put(txn, op->dbi, kv, kv + 1, 0);
+        }
+    }
+    return retval;
+}
+
+/*
+ * Commits the ops from first to last in one transaction. A full map
+ * grows and the batch reruns; an op failing on its own is left out
+ * and the rest rerun, so each op is applied whole or not at all.
+ */
+static void dbm_commit(dbm_env_t *e, dbm_op_t *first, dbm_op_t *last) {
+    dbm_op_t *op, *bad;
+    MDB_txn *txn;
+    int retval, tries = 0;
+
+    for (;;) {
+        txn = NULL;
+        bad = NULL;
+        retval = dbm_txn_begin(e, 0, 0, &txn);
+
+        if (MDB_SUCCESS == retval) {
+            for (op = first; ; op = op->next) {
+                if (!op->skip) {
+                    op->result = dbm_apply(txn, op);
+
+                    /* A missing key leaves the txn usable */
+                    if (MDB_SUCCESS != op->result && !(op->del && MDB_NOTFOUND == op->result)) {
+                        bad = op;
+                        break;
+                    }
+                }
+
+                if (op == last) {
+                    break;
+                }
+            }
+
+            if (bad) {
+                retval = bad->result;
+                mdb_txn_abort(txn);
+            } else {
+                retval = mdb_txn_commit(txn);
+            }
+            dbm_leave(e, 0);
+        }
+
+        if (MDB_SUCCESS == retval) {
+            return;
+        }
+
+        if (MDB_MAP_FULL == retval && tries++ < DBM_GROW_TRIES && 0 == dbm_grow(e)) {
+            continue;
+        }
+
+        if (bad) {
+            bad->skip = 1;
+            continue;
+        }
+
+        /* Nothing got in */
+        for (op = first; ; op = op->next) {
+            if (!op->skip) {
+                op->result = retval;
+            }
+
+            if (op == last) {
+                break;
+            }
+        }
+        return;
+    }
+}
+
+/*
+ * Single writer per env. Callers of every thread queue their op, the
+ * one at the head commits everything queued so far in one transaction
+ * while the rest wait, then hands the head on.
+ */
+static int dbm_submit(dbm_env_t *e, dbm_op_t *op) {
+    dbm_op_t *last, *next;
+
+    op->next = NULL;
+    op->result = MDB_SUCCESS;
+    op->skip = 0;
+    op->done = 0;
+
+    mc_mutex_lock(&e->lock);
+
+    if (e->tail) {
+        e->tail->next = op;
+    } else {
+        e->head = op;
+    }
+    e->tail = op;
+
+    while (!op->done && e->head != op) {
+        mc_cond_wait(&e->queue, &e->lock);
+    }
+
+    if (op->done) {
+        mc_mutex_unlock(&e->lock);
+        return op->result;
+    }
+
+    last = e->tail;
+    mc_mutex_unlock(&e->lock);
+
+    dbm_commit(e, op, last);
+
+    mc_mutex_lock(&e->lock);
+
+    e->head = last->next;
+    if (!e->head) {
+        e->tail = NULL;
+    }
+
+    for (next = op; next != e->head; next = next->next) {
+        next->done = 1;
+    }
+
+    mc_cond_broadcast(&e->queue);
+    mc_mutex_unlock(&e->lock);
+
+    return op->result;
+}
+
+static int dbm__gc(lua_State * L) {
+    dbm_t *dbm = (dbm_t *)luaL_checkudata(L, 1, g_meta_dbm);
+    dbm_release(dbm);
+    return 0;
+}
+
+static int dbm_close(lua_State * L) {
+    dbm_t *dbm = (dbm_t *)luaL_checkudata(L, 1, g_meta_dbm);
+    dbm_release(dbm);
+    return 0;
+}
+
+static int dbm_sync(lua_State * L) {
+    dbm_t *dbm = luaX_checkdbm(L, 1);
+
+    if (MDB_CHECK(mdb_env_sync(dbm->e->env, 1))) {
+        lua_pushboolean(L, 0);
+        return 1;
+    }
+
+    lua_pushboolean(L, 1);
+    return 1;
+}
+
+static int dbm_del(lua_State * L) {
+    dbm_t *dbm = dbm_checkwrite(L, 1);
+    MDB_val kv[2];
+    dbm_op_t op;
+    size_t ik;
+    int retval;
+
+    dbm_checkkey(L, dbm, 2, &kv[0], &ik);
+
+    /* dupsort tables drop one value when given, else all of the key */
+    kv[1].mv_size = 0;
+    kv[1].mv_data = NULL;
+    if (!lua_isnoneornil(L, 3)) {
+        kv[1].mv_data = (void *)luaL_checklstring(L, 3, &kv[1].mv_size);
+    }
+
+    op.dbi = dbm->dbi;
+    op.del = 1;
+    op.count = 1;
+    op.pairs = kv;
+
+    retval = dbm_submit(dbm->e, &op);
+
+    /* A missing key is not worth a log line */
+    if (MDB_NOTFOUND != retval) {
+        MDB_CHECK(retval);
+    }
+
+    lua_pushboolean(L, MDB_SUCCESS == retval);
+    return 1;
+}
+
+/* nil for a missing key, nil and the error when the read failed. */
+static int dbm_get(lua_State * L) {
+    dbm_t *dbm = luaX_checkdbm(L, 1);
+    MDB_txn* mdb_txn;
+    MDB_val k, v;
+    size_t ik;
+    int retval;
+
+    dbm_checkkey(L, dbm, 2, &k, &ik);
+
+    if (!(mdb_txn = dbm_read(dbm, &retval))) {
+        lua_pushnil(L);
+        lua_pushstring(L, mdb_strerror(retval));
+        return 2;
+    }
+
+    retval = mdb_get(mdb_txn, dbm->dbi, &k, &v);
+
+    if (MDB_SUCCESS == retval) {
+        lua_pushlstring(L, (const char *)v.mv_data, v.mv_size);
+    } else {
+        lua_pushnil(L);
+    }
+    dbm_read_end(dbm);
+
+    if (MDB_SUCCESS != retval && MDB_NOTFOUND != retval) {
+        lua_pushstring(L, mdb_strerror(retval));
+        return 2;
+    }
+    return 1;
+}
+
+static int dbm_put(lua_State * L) {
+    dbm_t *dbm = dbm_checkwrite(L, 1);
+    MDB_val kv[2];
+    dbm_op_t op;
+    size_t ik;
+
+    dbm_checkkey(L, dbm, 2, &kv[0], &ik);
+    kv[1].mv_data = (void *)luaL_checklstring(L, 3, &kv[1].mv_size);
+
+    op.dbi = dbm->dbi;
+    op.del = 0;
+    op.count = 1;
+    op.pairs = kv;
+
+    lua_pushboolean(L, 0 == MDB_CHECK(dbm_submit(dbm->e, &op)));
+    return 1;
+}
+
+/* Writes every pair of the table in one transaction, returns the count. */
+static int dbm_put_many(lua_State * L) {
+    dbm_t *dbm = dbm_checkwrite(L, 1);
+    int integerkey = dbm->flags & MDB_INTEGERKEY;
+    lua_Integer count = 0;
+    MDB_val *kv;
+    size_t *iks;
+    dbm_op_t op;
+    int anchor, anchored = 0, n = 0;
+
+    luaL_checktype(L, 2, LUA_TTABLE);
+
+    lua_pushnil(L);
+    while (lua_next(L, 2)) {
+        int key = integerkey ? lua_isinteger(L, -2) : dbm_isvalue(L, -2);
+
+        if (!key || !dbm_isvalue(L, -1)) {
+            return luaL_error(L, "dbm keys and values must be strings or numbers.");
+        }
+        lua_pop(L, 1);
+        count += 1;
+    }
+
+    if (0 == count) {
+        lua_pushinteger(L, 0);
+        return 1;
+    }
+
+    /* Pairs point into the table, numbers converted on copies kept in anchor */
+    kv = (MDB_val *)lua_newuserdata(L, (size_t)count * (2 * sizeof(MDB_val) + sizeof(size_t)));
+    iks = (size_t *)(kv + 2 * count);
+    lua_newtable(L);
+    anchor = lua_gettop(L);
+
+    lua_pushnil(L);
+    while (lua_next(L, 2)) {
+        MDB_val *p = kv + 2 * n;
+
+        if (integerkey) {
+            iks[n] = (size_t)lua_tointeger(L, -2);
+            p[0].mv_size = sizeof(size_t);
+            p[0].mv_data = &iks[n];
+        } else if (LUA_TSTRING == lua_type(L, -2)) {
+            p[0].mv_data = (void *)lua_tolstring(L, -2, &p[0].mv_size);
+        } else {
+            lua_pushvalue(L, -2);
+            p[0].mv_data = (void *)lua_tolstring(L, -1, &p[0].mv_size);
+            lua_rawseti(L, anchor, ++anchored);
+        }
+
+        if (LUA_TSTRING == lua_type(L, -1)) {
+            p[1].mv_data = (void *)lua_tolstring(L, -1, &p[1].mv_size);
+        } else {
+            lua_pushvalue(L, -1);
+            p[1].mv_data = (void *)lua_tolstring(L, -1, &p[1].mv_size);
+            lua_rawseti(L, anchor, ++anchored);
+        }
+
+        lua_pop(L, 1);
+        n += 1;
+    }
+
+    op.dbi = dbm->dbi;
+    op.del = 0;
+    op.count = n;
+    op.pairs = kv;
+
+    if (MDB_CHECK(dbm_submit(dbm->e, &op))) {
+        lua_pushboolean(L, 0);
+        return 1;
+    }
+
+    lua_pushinteger(L, count);
+    return 1;
+}
+
+/*
+ * Holds the writer lock of the env until commit or abort, writers of
+ * other threads queue behind it.
+ */
+static int dbm_begin(lua_State * L) {
+    dbm_t *dbm = dbm_checkwrite(L, 1);
+    MDB_txn* mdb_txn = NULL;
+    dbm_txn_t *t;
+
+    t = (dbm_txn_t *)luaX_newuserdata(L, g_meta_txn, sizeof(dbm_txn_t));
+    t->txn = NULL;
+    t->dbm = NULL;
+    t->full = 0;
+
+    if (MDB_CHECK(dbm_txn_begin(dbm->e, 0, 1, &mdb_txn))) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    t->txn = mdb_txn;
+    t->dbm = dbm;
+    dbm->txn = t;
+    atomic_store_int(&dbm->e->writer, mc_thread_id());
+
+    lua_pushvalue(L, 1);
+    lua_setuservalue(L, -2);
+
+    return 1;
+}
+
+/*
+ * Handle of a named table in the same env, created when missing.
+ * The unnamed dbm then lists the table names among its keys.
+ */
+static int dbm_table(lua_State * L) {
+    dbm_t *dbm = dbm_checkwrite(L, 1);
+    const char *name = luaL_checkstring(L, 2);
+    unsigned int flags = MDB_CREATE;
+    MDB_txn *txn = NULL;
+    MDB_dbi dbi;
+    dbm_t *tbl;
+
+    if (lua_istable(L, 3)) {
+        lua_getfield(L, 3, "dupsort");
+        if (lua_toboolean(L, -1)) flags |= MDB_DUPSORT;
+        lua_getfield(L, 3, "integerkey");
+        if (lua_toboolean(L, -1)) flags |= MDB_INTEGERKEY;
+        lua_pop(L, 2);
+    }
+
+    tbl = (dbm_t *)luaX_newuserdata(L, g_meta_dbm, sizeof(dbm_t));
+    tbl->e = NULL;
+    tbl->rtxn = NULL;
+    tbl->txn = NULL;
+
+    if (MDB_CHECK(dbm_txn_begin(dbm->e, 0, 0, &txn))) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    if (MDB_CHECK(mdb_dbi_open(txn, name, flags, &dbi))) {
+        mdb_txn_abort(txn);
+        dbm_leave(dbm->e, 0);
+        lua_pushnil(L);
+        return 1;
+    }
+
+    if (MDB_CHECK(mdb_txn_commit(txn))) {
+        dbm_leave(dbm->e, 0);
+        lua_pushnil(L);
+        return 1;
+    }
+    dbm_leave(dbm->e, 0);
+
+    tbl->e = dbm->e;
+    tbl->dbi = dbi;
+    tbl->flags = flags & ~MDB_CREATE;
+    dbm_ref(dbm->e);
+
+    return 1;
+}
+
+/* Entries of this table and the size of the map. */
+static int dbm_stat(lua_State * L) {
+    dbm_t *dbm = luaX_checkdbm(L, 1);
+    MDB_envinfo info;
+    MDB_stat stat;
+    MDB_txn *txn;
+    int retval;
+
+    if (!(txn = dbm_read(dbm, &retval))) {
+        lua_pushnil(L);
+        lua_pushstring(L, mdb_strerror(retval));
+        return 2;
+    }
+
+    if (MDB_CHECK(mdb_stat(txn, dbm->dbi, &stat))) {
+        dbm_read_end(dbm);
+        lua_pushnil(L);
+        return 1;
+    }
+    dbm_read_end(dbm);
+    mdb_env_info(dbm->e->env, &info);
+
+    lua_createtable(L, 0, 6);
+    lua_pushinteger(L, (lua_Integer)stat.ms_entries);
+    lua_setfield(L, -2, "entries");
+    lua_pushinteger(L, (lua_Integer)stat.ms_depth);
+    lua_setfield(L, -2, "depth");
+    lua_pushinteger(L, (lua_Integer)(stat.ms_branch_pages + stat.ms_leaf_pages + stat.ms_overflow_pages));
+    lua_setfield(L, -2, "pages");
+    lua_pushinteger(L, (lua_Integer)info.me_mapsize);
+    lua_setfield(L, -2, "mapsize");
+    lua_pushinteger(L, (lua_Integer)info.me_numreaders);
+    lua_setfield(L, -2, "readers");
+    lua_pushinteger(L, (lua_Integer)info.me_maxreaders);
+    lua_setfield(L, -2, "maxreaders");
+
+    return 1;
+}
+
+static int txn__gc(lua_State * L) {
+    dbm_txn_t *t = (dbm_txn_t *)luaL_checkudata(L, 1, g_meta_txn);
+
+    if (t->txn) {
+        txn_finish(t, 0);
+    }
+    return 0;
+}
+
+/* A write that fills the map fails, the map grows once the txn ends. */
+static int txn_failed(dbm_txn_t *t, int retval) {
+    if (MDB_MAP_FULL == retval) {
+        t->full = 1;
+    }
+    return MDB_CHECK(retval);
+}
+
+static int txn_put(lua_State * L) {
+    dbm_txn_t *t = luaX_checktxn(L, 1);
+    MDB_val k, v;
+    size_t ik;
+
+    dbm_checkkey(L, t->dbm, 2, &k, &ik);
+    v.mv_data = (void *)luaL_checklstring(L, 3, &v.mv_size);
+
+    lua_pushboolean(L, 0 == txn_failed(t, mdb_put(t->txn, t->dbm->dbi, &k, &v, 0)));
+    return 1;
+}
+
+/* Sees the writes of this transaction. */
+static int txn_get(lua_State * L) {
+    dbm_txn_t *t = luaX_checktxn(L, 1);
+    MDB_val k, v;
+    size_t ik;
+
+    dbm_checkkey(L, t->dbm, 2, &k, &ik);
+
+    if (0 == mdb_get(t->txn, t->dbm->dbi, &k, &v)) {
+        lua_pushlstring(L, (const char *)v.mv_data, v.mv_size);
+    } else {
+        lua_pushnil(L);
+    }
+    return 1;
+}
+
+static int txn_del(lua_State * L) {
+    dbm_txn_t *t = luaX_checktxn(L, 1);
+    MDB_val k, v;
+    size_t ik;
+    int retval;
+
+    dbm_checkkey(L, t->dbm, 2, &k, &ik);
+
+    if (!lua_isnoneornil(L, 3)) {
+        v.mv_data = (void *)luaL_checklstring(L, 3, &v.mv_size);
+        retval = mdb_del(t->txn, t->dbm->dbi, &k, &v);
+    } else {
+        retval = mdb_del(t->txn, t->dbm->dbi, &k, NULL);
+    }
+
+    /* A missing key is not worth a log line */
+    if (MDB_NOTFOUND != retval) {
+        txn_failed(t, retval);
+    }
+
+    lua_pushboolean(L, MDB_SUCCESS == retval);
+    return 1;
+}
+
+static int txn_commit(lua_State * L) {
+    dbm_txn_t *t = luaX_checktxn(L, 1);
+
+    /* the handle is freed even when the commit fails */
+    lua_pushboolean(L, 0 == MDB_CHECK(txn_finish(t, 1)));
+    return 1;
+}
+
+static int txn_abort(lua_State * L) {
+    dbm_txn_t *t = luaX_checktxn(L, 1);
+
+    txn_finish(t, 0);
+
+    return 0;
+}
+
+static void cursor_release(dbm_cursor_t *c) {
+    if (c->e) {
+        mdb_cursor_close(c->cur);
+        mdb_txn_abort(c->txn);
+        dbm_leave(c->e, 1);
+        dbm_unref(c->e);
+        c->e = NULL;
+    }
+}
+
+static dbm_cursor_t *luaX_checkcursor(lua_State * L, int idx) {
+    dbm_cursor_t *c = (dbm_cursor_t *)luaL_checkudata(L, idx, g_meta_cursor);
+
+    if (!c->e) {
+        luaL_error(L, "dbm cursor is closed.");
+    }
+    return c;
+}
+
+/*
+ * The cursor keeps its read snapshot until closed, which holds back
+ * page reuse and map growth. Long walks are better off with scan.
+ */
+static int dbm_cursor(lua_State * L) {
+    dbm_t *dbm = luaX_checkdbm(L, 1);
+    MDB_cursor *cur;
+    MDB_txn *txn = NULL;
+    dbm_cursor_t *c;
+
+    c = (dbm_cursor_t *)luaX_newuserdata(L, g_meta_cursor, sizeof(dbm_cursor_t));
+    c->e = NULL;
+
+    if (MDB_CHECK(dbm_txn_begin(dbm->e, MDB_RDONLY, 1, &txn))) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    if (MDB_CHECK(mdb_cursor_open(txn, dbm->dbi, &cur))) {
+        mdb_txn_abort(txn);
+        dbm_leave(dbm->e, 1);
+        lua_pushnil(L);
+        return 1;
+    }
+
+    c->e = dbm->e;
+    c->flags = dbm->flags;
+    c->txn = txn;
+    c->cur = cur;
+
+    dbm_ref(dbm->e);
+
+    return 1;
+}
+
+/* Pushes key and value of the move, nil past either end. */
+static int cursor_move(lua_State * L, dbm_cursor_t *c, MDB_val *k, MDB_cursor_op op) {
+    MDB_val v;
+    int retval = mdb_cursor_get(c->cur, k, &v, op);
+
+    if (MDB_SUCCESS != retval) {
+        if (MDB_NOTFOUND != retval) {
+            MDB_CHECK(retval);
+        }
+        lua_pushnil(L);
+        return 1;
+    }
 
-static const char g_meta_dbm[] = { CODE_NAME ".meta.dbm" };
+    if ((c->flags & MDB_INTEGERKEY) && sizeof(size_t) == k->mv_size) {
+        size_t ik;
+        memcpy(&ik, k->mv_data, sizeof(size_t));
+        lua_pushinteger(L, (lua_Integer)ik);
+    } else {
+        lua_pushlstring(L, (const char *)k->mv_data, k->mv_size);
+    }
+    lua_pushlstring(L, (const char *)v.mv_data, v.mv_size);
+    return 2;
+}
 
-#define luaX_checkdbm(L, idx)   (dbm_t *)luaL_checkudata(L, idx, g_meta_dbm)
+/* First pair at or after key. */
+static int cursor_seek(lua_State * L) {
+    dbm_cursor_t *c = luaX_checkcursor(L, 1);
+    MDB_val k;
+    size_t ik;
 
-static int MDB_CHECK(int errcode) {
-    if (MDB_SUCCESS != errcode) {
-        LG_ERR("mdb error: %s", mdb_strerror(errcode));
-        return -1;
+    if (c->flags & MDB_INTEGERKEY) {
+        ik = (size_t)luaL_checkinteger(L, 2);
+        k.mv_size = sizeof(size_t);
+        k.mv_data = &ik;
+    } else {
+        k.mv_data = (void *)luaL_checklstring(L, 2, &k.mv_size);
     }
+    return cursor_move(L, c, &k, MDB_SET_RANGE);
+}
+
+static int cursor_first(lua_State * L) {
+    MDB_val k;
+    return cursor_move(L, luaX_checkcursor(L, 1), &k, MDB_FIRST);
+}
+
+static int cursor_last(lua_State * L) {
+    MDB_val k;
+    return cursor_move(L, luaX_checkcursor(L, 1), &k, MDB_LAST);
+}
+
+static int cursor_next(lua_State * L) {
+    MDB_val k;
+    return cursor_move(L, luaX_checkcursor(L, 1), &k, MDB_NEXT);
+}
+
+static int cursor_prev(lua_State * L) {
+    MDB_val k;
+    return cursor_move(L, luaX_checkcursor(L, 1), &k, MDB_PREV);
+}
+
+static int cursor__gc(lua_State * L) {
+    cursor_release((dbm_cursor_t *)luaL_checkudata(L, 1, g_meta_cursor));
     return 0;
 }
 
-static int dbm__gc(lua_State * L) {
-    dbm_t *dbm = luaX_checkdbm(L, -1);
-    if (dbm && dbm->env) {
-        mdb_env_sync(dbm->env, 1);
-        mdb_dbi_close(dbm->env, dbm->dbi);
-        mdb_env_close(dbm->env);
-        dbm->env = NULL;
+static void scan_release(dbm_scan_t *s) {
+    if (s->e) {
+        dbm_unref(s->e);
+        s->e = NULL;
     }
+}
+
+static int scan__gc(lua_State * L) {
+    scan_release((dbm_scan_t *)luaL_checkudata(L, 1, g_meta_scan));
     return 0;
 }
 
-static int dbm_close(lua_State * L) {
-    dbm_t *dbm = luaX_checkdbm(L, 1);
+/* Stores a bound as raw key bytes in the slot. */
+static void scan_bound(lua_State * L, dbm_scan_t *s, int opts, const char *name, int uv, int slot) {
+    if (LUA_TNIL == lua_getfield(L, opts, name)) {
+        lua_pop(L, 1);
+        return;
+    }
+
+    if (s->flags & MDB_INTEGERKEY) {
+        size_t ik = (size_t)luaL_checkinteger(L, -1);
+        lua_pushlstring(L, (const char *)&ik, sizeof(size_t));
+    } else {
+        luaL_checkstring(L, -1);
+        lua_pushvalue(L, -1);
+    }
+    lua_rawseti(L, uv, slot);
+    lua_pop(L, 1);
+}
 
-    mdb_env_sync(dbm->env, 1);
-    mdb_dbi_close(dbm->env, dbm->dbi);
-    mdb_env_close(dbm->env);
-    dbm->env = NULL;
+static int scan_val(lua_State * L, int uv, int slot, MDB_val *val) {
+    if (LUA_TSTRING != lua_rawgeti(L, uv, slot)) {
+        lua_pop(L, 1);
+        return 0;
+    }
 
-    return 0;
+    /* anchored in the uservalue, the pointer outlives the pop */
+    val->mv_data = (void *)lua_tolstring(L, -1, &val->mv_size);
+    lua_pop(L, 1);
+    return 1;
 }
 
-static int dbm_sync(lua_State * L) {
+/* LMDB's default order of string keys: bytes, then the shorter first. */
+static int scan_order(const MDB_val *a, const MDB_val *b) {
+    int r = memcmp(a->mv_data, b->mv_data, MC_MIN(a->mv_size, b->mv_size));
+
+    if (0 != r) {
+        return r;
+    }
+    return (a->mv_size < b->mv_size) ? -1 : (a->mv_size > b->mv_size);
+}
+
+/* Positions past the last pair handed out, dupsort values included. */
+static int scan_resume(dbm_scan_t *s, MDB_txn *txn, MDB_cursor *cur, MDB_val *lk, MDB_val *lv, MDB_val *k, MDB_val *v) {
+    int retval;
+
+    *k = *lk;
+
+    if (s->flags & MDB_DUPSORT) {
+        *v = *lv;
+        retval = mdb_cursor_get(cur, k, v, MDB_GET_BOTH_RANGE);
+
+        if (MDB_SUCCESS == retval) {
+            return 0 == mdb_dcmp(txn, s->dbi, v, lv) ? mdb_cursor_get(cur, k, v, MDB_NEXT) : retval;
+        }
+        *k = *lk;
+    }
+
+    retval = mdb_cursor_get(cur, k, v, MDB_SET_RANGE);
+
+    if (MDB_SUCCESS == retval && 0 == mdb_cmp(txn, s->dbi, k, lk)) {
+        retval = mdb_cursor_get(cur, k, v, MDB_NEXT_NODUP);
+    }
+    return retval;
+}
+
+/* Reads the next batch into the buffer, releases the env at the end. */
+static void scan_fill(lua_State * L, dbm_scan_t *s, int uv) {
+    MDB_val k, v, lk, lv, to, prefix;
+    int has_to, has_prefix, retval, buf;
+    lua_Integer want = s->batch;
+    MDB_cursor *cur;
+    MDB_txn *txn = NULL;
+    int n = 0;
+
+    s->pos = 0;
+    s->size = 0;
+
+    if (s->limit > 0) {
+        want = MC_MIN(want, s->limit - s->count);
+    }
+
+    if (want <= 0) {
+        scan_release(s);
+        return;
+    }
+
+    if (MDB_SUCCESS != (retval = dbm_txn_begin(s->e, MDB_RDONLY, 0, &txn))) {
+        scan_release(s);
+        luaL_error(L, "dbm scan failed: %s.", mdb_strerror(retval));
+        return;
+    }
+
+    if (MDB_CHECK(mdb_cursor_open(txn, s->dbi, &cur))) {
+        mdb_txn_abort(txn);
+        dbm_leave(s->e, 0);
+        scan_release(s);
+        return;
+    }
+
+    has_to = scan_val(L, uv, SCAN_TO, &to);
+    has_prefix = scan_val(L, uv, SCAN_PREFIX, &prefix);
+
+    if (scan_val(L, uv, SCAN_LASTK, &lk)) {
+        scan_val(L, uv, SCAN_LASTV, &lv);
+        retval = scan_resume(s, txn, cur, &lk, &lv, &k, &v);
+    } else if (scan_val(L, uv, SCAN_FROM, &k)) {
+        retval = mdb_cursor_get(cur, &k, &v, MDB_SET_RANGE);
+    } else {
+        retval = mdb_cursor_get(cur, &k, &v, MDB_FIRST);
+    }
+
+    lua_rawgeti(L, uv, SCAN_BUF);
+    buf = lua_gettop(L);
+
+    while (MDB_SUCCESS == retval && n < want) {
+        if (has_to && mdb_cmp(txn, s->dbi, &k, &to) >= 0) {
+            retval = MDB_NOTFOUND;
+            break;
+        }
+
+        if (has_prefix && (k.mv_size < prefix.mv_size || 0 != memcmp(k.mv_data, prefix.mv_data, prefix.mv_size))) {
+            retval = MDB_NOTFOUND;
+            break;
+        }
+
+        if ((s->flags & MDB_INTEGERKEY) && sizeof(size_t) == k.mv_size) {
+            size_t ik;
+            memcpy(&ik, k.mv_data, sizeof(size_t));
+            lua_pushinteger(L, (lua_Integer)ik);
+        } else {
+            lua_pushlstring(L, (const char *)k.mv_data, k.mv_size);
+        }
+        lua_rawseti(L, buf, 2 * n + 1);
+        lua_pushlstring(L, (const char *)v.mv_data, v.mv_size);
+        lua_rawseti(L, buf, 2 * n + 2);
+
+        lk = k;
+        lv = v;
+        n += 1;
+
+        retval = mdb_cursor_get(cur, &k, &v, MDB_NEXT);
+    }
+
+    /* Copied out before the snapshot goes */
+    if (n > 0) {
+        lua_pushlstring(L, (const char *)lk.mv_data, lk.mv_size);
+        lua_rawseti(L, uv, SCAN_LASTK);
+        lua_pushlstring(L, (const char *)lv.mv_data, lv.mv_size);
+        lua_rawseti(L, uv, SCAN_LASTV);
+    }
+    lua_pop(L, 1);
+
+    mdb_cursor_close(cur);
+    mdb_txn_abort(txn);
+    dbm_leave(s->e, 0);
+
+    if (MDB_NOTFOUND != retval && MDB_SUCCESS != retval) {
+        MDB_CHECK(retval);
+    }
+
+    s->size = n;
+    s->count += n;
+
+    if (MDB_SUCCESS != retval || (s->limit > 0 && s->count >= s->limit)) {
+        scan_release(s);
+    }
+}
+
+static int scan_next(lua_State * L) {
+    dbm_scan_t *s = (dbm_scan_t *)lua_touserdata(L, lua_upvalueindex(1));
+    int uv;
+
+    lua_getuservalue(L, lua_upvalueindex(1));
+    uv = lua_gettop(L);
+
+    if (s->pos >= s->size) {
+        if (!s->e) {
+            return 0;
+        }
+
+        scan_fill(L, s, uv);
+
+        if (0 == s->size) {
+            return 0;
+        }
+    }
+
+    lua_rawgeti(L, uv, SCAN_BUF);
+    lua_rawgeti(L, -1, 2 * s->pos + 1);
+    lua_rawgeti(L, -2, 2 * s->pos + 2);
+    s->pos += 1;
+
+    return 2;
+}
+
+/*
+ * Iterator over { from, to, prefix, limit, batch }, keys in [from, to)
+ * starting with prefix. Each batch reads its own snapshot, so a long
+ * scan sees writes made between batches.
+ */
+static int dbm_scan(lua_State * L) {
     dbm_t *dbm = luaX_checkdbm(L, 1);
+    dbm_scan_t *s;
+    MDB_val from, prefix;
+    int uv;
 
-    if (MDB_CHECK(mdb_env_sync(dbm->env, 1))) {
-        lua_pushboolean(L, 0);
-        return 1;
+    s = (dbm_scan_t *)luaX_newuserdata(L, g_meta_scan, sizeof(dbm_scan_t));
+    s->e = NULL;
+    s->dbi = dbm->dbi;
+    s->flags = dbm->flags;
+    s->limit = 0;
+    s->count = 0;
+    s->batch = DBM_SCAN_BATCH;
+    s->pos = 0;
+    s->size = 0;
+
+    lua_createtable(L, SCAN_BUF, 0);
+    uv = lua_gettop(L);
+    lua_createtable(L, 2 * DBM_SCAN_BATCH, 0);
+    lua_rawseti(L, uv, SCAN_BUF);
+
+    if (lua_istable(L, 2)) {
+        scan_bound(L, s, 2, "from", uv, SCAN_FROM);
+        scan_bound(L, s, 2, "to", uv, SCAN_TO);
+
+        if (LUA_TNIL != lua_getfield(L, 2, "prefix")) {
+            if (s->flags & MDB_INTEGERKEY) {
+                return luaL_error(L, "dbm integer keys have no prefix.");
+            }
+            prefix.mv_data = (void *)luaL_checklstring(L, -1, &prefix.mv_size);
+            lua_pushvalue(L, -1);
+            lua_rawseti(L, uv, SCAN_PREFIX);
+
+            /* the prefix starts the range unless from is later, in key byte order */
+            if (!scan_val(L, uv, SCAN_FROM, &from) || (scan_order(&from, &prefix) < 0)) {
+                lua_pushvalue(L, -1);
+                lua_rawseti(L, uv, SCAN_FROM);
+            }
+        }
+        lua_pop(L, 1);
+
+        lua_getfield(L, 2, "limit");
+        s->limit = luaL_optinteger(L, -1, 0);
+        lua_getfield(L, 2, "batch");
+        s->batch = (int)MC_MAX(luaL_optinteger(L, -1, DBM_SCAN_BATCH), 1);
+        lua_pop(L, 2);
     }
 
-    lua_pushboolean(L, 1);
+    lua_setuservalue(L, -2);
+
+    /* held from here, a scan outlives a closed handle */
+    s->e = dbm->e;
+    dbm_ref(s->e);
+
+    lua_pushcclosure(L, scan_next, 1);
     return 1;
 }
 
-static int dbm_del(lua_State * L) {
-    size_t l = 0;
+static void snap_release(dbm_snap_t *sn) {
+    if (sn->e) {
+        mdb_txn_abort(sn->txn);
+        if (sn->active) {
+            dbm_leave(sn->e, 1);
+        }
+        dbm_unref(sn->e);
+        sn->e = NULL;
+        sn->active = 0;
+        sn->gen += 1;
+    }
+}
+
+static dbm_snap_t *luaX_checksnap(lua_State * L, int idx) {
+    dbm_snap_t *sn = (dbm_snap_t *)luaL_checkudata(L, idx, g_meta_snap);
+
+    if (!sn->e) {
+        luaL_error(L, "dbm snapshot is closed.");
+    }
+    return sn;
+}
+
+/*
+ * Long-lived read snapshot, reads through it skip the txn setup and
+ * hand out views of the map. A pinned snapshot holds back page reuse
+ * and map growth, reset it between bursts of reads.
+ */
+static int dbm_snapshot(lua_State * L) {
     dbm_t *dbm = luaX_checkdbm(L, 1);
-    const char *key = luaL_checklstring(L, 2, &l);
-    MDB_txn* mdb_txn;
-    MDB_val k;
+    MDB_txn *txn = NULL;
+    dbm_snap_t *sn;
 
-    if (MDB_CHECK(mdb_txn_begin(dbm->env, NULL, 0, &mdb_txn))) {
-        lua_pushboolean(L, 0);
+    sn = (dbm_snap_t *)luaX_newuserdata(L, g_meta_snap, sizeof(dbm_snap_t));
+    sn->e = NULL;
+    sn->active = 0;
+    sn->gen = 0;
+
+    if (MDB_CHECK(dbm_txn_begin(dbm->e, MDB_RDONLY, 1, &txn))) {
+        lua_pushnil(L);
         return 1;
     }
 
-    k.mv_size = l;
-    k.mv_data = (void *)key;
+    sn->e = dbm->e;
+    sn->dbi = dbm->dbi;
+    sn->flags = dbm->flags;
+    sn->txn = txn;
+    sn->active = 1;
+
+    dbm_ref(dbm->e);
+
+    return 1;
+}
+
+/* Releases the snapshot but keeps the txn handle for renew. */
+static int snap_reset(lua_State * L) {
+    dbm_snap_t *sn = luaX_checksnap(L, 1);
+
+    if (sn->active) {
+        mdb_txn_reset(sn->txn);
+        dbm_leave(sn->e, 1);
+        sn->active = 0;
+        sn->gen += 1;
+    }
+    return 0;
+}
+
+/* Moves to the latest data, views taken before go stale. */
+static int snap_renew(lua_State * L) {
+    dbm_snap_t *sn = luaX_checksnap(L, 1);
+
+    if (sn->active) {
+        mdb_txn_reset(sn->txn);
+        dbm_leave(sn->e, 1);
+        sn->active = 0;
+        sn->gen += 1;
+    }
 
-    if (MDB_CHECK(mdb_del(mdb_txn, dbm->dbi, &k, NULL))) {
-        mdb_txn_abort(mdb_txn);
+    if (MDB_CHECK(dbm_txn_begin(sn->e, MDB_RDONLY, 1, &sn->txn))) {
         lua_pushboolean(L, 0);
         return 1;
     }
 
-    mdb_txn_commit(mdb_txn);
+    sn->active = 1;
+
     lua_pushboolean(L, 1);
     return 1;
 }
 
-static int dbm_get(lua_State * L) {
-    size_t l = 0;
-    dbm_t *dbm = luaX_checkdbm(L, 1);
-    const char *key = luaL_checklstring(L, 2, &l);
-    MDB_txn* mdb_txn;
+static void view_push(lua_State * L, int snap, dbm_snap_t *sn, const char *data, size_t len) {
+    dbm_view_t *v = (dbm_view_t *)luaX_newuserdata(L, g_meta_view, sizeof(dbm_view_t));
+
+    v->snap = sn;
+    v->data = data;
+    v->len = len;
+    v->gen = sn->gen;
+
+    lua_pushvalue(L, snap);
+    lua_setuservalue(L, -2);
+}
+
+static int snap_get(lua_State * L) {
+    dbm_snap_t *sn = luaX_checksnap(L, 1);
     MDB_val k, v;
+    size_t ik;
 
-    if (MDB_CHECK(mdb_txn_begin(dbm->env, NULL, MDB_RDONLY, &mdb_txn))) {
-        lua_pushnil(L);
-        return 1;
+    if (!sn->active) {
+        return luaL_error(L, "dbm snapshot is reset.");
     }
 
-    k.mv_size = l;
-    k.mv_data = (void *)key;
+    if (sn->flags & MDB_INTEGERKEY) {
+        ik = (size_t)luaL_checkinteger(L, 2);
+        k.mv_size = sizeof(size_t);
+        k.mv_data = &ik;
+    } else {
+        k.mv_data = (void *)luaL_checklstring(L, 2, &k.mv_size);
+    }
 
-    if (0 == mdb_get(mdb_txn, dbm->dbi, &k, &v)) {
-        lua_pushlstring(L, (const char *)v.mv_data, v.mv_size);
+    if (0 == mdb_get(sn->txn, sn->dbi, &k, &v)) {
+        view_push(L, 1, sn, (const char *)v.mv_data, v.mv_size);
     } else {
         lua_pushnil(L);
     }
-    mdb_txn_abort(mdb_txn);
+    return 1;
+}
+
+static int snap__gc(lua_State * L) {
+    snap_release((dbm_snap_t *)luaL_checkudata(L, 1, g_meta_snap));
+    return 0;
+}
+
+static dbm_view_t *luaX_checkview(lua_State * L, int idx) {
+    dbm_view_t *v = (dbm_view_t *)luaL_checkudata(L, idx, g_meta_view);
+
+    if (!v->snap->e || !v->snap->active || v->gen != v->snap->gen) {
+        luaL_error(L, "dbm view is stale.");
+    }
+    return v;
+}
+
+const char *luaX_toview(lua_State *L, int idx, size_t *len) {
+    dbm_view_t *v;
+
+    if (!luaL_testudata(L, idx, g_meta_view)) {
+        return NULL;
+    }
+
+    v = luaX_checkview(L, idx);
+    *len = v->len;
+    return v->data;
+}
+
+/* String-style position, negatives count from the end. */
+static size_t view_posrelat(lua_Integer pos, size_t len) {
+    if (pos >= 0) {
+        return (size_t)pos;
+    } else if (0u - (size_t)pos > len) {
+        return 0;
+    }
+    return len + (size_t)pos + 1;
+}
 
+static int view_len(lua_State * L) {
+    lua_pushinteger(L, (lua_Integer)luaX_checkview(L, 1)->len);
     return 1;
 }
 
-static int dbm_put(lua_State * L) {
-    size_t kl = 0, vl = 0;
-    dbm_t *dbm = luaX_checkdbm(L, 1);
-    const char *key = luaL_checklstring(L, 2, &kl);
-    const char *val = luaL_checklstring(L, 3, &vl);
-    MDB_txn* mdb_txn;
-    MDB_val k, v;
+static int view_byte(lua_State * L) {
+    dbm_view_t *v = luaX_checkview(L, 1);
+    size_t i = view_posrelat(luaL_optinteger(L, 2, 1), v->len);
+    size_t j = view_posrelat(luaL_optinteger(L, 3, (lua_Integer)i), v->len);
+    int n;
 
-    if (MDB_CHECK(mdb_txn_begin(dbm->env, NULL, 0, &mdb_txn))) {
-        lua_pushboolean(L, 0);
-        return 1;
+    if (i < 1) i = 1;
+    if (j > v->len) j = v->len;
+    if (i > j) return 0;
+
+    n = (int)(j - i + 1);
+    luaL_checkstack(L, n, "view slice too long");
+
+    for (j = 0; j < (size_t)n; ++j) {
+        lua_pushinteger(L, (unsigned char)v->data[i + j - 1]);
     }
+    return n;
+}
 
-    k.mv_size = kl;
-    k.mv_data = (void *)key;
-    v.mv_size = vl;
-    v.mv_data = (void *)val;
+/* Slice sharing the same bytes and snapshot. */
+static int view_sub(lua_State * L) {
+    dbm_view_t *v = luaX_checkview(L, 1);
+    size_t i = view_posrelat(luaL_checkinteger(L, 2), v->len);
+    size_t j = view_posrelat(luaL_optinteger(L, 3, -1), v->len);
+    dbm_view_t *w;
 
-    if (MDB_CHECK(mdb_put(mdb_txn, dbm->dbi, &k, &v, 0))) {
-        mdb_txn_abort(mdb_txn);
-        lua_pushboolean(L, 0);
-        return 1;
+    if (i < 1) i = 1;
+    if (j > v->len) j = v->len;
+
+    w = (dbm_view_t *)luaX_newuserdata(L, g_meta_view, sizeof(dbm_view_t));
+    *w = *v;
+
+    if (i > j) {
+        w->len = 0;
+    } else {
+        w->data = v->data + i - 1;
+        w->len = j - i + 1;
     }
 
-    mdb_txn_commit(mdb_txn);
-    lua_pushboolean(L, 1);
+    lua_getuservalue(L, 1);
+    lua_setuservalue(L, -2);
+    return 1;
+}
+
+/* Copies the bytes out, the string outlives the snapshot. */
+static int view_tostring(lua_State * L) {
+    dbm_view_t *v = luaX_checkview(L, 1);
+    lua_pushlstring(L, v->data, v->len);
+    return 1;
+}
+
+/* Same value as sevo.hash.h64 of the bytes. */
+static int view_hash(lua_State * L) {
+    dbm_view_t *v = luaX_checkview(L, 1);
+    lua_pushinteger(L, (lua_Integer)mc_hash64(v->data, (int)v->len));
+    return 1;
+}
+
+static int view_valid(lua_State * L) {
+    dbm_view_t *v = (dbm_view_t *)luaL_checkudata(L, 1, g_meta_view);
+    lua_pushboolean(L, v->snap->e && v->snap->active && v->gen == v->snap->gen);
     return 1;
 }
 
@@ -150,20 +1596,23 @@ static int dbm_keys(lua_State * L) {
     MDB_cursor *mdb_cur;
     MDB_val k, v;
     lua_Integer idx = 1;
+    int retval;
 
-    if (MDB_CHECK(mdb_txn_begin(dbm->env, NULL, MDB_RDONLY, &mdb_txn))) {
+    if (!(mdb_txn = dbm_read(dbm, &retval))) {
         lua_pushnil(L);
-        return 1;
+        lua_pushstring(L, mdb_strerror(retval));
+        return 2;
     }
 
     if (MDB_CHECK(mdb_cursor_open(mdb_txn, dbm->dbi, &mdb_cur))) {
-        mdb_txn_abort(mdb_txn);
+        dbm_read_end(dbm);
         lua_pushnil(L);
         return 1;
     }
 
     if (MDB_CHECK(mdb_cursor_get(mdb_cur, &k, &v, MDB_FIRST))) {
-        mdb_txn_abort(mdb_txn);
+        mdb_cursor_close(mdb_cur);
+        dbm_read_end(dbm);
         lua_pushnil(L);
         return 1;
     }
@@ -171,12 +1620,12 @@ static int dbm_keys(lua_State * L) {
     lua_newtable(L);
 
     do {
-        lua_pushlstring(L, (const char *)k.mv_data, k.mv_size);
+        dbm_pushkey(L, dbm, &k);
         lua_seti(L, -2, idx++);
     } while (MDB_SUCCESS == mdb_cursor_get(mdb_cur, &k, &v, MDB_NEXT));
 
     mdb_cursor_close(mdb_cur);
-    mdb_txn_abort(mdb_txn);
+    dbm_read_end(dbm);
 
     return 1;
 }
@@ -202,44 +1651,173 @@ static char *dbm_checkpath(char *p, const char *name) {
     return mc_path_exist(p) ? p : NULL;
 }
 
-static int dbm_open(lua_State * L) {
-    const char *path = luaL_checkstring(L, 1);
-    char fullpath[MC_MAX_PATH] = { 0 };
+/* Reads { mapsize, sync, writemap, readahead, maxdbs, maxreaders } for a new env. */
+static void dbm_options(lua_State * L, int idx, dbm_opts_t *opts) {
+    int i;
+
+    /* Reads renew their txn on whichever thread runs the state */
+    opts->flags = MDB_NOTLS;
+    opts->mapsize = 0;
+    opts->maxdbs = DBM_MAXDBS;
+    opts->maxreaders = (unsigned int)MC_MAX(mc_cpunum(), 2) * DBM_WORKER_READERS;
+
+    if (!lua_istable(L, idx)) {
+        return;
+    }
+
+    if (LUA_TNIL != lua_getfield(L, idx, "mapsize")) {
+        opts->mapsize = (size_t)luaL_checkinteger(L, -1);
+    }
+    lua_pop(L, 1);
+
+    if (LUA_TNIL != lua_getfield(L, idx, "maxdbs")) {
+        opts->maxdbs = (MDB_dbi)luaL_checkinteger(L, -1);
+    }
+    lua_pop(L, 1);
+
+    if (LUA_TNIL != lua_getfield(L, idx, "maxreaders")) {
+        lua_Integer readers = luaL_checkinteger(L, -1);
+
+        if (readers < 1 || readers > 0x7FFFFFFF) {
+            luaL_error(L, "dbm maxreaders must be positive.");
+        }
+        opts->maxreaders = (unsigned int)readers;
+    }
+    lua_pop(L, 1);
+
+    /* full fsyncs every commit, meta skips the meta page, none leaves it to sync() */
+    if (LUA_TNIL != lua_getfield(L, idx, "sync")) {
+        const char *sync = luaL_checkstring(L, -1);
+
+        for (i = 0; g_dbm_syncs[i]; ++i) {
+            if (0 == strcmp(sync, g_dbm_syncs[i])) break;
+        }
+
+        if (1 == i) {
+            opts->flags |= MDB_NOMETASYNC;
+        } else if (2 == i) {
+            opts->flags |= MDB_NOSYNC;
+        } else if (!g_dbm_syncs[i]) {
+            luaL_error(L, "dbm sync must be full, meta or none.");
+        }
+    }
+    lua_pop(L, 1);
+
+    lua_getfield(L, idx, "writemap");
+    if (lua_toboolean(L, -1)) opts->flags |= MDB_WRITEMAP;
+    lua_pop(L, 1);
+
+    /* Random reads over a large map gain nothing from readahead */
+    if (LUA_TBOOLEAN == lua_getfield(L, idx, "readahead") && !lua_toboolean(L, -1)) {
+        opts->flags |= MDB_NORDAHEAD;
+    }
+    lua_pop(L, 1);
+}
+
+/* Runs under g_dbm_mutex, so it reports failure instead of raising. */
+static dbm_env_t *dbm_env_open(const char *path, const dbm_opts_t *opts, const char **err) {
     MDB_env *env;
     MDB_txn *txn;
     MDB_dbi dbi;
-    dbm_t *dbm;
+    dbm_env_t *e;
 
-    if (!dbm_checkpath(fullpath, path)) {
-        return luaL_error(L, "dbm path is invalid.");
+    if (MDB_CHECK(mdb_env_create(&env))) {
+        *err = "mdb env create failed.";
+        return NULL;
     }
 
-    if (MDB_CHECK(mdb_env_create(&env))) {
-        return luaL_error(L, "mdb env create failed.");
+    if (opts->mapsize > 0) {
+        MDB_CHECK(mdb_env_set_mapsize(env, opts->mapsize));
     }
+    mdb_env_set_maxdbs(env, opts->maxdbs);
+    MDB_CHECK(mdb_env_set_maxreaders(env, opts->maxreaders));
 
-    if (MDB_CHECK(mdb_env_open(env, fullpath, 0, 0664))) {
+    if (MDB_CHECK(mdb_env_open(env, path, opts->flags, 0664))) {
         mdb_env_close(env);
-        return luaL_error(L, "mdb env open failed.");
+        *err = "mdb env open failed.";
+        return NULL;
     }
 
     if (MDB_CHECK(mdb_txn_begin(env, NULL, MDB_RDONLY, &txn))) {
         mdb_env_close(env);
-        return luaL_error(L, "mdb txn begin failed.");
+        *err = "mdb txn begin failed.";
+        return NULL;
     }
 
     if (MDB_CHECK(mdb_dbi_open(txn, NULL, MDB_CREATE, &dbi))) {
         mdb_txn_abort(txn);
         mdb_env_close(env);
-        return luaL_error(L, "mdb dbi open failed.");
+        *err = "mdb dbi open failed.";
+        return NULL;
     }
 
     mdb_txn_commit(txn);
 
+    e = (dbm_env_t *)mc_calloc(1, sizeof(dbm_env_t));
+    e->env = env;
+    e->dbi = dbi;
+    mc_mutex_create(&e->lock);
+    mc_cond_create(&e->cond);
+    mc_cond_create(&e->queue);
+    strcpy(e->path, path);
+
+    return e;
+}
+
+/*
+ * Every state opening the same path shares one env, the options of
+ * the first open stay in effect.
+ */
+static int dbm_open(lua_State * L) {
+    const char *path = luaL_checkstring(L, 1);
+    char fullpath[MC_MAX_PATH] = { 0 };
+    const char *err = NULL;
+    int shared = 0;
+    dbm_opts_t opts;
+    dbm_env_t *e;
+    dbm_t *dbm;
+
+    if (!dbm_checkpath(fullpath, path)) {
+        return luaL_error(L, "dbm path is invalid.");
+    }
+
+    dbm_options(L, 2, &opts);
+
     dbm = (dbm_t *)luaX_newuserdata(L, g_meta_dbm, sizeof(dbm_t));
+    dbm->e = NULL;
+    dbm->flags = 0;
+    dbm->rtxn = NULL;
+    dbm->txn = NULL;
+
+    mc_mutex_lock(&g_dbm_mutex);
+
+    for (e = g_dbm_envs; e; e = e->next) {
+        if (0 == strcmp(e->path, fullpath)) {
+            break;
+        }
+    }
+
+    if (e) {
+        atomic_add_int(&e->refs, 1);
+        shared = 1;
+    } else if ((e = dbm_env_open(fullpath, &opts, &err))) {
+        e->refs = 1;
+        e->next = g_dbm_envs;
+        g_dbm_envs = e;
+    }
+
+    mc_mutex_unlock(&g_dbm_mutex);
 
-    dbm->env = env;
-    dbm->dbi = dbi;
+    if (!e) {
+        return luaL_error(L, "%s", err);
+    }
+
+    if (shared && lua_istable(L, 2)) {
+        LG_WRN("dbm %s is already open, its options stay", fullpath);
+    }
+
+    dbm->e = e;
+    dbm->dbi = e->dbi;
 
     return 1;
 }
@@ -253,6 +1831,55 @@ int luaopen_sevo_dbm(lua_State* L) {
         { "get", dbm_get },
         { "put", dbm_put },
         { "keys", dbm_keys },
+        { "put_many", dbm_put_many },
+        { "begin", dbm_begin },
+        { "table", dbm_table },
+        { "stat", dbm_stat },
+        { "cursor", dbm_cursor },
+        { "scan", dbm_scan },
+        { "snapshot", dbm_snapshot },
+        { NULL, NULL }
+    };
+    luaL_Reg meta_snap[] = {
+        { "__gc", snap__gc },
+        { "get", snap_get },
+        { "reset", snap_reset },
+        { "renew", snap_renew },
+        { "close", snap__gc },
+        { NULL, NULL }
+    };
+    luaL_Reg meta_view[] = {
+        { "__len", view_len },
+        { "__tostring", view_tostring },
+        { "len", view_len },
+        { "byte", view_byte },
+        { "sub", view_sub },
+        { "tostring", view_tostring },
+        { "hash", view_hash },
+        { "valid", view_valid },
+        { NULL, NULL }
+    };
+    luaL_Reg meta_cursor[] = {
+        { "__gc", cursor__gc },
+        { "seek", cursor_seek },
+        { "first", cursor_first },
+        { "last", cursor_last },
+        { "next", cursor_next },
+        { "prev", cursor_prev },
+        { "close", cursor__gc },
+        { NULL, NULL }
+    };
+    luaL_Reg meta_scan[] = {
+        { "__gc", scan__gc },
+        { NULL, NULL }
+    };
+    luaL_Reg meta_txn[] = {
+        { "__gc", txn__gc },
+        { "put", txn_put },
+        { "get", txn_get },
+        { "del", txn_del },
+        { "commit", txn_commit },
+        { "abort", txn_abort },
         { NULL, NULL }
     };
     luaL_Reg mod_dbm[] = {
@@ -260,7 +1887,20 @@ int luaopen_sevo_dbm(lua_State* L) {
         { NULL, NULL }
     };
 
+    /* Every Lua state loads the module, the first makes the mutex. */
+    mc_spin_lock(&g_dbm_lock);
+    if (!g_dbm_ready) {
+        mc_mutex_create(&g_dbm_mutex);
+        g_dbm_ready = 1;
+    }
+    mc_spin_unlock(&g_dbm_lock);
+
     luaX_register_type(L, g_meta_dbm, meta_dbm);
+    luaX_register_type(L, g_meta_txn, meta_txn);
+    luaX_register_type(L, g_meta_cursor, meta_cursor);
+    luaX_register_type(L, g_meta_scan, meta_scan);
+    luaX_register_type(L, g_meta_snap, meta_snap);
+    luaX_register_type(L, g_meta_view, meta_view);
     luaX_register_module(L, "dbm", mod_dbm);
 
     return 0;
@@ -18,6 +18,12 @@ extern "C" {
 
     int luaopen_sevo_dbm(lua_State* L);
 
+    /*
+     * Bytes of a dbm view, NULL when idx is not one. Raises when the
+     * snapshot behind the view was reset or closed.
+     */
+    const char *luaX_toview(lua_State *L, int idx, size_t *len);
+
 #ifdef __cplusplus
 };
 #endif
@@ -98,6 +98,47 @@ bigint_t *new_bigint(lua_State *L) {
     return bi;
 }
 
+void luaX_pushull(lua_State *L, unsigned long long x) {
+    if (x <= (unsigned long long)LUA_MAXINTEGER) {
+        lua_pushinteger(L, (lua_Integer)x);
+    } else {
+        bigint_t *bi = new_bigint(L);
+        mpz_set_ull(bi->x, x);
+    }
+}
+
+long long luaX_checkll(lua_State *L, int index) {
+    long long x;
+    mpz_t r;
+
+    if (lua_isinteger(L, index)) {
+        return (long long)lua_tointeger(L, index);
+    }
+
+    mpz_init(r);
+    luaX_checkmpz(L, index, r);
+    x = mpz_get_ll(r);
+    mpz_clear(r);
+
+    return x;
+}
+
+unsigned long long luaX_checkull(lua_State *L, int index) {
+    unsigned long long x;
+    mpz_t r;
+
+    if (lua_isinteger(L, index)) {
+        return (unsigned long long)lua_tointeger(L, index);
+    }
+
+    mpz_init(r);
+    luaX_checkmpz(L, index, r);
+    x = mpz_get_ull(r);
+    mpz_clear(r);
+
+    return x;
+}
+
 static int bigint_new(lua_State* L) {
     bigint_t *bi = new_bigint(L);
     return luaX_checkmpz(L, 1, bi->x);
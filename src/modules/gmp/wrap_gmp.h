@@ -33,6 +33,17 @@ extern "C" {
     int luaX_checkmpz(lua_State *L, int index, mpz_t r);
 
     bigint_t *new_bigint(lua_State *L);
+
+    /*
+     * 64-bit values without a bigint when they fit a lua_Integer. Checks
+     * take integers directly and fall back to mpz for other operands.
+     * Hashes are bit patterns and push a wrapped lua_Integer instead, so
+     * their type never depends on the value.
+     */
+    void luaX_pushull(lua_State *L, unsigned long long x);
+    long long luaX_checkll(lua_State *L, int index);
+    unsigned long long luaX_checkull(lua_State *L, int index);
+
     int luaopen_sevo_int(lua_State* L);
 
 #ifdef __cplusplus
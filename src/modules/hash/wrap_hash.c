@@ -32,9 +32,8 @@ static int mcl_hash_h64(lua_State * L) {
     size_t l = 0;
     const char *data = luaL_checklstring(L, 1, &l);
     int len = (int)luaL_optinteger(L, 2, (lua_Integer)l);
-    bigint_t *bi = new_bigint(L);
 
-    mpz_set_ull(bi->x, mc_hash64(data, len));
+    lua_pushinteger(L, (lua_Integer)mc_hash64(data, len));
     return 1;
 }
 
@@ -62,7 +61,6 @@ static int mcl_hash_m64(lua_State * L) {
     unsigned long long seed = 0;
     const char *data;
     int len;
-    bigint_t *bi;
 
     if (LUA_TNUMBER == lua_type(L, 1)) {
         seed = (unsigned long long)lua_tointeger(L, 1);
@@ -73,8 +71,7 @@ static int mcl_hash_m64(lua_State * L) {
         len = (int)luaL_optinteger(L, 2, (lua_Integer)l);
     }
 
-    bi = new_bigint(L);
-    mpz_set_ull(bi->x, mc_murmur64(data, len, seed));
+    lua_pushinteger(L, (lua_Integer)mc_murmur64(data, len, seed));
     return 1;
 }
 
@@ -148,11 +145,9 @@ static int mcl_hash_crc32(lua_State * L) {
 
 static int mcl_hash_crc64(lua_State * L) {
     size_t l = 0;
-    mpz_t mzi;
     unsigned long long c64;
     const char *data;
     int len, type1;
-    bigint_t *bi;
 
     if (0 == lua_gettop(L)) {
         lua_pushinteger(L, (lua_Integer)mc_crc64(0, NULL, -1, NULL));
@@ -162,8 +157,7 @@ static int mcl_hash_crc64(lua_State * L) {
     type1 = lua_type(L, 1);
 
     if ((LUA_TNUMBER == type1) || (LUA_TUSERDATA == type1)) {
-        luaX_checkmpz(L, 1, mzi);
-        c64 = mpz_get_ull(mzi);
+        c64 = luaX_checkull(L, 1);
         data = luaL_checklstring(L, 2, &l);
         len = (int)luaL_optinteger(L, 3, (lua_Integer)l);
     } else {
@@ -172,8 +166,7 @@ static int mcl_hash_crc64(lua_State * L) {
         len = (int)luaL_optinteger(L, 2, (lua_Integer)l);
     }
 
-    bi = new_bigint(L);
-    mpz_set_ull(bi->x, mc_crc64(c64, data, len, g_tbl_crc64));
+    lua_pushinteger(L, (lua_Integer)mc_crc64(c64, data, len, g_tbl_crc64));
     return 1;
 }
 
@@ -12,19 +12,10 @@
 
 static int mcl_id_init(lua_State * L) {
     long long epoch = -1;
-    int nodeid, top;
-    mpz_t ep;
+    int nodeid = (int)luaL_checkinteger(L, 1);
 
-    top = lua_gettop(L);
-    nodeid = (int)luaL_checkinteger(L, 1);
-
-    if (top > 1) {
-        mpz_init(ep);
-
-        luaX_checkmpz(L, 2, ep);
-        epoch = mpz_get_ll(ep);
-
-        mpz_clear(ep);
+    if (lua_gettop(L) > 1) {
+        epoch = luaX_checkll(L, 2);
     }
 
     mc_id_set(epoch, nodeid);
@@ -32,31 +23,22 @@ static int mcl_id_init(lua_State * L) {
     return 0;
 }
 
+/* Ids are positive 63-bit values, a plain integer holds them. */
 static int mcl_id_next(lua_State * L) {
-    bigint_t *bi = new_bigint(L);
-    mpz_set_ll(bi->x, mc_id(NULL));
+    lua_pushinteger(L, (lua_Integer)mc_id(NULL));
     return 1;
 }
 
 static int mcl_id_split(lua_State * L) {
-    bigint_t *bi = new_bigint(L);
     long long timestamp;
     int sequence, nodeid;
-    mpz_t id;
-
-    mpz_init(id);
 
-    luaX_checkmpz(L, 1, id);
-
-    mc_id_split(mpz_get_ll(id), &timestamp, &nodeid, &sequence);
-
-    mpz_set_ull(bi->x, timestamp);
+    mc_id_split(luaX_checkll(L, 1), &timestamp, &nodeid, &sequence);
 
+    lua_pushinteger(L, (lua_Integer)timestamp);
     lua_pushinteger(L, nodeid);
     lua_pushinteger(L, sequence);
 
-    mpz_clear(id);
-
     return 3;
 }
 
@@ -9,32 +9,95 @@
 
 #include "wrap_net.h"
 #include "modules/gmp/wrap_gmp.h"
+#include "modules/dbm/wrap_dbm.h"
+#include "modules/thread/wrap_thread.h"
+#include "common/netshard.h"
 #include <string.h>
 
 #ifdef _MSC_VER
 # define strcasecmp _stricmp
 #endif
 
+typedef struct mcl_peer_t mcl_peer_t;
+
+/* Output limits of a peer, high 0 leaves the peer unwatched. */
+typedef struct mcl_limits_t {
+    int         low;
+    int         high;
+    int         hard;
+    int         policy;
+} mcl_limits_t;
+
+/* Event raised by the binding itself, by peer index. */
+typedef struct mcl_note_t {
+    int         cmd;
+    lua_Integer index;
+} mcl_note_t;
+
 typedef struct mcl_net_t {
     mc_net_t    *net;
+    netpool_t   *pool;      /* set when the net runs on I/O threads */
+    channel_t   *inbox;     /* inbound channel of the owning worker */
     int         ref;
     int         peercnt;
+    mcl_peer_t  *corked;    /* peers flushed by update */
+    char        *scratch;   /* gather buffer of sendv */
+    int         scratchcap;
+    mcl_limits_t limits;    /* given to new peers */
+    mcl_peer_t  *watched;   /* peers over their high watermark */
+    mcl_note_t  *notes;
+    int         nnotes;
+    int         notehead;
+    int         notecap;
 } mcl_net_t;
 
-typedef struct mcl_peer_t {
+struct mcl_peer_t {
     mcl_net_t   *holder;
     mc_peer_t   *peer;
     lua_Integer index;
-} mcl_peer_t;
+    netshard_peer_t info;   /* pool peers, as of their last event */
+    int         corked;
+    char        *cork;      /* sends held until the next flush */
+    int         corklen;
+    int         corkcap;
+    mcl_peer_t  *prev;
+    mcl_peer_t  *next;
+    int         corkmsgs;
+    mcl_limits_t limits;
+    int         blocked;    /* over high, until back under low */
+    int         watching;
+    mcl_peer_t  *wprev;
+    mcl_peer_t  *wnext;
+};
+
+typedef struct mcl_group_t {
+    mcl_net_t   *holder;
+    mcl_peer_t  **members;
+    long long   *ids;       /* pool members of one send */
+    int         count;
+    int         capacity;
+} mcl_group_t;
 
 static const char g_meta_net[] = { CODE_NAME ".meta.net" };
 static const char g_meta_peer[] = { CODE_NAME ".meta.peer" };
+static const char g_meta_group[] = { CODE_NAME ".meta.group" };
+
+#define NET_BATCH               256
+#define NET_CORK_MAX            (64 * 1024)
+#define NET_INBOX_SLICE         10
 
+#define peer_limited(p)         (((p)->limits.high > 0) || ((p)->limits.hard > 0))
+
+enum {
+    NET_POLICY_DROP = 0,
+    NET_POLICY_CLOSE,
+};
 #define luaX_checknet(L, idx)   (mcl_net_t *)luaL_checkudata(L, idx, g_meta_net)
+#define luaX_checkgroup(L, idx) (mcl_group_t *)luaL_checkudata(L, idx, g_meta_group)
 
 static mcl_peer_t *luaX_checkpeer(lua_State *L, int index) {
     mcl_peer_t *p = (mcl_peer_t *)luaL_checkudata(L, index, g_meta_peer);
-    if (!p->peer) {
+    if (!p->peer && !p->info.id) {
         luaL_error(L, "Peer is already closed.");
         return NULL;
     }
@@ -44,11 +107,63 @@ static mcl_peer_t *luaX_checkpeer(lua_State *L, int index) {
 static int mcl_net__gc(lua_State *L) {
     mcl_net_t *n = luaX_checknet(L, -1);
     if (n) {
+        /* Peers may outlive the net, leave them closed and detached. */
+        lua_rawgeti(L, LUA_REGISTRYINDEX, n->ref);
+        if (lua_istable(L, -1)) {
+            lua_pushnil(L);
+            while (lua_next(L, -2)) {
+                mcl_peer_t *p = (mcl_peer_t *)luaL_testudata(L, -1, g_meta_peer);
+
+                if (p) {
+                    if (p->peer) {
+                        mc_net_set(p->peer, NULL);
+                        p->peer = NULL;
+                    }
+                    p->info.id = 0;
+                    p->holder = NULL;
+                }
+                lua_pop(L, 1);
+            }
+        }
+        lua_pop(L, 1);
+
+        while (n->corked) {
+            mcl_peer_t *p = n->corked;
+
+            n->corked = p->next;
+            p->corked = 0;
+            p->prev = p->next = NULL;
+        }
+
+        while (n->watched) {
+            mcl_peer_t *p = n->watched;
+
+            n->watched = p->wnext;
+            p->watching = 0;
+            p->wprev = p->wnext = NULL;
+        }
+
+        if (n->scratch) {
+            mc_free(n->scratch);
+            n->scratch = NULL;
+        }
+
+        if (n->notes) {
+            mc_free(n->notes);
+            n->notes = NULL;
+        }
+        n->nnotes = 0;
+
         if (n->net) {
             mc_net_destroy(n->net);
             n->net = NULL;
         }
 
+        if (n->pool) {
+            netpool_destroy(n->pool);
+            n->pool = NULL;
+        }
+
         luaL_unref(L, LUA_REGISTRYINDEX, n->ref);
         n->ref = LUA_NOREF;
     }
@@ -78,6 +193,15 @@ static mcl_peer_t *peer_new(lua_State *L, mcl_net_t *holder, mc_peer_t *peer) {
     p->holder = holder;
     p->peer = peer;
     p->index = (lua_Integer)mc_net_socket(peer);
+    memset(&p->info, 0, sizeof(p->info));
+    p->corked = 0;
+    p->cork = NULL;
+    p->corklen = p->corkcap = 0;
+    p->prev = p->next = NULL;
+    p->corkmsgs = 0;
+    p->limits = holder->limits;
+    p->blocked = p->watching = 0;
+    p->wprev = p->wnext = NULL;
 
     holder->peercnt += 1;
 
@@ -92,14 +216,290 @@ static mcl_peer_t *peer_new(lua_State *L, mcl_net_t *holder, mc_peer_t *peer) {
     return p;
 }
 
+/* Pool peers are keyed by id, their mc_peer_t lives on an I/O thread. */
+static mcl_peer_t *peer_wrap(lua_State *L, mcl_net_t *holder, netshard_peer_t *info) {
+    mcl_peer_t *p = (mcl_peer_t *)luaX_newuserdata(L, g_meta_peer, sizeof(mcl_peer_t));
+
+    p->holder = holder;
+    p->peer = NULL;
+    p->index = (lua_Integer)info->id;
+    p->info = *info;
+    p->corked = 0;
+    p->cork = NULL;
+    p->corklen = p->corkcap = 0;
+    p->prev = p->next = NULL;
+    p->corkmsgs = 0;
+    p->limits = holder->limits;
+    p->blocked = p->watching = 0;
+    p->wprev = p->wnext = NULL;
+
+    holder->peercnt += 1;
+
+    lua_rawgeti(L, LUA_REGISTRYINDEX, holder->ref);
+    lua_pushvalue(L, -2);
+    lua_rawseti(L, -2, p->index);
+    lua_pop(L, 1);  /* pop ref */
+
+    return p;
+}
+
+static int peer_post(mcl_peer_t *p, int op, const void *data, int size, unsigned long long value) {
+    if (!p->holder->pool) {
+        return -1;
+    }
+
+    /* Only a server has siblings on the other shards to close. */
+    if ((NETSHARD_CLOSE == op) && p->info.listener) {
+        return netpool_close_server(p->holder->pool, p->info.id);
+    }
+    return netpool_post(p->holder->pool, p->info.id, op, data, size, value);
+}
+
+/* Sends one message, -1 once the peer is gone. */
+static int peer_write(mcl_peer_t *p, const void *data, int len) {
+    if (p->peer) {
+        return mc_net_send(p->peer, data, len);
+    }
+    if (p->info.id) {
+        return peer_post(p, NETSHARD_SEND, data, len, 0);
+    }
+    return -1;
+}
+
+static int peer_flush(mcl_peer_t *p) {
+    int r = 0;
+
+    if (p->corklen > 0) {
+        r = peer_write(p, p->cork, p->corklen);
+        p->corklen = 0;
+        p->corkmsgs = 0;
+    }
+    return r;
+}
+
+/* Grows the cork buffer for len more bytes, which must fit under NET_CORK_MAX. */
+static void peer_reserve(mcl_peer_t *p, int len) {
+    if (p->corklen + len > p->corkcap) {
+        p->corkcap = MC_MIN(MC_MAX(p->corkcap * 2, p->corklen + len), NET_CORK_MAX);
+        p->cork = (char *)mc_realloc(p->cork, p->corkcap);
+    }
+}
+
+/* Appends to the cork buffer, flushing first when it would overflow. */
+static int peer_queue(mcl_peer_t *p, const char *data, int len) {
+    int r = 0;
+
+    if (p->corklen + len > NET_CORK_MAX) {
+        r = peer_flush(p);
+
+        if (len >= NET_CORK_MAX) {
+            return (0 == r) ? peer_write(p, data, len) : r;
+        }
+    }
+
+    peer_reserve(p, len);
+    memcpy(p->cork + p->corklen, data, len);
+    p->corklen += len;
+    p->corkmsgs += 1;
+
+    return r;
+}
+
+static void peer_uncork(mcl_peer_t *p) {
+    mcl_net_t *n = p->holder;
+
+    if (!p->corked) {
+        return;
+    }
+
+    if (p->prev) {
+        p->prev->next = p->next;
+    } else {
+        n->corked = p->next;
+    }
+
+    if (p->next) {
+        p->next->prev = p->prev;
+    }
+
+    p->corked = 0;
+    p->prev = p->next = NULL;
+}
+
+/*
+ * Bytes the kernel still holds for the socket. mc_net only buffers in
+ * user space once this is full and that buffer cannot be seen, so the
+ * queue of a direct peer never grows past the socket buffer size and
+ * its limits must stay under it. UDP peers of one server share its
+ * socket and so its queue. Pool peers add what their shard has not
+ * sent yet, the shard reads their socket.
+ */
+static int peer_queued(mcl_peer_t *p) {
+    if (p->peer) {
+        return p->corklen + netshard_outq(mc_net_socket(p->peer));
+    }
+    if (p->info.id) {
+        return p->corklen + netpool_queued(p->holder->pool, p->info.id);
+    }
+    return p->corklen;
+}
+
+static void net_note(mcl_net_t *n, int cmd, lua_Integer index) {
+    if (n->nnotes == n->notecap) {
+        int i, cap = MC_MAX(n->notecap * 2, 16);
+        mcl_note_t *notes = (mcl_note_t *)mc_malloc(cap * sizeof(mcl_note_t));
+
+        for (i = 0; i < n->nnotes; ++i) {
+            notes[i] = n->notes[(n->notehead + i) % n->notecap];
+        }
+
+        if (n->notes) {
+            mc_free(n->notes);
+        }
+
+        n->notes = notes;
+        n->notehead = 0;
+        n->notecap = cap;
+    }
+
+    n->notes[(n->notehead + n->nnotes) % n->notecap].cmd = cmd;
+    n->notes[(n->notehead + n->nnotes) % n->notecap].index = index;
+    n->nnotes += 1;
+}
+
+static void peer_unwatch(mcl_peer_t *p) {
+    mcl_net_t *n = p->holder;
+
+    if (!p->watching) {
+        return;
+    }
+
+    if (p->wprev) {
+        p->wprev->wnext = p->wnext;
+    } else {
+        n->watched = p->wnext;
+    }
+
+    if (p->wnext) {
+        p->wnext->wprev = p->wprev;
+    }
+
+    p->watching = 0;
+    p->wprev = p->wnext = NULL;
+}
+
+/* Marks the peer blocked once queued, its queue after a send, reaches high. */
+static void peer_check(mcl_peer_t *p, int queued) {
+    mcl_net_t *n = p->holder;
+
+    if ((p->limits.high <= 0) || p->blocked || (queued < p->limits.high)) {
+        return;
+    }
+
+    p->blocked = 1;
+
+    if (!p->watching) {
+        p->watching = 1;
+        p->wprev = NULL;
+        p->wnext = n->watched;
+
+        if (n->watched) {
+            n->watched->wprev = p;
+        }
+        n->watched = p;
+    }
+}
+
+/* Applies the hard limit to len more bytes on top of queued, 0 refuses them. */
+static int peer_admit(mcl_peer_t *p, int queued, int len) {
+    if ((p->limits.hard <= 0) || (queued + len <= p->limits.hard)) {
+        return 1;
+    }
+
+    if (NET_POLICY_CLOSE == p->limits.policy) {
+        if (p->peer) {
+            mc_net_close(p->peer);
+        } else {
+            peer_post(p, NETSHARD_CLOSE, NULL, 0, 0);
+        }
+    }
+    return 0;
+}
+
+/*
+ * Sends or corks one message under the peer's limits. The queue is read
+ * once, the message then counts as queued on top of it.
+ */
+static int peer_output(mcl_peer_t *p, const char *data, int len) {
+    int r, queued = 0;
+
+    if (peer_limited(p)) {
+        queued = peer_queued(p);
+        if (!peer_admit(p, queued, len)) {
+            return -1;
+        }
+    }
+
+    r = p->corked ? peer_queue(p, data, len) : peer_write(p, data, len);
+
+    if ((0 == r) && peer_limited(p)) {
+        peer_check(p, queued + len);
+    }
+    return r;
+}
+
+/*
+ * low, high, [hard], [policy] at idx, high 0 turns watching off. A
+ * sndbuf above 0 caps high and hard, the queue cannot grow past it.
+ */
+static void check_limits(lua_State *L, int idx, mcl_limits_t *limits, int sndbuf) {
+    static const char *policies[] = { "drop", "close", NULL };
+
+    limits->low = (int)luaL_checkinteger(L, idx);
+    limits->high = (int)luaL_checkinteger(L, idx + 1);
+    limits->hard = (int)luaL_optinteger(L, idx + 2, 0);
+    limits->policy = luaL_checkoption(L, idx + 3, "drop", policies);
+
+    luaL_argcheck(L, (limits->low >= 0) && (limits->low <= limits->high), idx, "Expected 0 <= low <= high");
+    luaL_argcheck(L, (limits->hard <= 0) || (limits->hard >= limits->high), idx + 2, "Expected hard >= high");
+
+    if (sndbuf > 0) {
+        luaL_argcheck(L, limits->high < sndbuf, idx + 1, "Expected high below the socket send buffer");
+        luaL_argcheck(L, limits->hard < sndbuf, idx + 2, "Expected hard below the socket send buffer");
+    }
+}
+
+/*
+ * net:watermark(low, high, [hard], [policy]) for peers made from now on.
+ * On a direct net keep them under the socket send buffer, see peer_queued.
+ */
+static int mcl_net_watermark(lua_State *L) {
+    mcl_net_t *n = luaX_checknet(L, 1);
+    check_limits(L, 2, &n->limits, 0);
+    return 0;
+}
+
+/* Pool servers also return how many I/O threads listen. */
 static int mcl_net_server(lua_State *L) {
     mcl_net_t *n = luaX_checknet(L, 1);
     const char *mode = luaL_checkstring(L, 2);
     const char *host = luaL_checkstring(L, 3);
     unsigned short port = (unsigned short)luaL_checkinteger(L, 4);
     int backlog = (int)luaL_optinteger(L, 5, -1);
+    netshard_peer_t info;
+    int shards = 0;
     mc_peer_t *s;
 
+    if (n->pool) {
+        if (netpool_server(n->pool, net_mode(L, mode), host, port, backlog, &info, &shards)) {
+            peer_wrap(L, n, &info);
+            lua_pushinteger(L, shards);
+            return 2;
+        }
+        lua_pushnil(L);
+        return 1;
+    }
+
     s = mc_net_server(n->net, net_mode(L, mode), host, port, backlog);
 
     if (s) {
@@ -115,8 +515,18 @@ static int mcl_net_connect(lua_State *L) {
     const char *mode = luaL_checkstring(L, 2);
     const char *host = luaL_checkstring(L, 3);
     unsigned short port = (unsigned short)luaL_checkinteger(L, 4);
+    netshard_peer_t info;
     mc_peer_t *c;
 
+    if (n->pool) {
+        if (netpool_connect(n->pool, net_mode(L, mode), host, port, &info)) {
+            peer_wrap(L, n, &info);
+        } else {
+            lua_pushnil(L);
+        }
+        return 1;
+    }
+
     c = mc_net_connect(n->net, net_mode(L, mode), host, port);
 
     if (c) {
@@ -133,24 +543,203 @@ static int mcl_net_timeout(lua_State *L) {
     int timeout = (int)luaL_checkinteger(L, 3);
 
     if ((0 == strcasecmp(ty, "conn")) || (0 == strcasecmp(ty, "connect"))) {
-        lua_pushinteger(L, mc_net_conn_timeout(n->net, timeout));
+        lua_pushinteger(L, n->pool ? netpool_conn_timeout(n->pool, timeout) : mc_net_conn_timeout(n->net, timeout));
         return 1;
     }
 
     if ((0 == strcasecmp(ty, "auth")) || (0 == strcasecmp(ty, "authenticate"))) {
-        lua_pushinteger(L, mc_net_auth_timeout(n->net, timeout));
+        lua_pushinteger(L, n->pool ? netpool_auth_timeout(n->pool, timeout) : mc_net_auth_timeout(n->net, timeout));
         return 1;
     }
 
     return luaL_error(L, "Invalid operand. Expected 'conn' or 'connect', 'auth' or 'authenticate'");
 }
 
-static int mcl_net_receive(lua_State *L) {
-    mcl_net_t *n = luaX_checknet(L, 1);
+/* Event kinds as seen from Lua, indexes into the interned name table. */
+enum {
+    CMD_INCOMING = 1,
+    CMD_CONN_TIMEOUT,
+    CMD_UNAUTH,
+    CMD_HALO,
+    CMD_AUTH,
+    CMD_ACCEPTED,
+    CMD_REJECTED,
+    CMD_PING,
+    CMD_PONG,
+    CMD_OUTGOING,
+    CMD_DATA,
+    CMD_WRITABLE,
+    CMD_DRAINED,
+    CMD_NUM
+};
+
+static const char *g_cmd_names[CMD_NUM] = {
+    NULL, "incoming", "conn-timeout", "unauth", "halo", "auth",
+    "accepted", "rejected", "ping", "pong", "outgoing", "data",
+    "writable", "drained",
+};
+
+/* Field carrying the event value, if any. */
+static const char *g_cmd_fields[CMD_NUM] = {
+    NULL, NULL, NULL, NULL, "protover", "passwd",
+    "welcome", "reason", "time", "time", NULL, "data",
+    NULL, NULL,
+};
+
+/* Commands of events made from notes, clear of mc_net's own. */
+#define NET_EV_WRITABLE         (-1)
+#define NET_EV_DRAINED          (-2)
+
+/* Registry key of the interned names, [index] = name and [name] = index. */
+static const char g_cmds_key = 0;
+
+static int net_cmd(mc_net_event_t *evt) {
+    switch (evt->command) {
+    case MC_NET_INCOMING:           return CMD_INCOMING;
+    case MC_NET_CONNECT_TIMEOUT:    return CMD_CONN_TIMEOUT;
+    case MC_NET_UNAUTHORIZED:       return CMD_UNAUTH;
+    case MC_NET_HALO:               return CMD_HALO;
+    case MC_NET_AUTH:               return CMD_AUTH;
+    case MC_NET_ACCEPTED:           return CMD_ACCEPTED;
+    case MC_NET_REJECTED:           return CMD_REJECTED;
+    case MC_NET_PING:               return CMD_PING;
+    case MC_NET_PONG:               return CMD_PONG;
+    case MC_NET_OUTGOING:           return CMD_OUTGOING;
+    case MC_NET_DATA:               return CMD_DATA;
+    case NET_EV_WRITABLE:           return CMD_WRITABLE;
+    case NET_EV_DRAINED:            return CMD_DRAINED;
+    }
+    return 0;
+}
+
+static void push_cmd(lua_State *L, int cmd) {
+    lua_rawgetp(L, LUA_REGISTRYINDEX, &g_cmds_key);
+    lua_rawgeti(L, -1, cmd);
+    lua_remove(L, -2);
+}
+
+/* Pushes the value of the event field, returns 0 if it has none. */
+static int push_value(lua_State *L, int cmd, mc_net_event_t *evt) {
+    switch (cmd) {
+    case CMD_HALO:
+        lua_pushinteger(L, evt->halo.proto_version);
+        return 1;
+    case CMD_AUTH:
+        lua_pushstring(L, evt->auth.passwd);
+        return 1;
+    case CMD_ACCEPTED:
+        lua_pushstring(L, evt->accepted.welcome);
+        return 1;
+    case CMD_REJECTED:
+        lua_pushstring(L, evt->rejected.reason);
+        return 1;
+    case CMD_PING:
+        luaX_pushull(L, evt->ping.timestamp);
+        return 1;
+    case CMD_PONG:
+        luaX_pushull(L, evt->pong.timestamp);
+        return 1;
+    case CMD_DATA:
+        lua_pushlstring(L, (const char *)evt->data.ptr, evt->data.size);
+        return 1;
+    }
+    return 0;
+}
+
+/* Pushes the peer table of the net, held on the stack while draining. */
+static int push_peers(lua_State *L, mcl_net_t *n) {
+    lua_rawgeti(L, LUA_REGISTRYINDEX, n->ref);
+    return lua_gettop(L);
+}
+
+/* Pool form of net_next, deleted peers are dropped from the table here. */
+static mc_net_event_t *pool_next(lua_State *L, mcl_net_t *n, mcl_peer_t **pp) {
+    mc_net_event_t *evt = NULL;
+    netshard_event_t *e;
+    mcl_peer_t *p = NULL;
+    int peers = push_peers(L, n);
+
+    while (1 == netpool_recv(n->pool, &e, 1, 0)) {
+        lua_rawgeti(L, peers, (lua_Integer)e->peer.id);
+        p = (mcl_peer_t *)lua_touserdata(L, -1);
+        lua_pop(L, 1);
+
+        if (!e->evt) {
+            if (p) {
+                p->info.id = 0;
+                p->info.status = NETSHARD_CLOSED;
+
+                lua_pushnil(L);
+                lua_rawseti(L, peers, p->index);
+
+                peer_uncork(p);
+                peer_unwatch(p);
+                p->holder->peercnt -= 1;
+                p->holder = NULL;
+            }
+            netpool_free(e);
+            continue;
+        }
+
+        if (!p) {
+            int known = e->peer.parent && (LUA_TNIL != lua_rawgeti(L, peers, (lua_Integer)e->peer.parent));
+
+            if (e->peer.parent) {
+                lua_pop(L, 1);  /* pop parent */
+            }
+
+            if (!known) {
+                netpool_post(n->pool, e->peer.id, NETSHARD_CLOSE, NULL, 0, 0);
+                netpool_free(e);
+                continue;
+            }
+
+            p = peer_wrap(L, n, &e->peer);
+            lua_pop(L, 1);  /* pop peer */
+        } else {
+            p->info = e->peer;
+        }
+
+        evt = e->evt;
+        mc_free(e);
+        break;
+    }
+
+    lua_remove(L, peers);
+
+    *pp = evt ? p : NULL;
+    return evt;
+}
+
+/* Next event for a live peer, wrapping new connections on the way. */
+static mc_net_event_t *net_next(lua_State *L, mcl_net_t *n, mcl_peer_t **pp) {
     mc_net_event_t *evt;
     mc_peer_t *parent;
     mcl_peer_t *p;
-    bigint_t *bi;
+
+    /* Notes come first, they were raised by the last update. */
+    while (n->nnotes > 0) {
+        mcl_note_t note = n->notes[n->notehead];
+
+        n->notehead = (n->notehead + 1) % n->notecap;
+        n->nnotes -= 1;
+
+        lua_rawgeti(L, LUA_REGISTRYINDEX, n->ref);
+        lua_rawgeti(L, -1, note.index);
+        p = (mcl_peer_t *)luaL_testudata(L, -1, g_meta_peer);
+        lua_pop(L, 2);
+
+        if (p) {
+            evt = (mc_net_event_t *)mc_calloc(1, sizeof(mc_net_event_t));
+            evt->command = note.cmd;
+            *pp = p;
+            return evt;
+        }
+    }
+
+    if (n->pool) {
+        return pool_next(L, n, pp);
+    }
 
     while (!!(evt = mc_net_recv(n->net))) {
         p = (mcl_peer_t *)mc_net_get(evt->peer);
@@ -184,105 +773,267 @@ static int mcl_net_receive(lua_State *L) {
         break;
     }
 
+    *pp = evt ? p : NULL;
+    return evt;
+}
+
+/* Overwrites cmd, who and the value field, clearing the previous one. */
+static void fill_event(lua_State *L, int idx, int peers, int cmd, mcl_peer_t *p, mc_net_event_t *evt) {
+    lua_rawgetp(L, LUA_REGISTRYINDEX, &g_cmds_key);
+    lua_getfield(L, idx, "cmd");
+    lua_rawget(L, -2);
+
+    if (lua_isinteger(L, -1)) {
+        int last = (int)lua_tointeger(L, -1);
+
+        if ((last > 0) && (last < CMD_NUM) && g_cmd_fields[last]) {
+            lua_pushnil(L);
+            lua_setfield(L, idx, g_cmd_fields[last]);
+        }
+    }
+
+    lua_rawgeti(L, -2, cmd);
+    lua_setfield(L, idx, "cmd");
+    lua_pop(L, 2);  /* pop last, names */
+
+    if (push_value(L, cmd, evt)) {
+        lua_setfield(L, idx, g_cmd_fields[cmd]);
+    }
+
+    lua_rawgeti(L, peers, p->index);
+    lua_setfield(L, idx, "who");
+}
+
+/*
+ * net:receive() returns a new event table, net:receive(e) refills e and
+ * returns it so a loop can reuse one table for every event.
+ */
+static int mcl_net_receive(lua_State *L) {
+    mcl_net_t *n = luaX_checknet(L, 1);
+    mc_net_event_t *evt;
+    mcl_peer_t *p;
+    int peers;
+
+    evt = net_next(L, n, &p);
+
     if (!evt) {
         lua_pushnil(L);
         return 1;
     }
 
-    lua_createtable(L, 0, 3);
+    peers = push_peers(L, n);
 
-    switch (evt->command) {
-    case MC_NET_INCOMING:
-        lua_pushliteral(L, "incoming");
-        lua_setfield(L, -2, "cmd");
-        break;
-    case MC_NET_CONNECT_TIMEOUT:
-        lua_pushliteral(L, "conn-timeout");
-        lua_setfield(L, -2, "cmd");
-        break;
-    case MC_NET_UNAUTHORIZED:
-        lua_pushliteral(L, "unauth");
-        lua_setfield(L, -2, "cmd");
-        break;
-    case MC_NET_HALO:
-        lua_pushliteral(L, "halo");
-        lua_setfield(L, -2, "cmd");
-
-        lua_pushinteger(L, evt->halo.proto_version);
-        lua_setfield(L, -2, "protover");
-        break;
-    case MC_NET_AUTH:
-        lua_pushliteral(L, "auth");
-        lua_setfield(L, -2, "cmd");
-
-        lua_pushstring(L, evt->auth.passwd);
-        lua_setfield(L, -2, "passwd");
-        break;
-    case MC_NET_ACCEPTED:
-        lua_pushliteral(L, "accepted");
-        lua_setfield(L, -2, "cmd");
+    if (lua_istable(L, 2)) {
+        lua_pushvalue(L, 2);
+    } else {
+        lua_createtable(L, 0, 3);
+    }
 
-        lua_pushstring(L, evt->accepted.welcome);
-        lua_setfield(L, -2, "welcome");
-        break;
-    case MC_NET_REJECTED:
-        lua_pushliteral(L, "rejected");
-        lua_setfield(L, -2, "cmd");
+    fill_event(L, lua_gettop(L), peers, net_cmd(evt), p, evt);
 
-        lua_pushstring(L, evt->rejected.reason);
-        lua_setfield(L, -2, "reason");
-        break;
-    case MC_NET_PING:
-        lua_pushliteral(L, "ping");
-        lua_setfield(L, -2, "cmd");
+    mc_free(evt);
+    return 1;
+}
 
-        bi = new_bigint(L);
-        mpz_set_ull(bi->x, evt->ping.timestamp);
-        lua_setfield(L, -2, "time");
-        break;
-    case MC_NET_PONG:
-        lua_pushliteral(L, "pong");
-        lua_setfield(L, -2, "cmd");
+/* Table free form: returns cmd, who and the event value, nil when idle. */
+static int mcl_net_next(lua_State *L) {
+    mcl_net_t *n = luaX_checknet(L, 1);
+    mc_net_event_t *evt;
+    mcl_peer_t *p;
+    int cmd;
 
-        bi = new_bigint(L);
-        mpz_set_ull(bi->x, evt->pong.timestamp);
-        lua_setfield(L, -2, "time");
-        break;
-    case MC_NET_OUTGOING:
-        lua_pushliteral(L, "outgoing");
-        lua_setfield(L, -2, "cmd");
-        break;
-    case MC_NET_DATA:
-        lua_pushliteral(L, "data");
-        lua_setfield(L, -2, "cmd");
+    evt = net_next(L, n, &p);
 
-        lua_pushlstring(L, (const char *)evt->data.ptr, evt->data.size);
-        lua_setfield(L, -2, "data");
-        break;
+    if (!evt) {
+        lua_pushnil(L);
+        return 1;
     }
 
-    lua_rawgeti(L, LUA_REGISTRYINDEX, p->holder->ref);
+    cmd = net_cmd(evt);
+
+    push_cmd(L, cmd);
+    push_peers(L, n);
     lua_rawgeti(L, -1, p->index);
-    lua_setfield(L, -3, "who");
-    lua_pop(L, 1);  /* pop ref */
+    lua_remove(L, -2);
+
+    if (!push_value(L, cmd, evt)) {
+        lua_pushnil(L);
+    }
 
     mc_free(evt);
+    return 3;
+}
+
+/*
+ * Drains up to max events into an array of event tables, refilling the
+ * tables of a passed array. Returns the array and the count, the entry
+ * after the last event is cleared so ipairs stops there.
+ */
+static int mcl_net_receive_batch(lua_State *L) {
+    mcl_net_t *n = luaX_checknet(L, 1);
+    int max = (int)luaL_optinteger(L, 2, NET_BATCH);
+    mc_net_event_t *evt;
+    mcl_peer_t *p;
+    int peers, events, count = 0;
+
+    if (lua_istable(L, 3)) {
+        lua_settop(L, 3);
+    } else {
+        lua_settop(L, 2);
+        lua_createtable(L, MC_MIN(MC_MAX(max, 0), NET_BATCH), 0);
+    }
+
+    events = lua_gettop(L);
+    peers = push_peers(L, n);
+
+    while ((count < max) && !!(evt = net_next(L, n, &p))) {
+        count += 1;
+
+        if (LUA_TTABLE != lua_rawgeti(L, events, count)) {
+            lua_pop(L, 1);
+            lua_createtable(L, 0, 3);
+            lua_pushvalue(L, -1);
+            lua_rawseti(L, events, count);
+        }
+
+        fill_event(L, lua_gettop(L), peers, net_cmd(evt), p, evt);
+        lua_pop(L, 1);  /* pop event */
+
+        mc_free(evt);
+    }
+
+    lua_pushnil(L);
+    lua_rawseti(L, events, count + 1);
+
+    lua_pushvalue(L, events);
+    lua_pushinteger(L, count);
+    return 2;
+}
+
+/*
+ * Drains up to max events calling handlers[cmd](who, value) for each,
+ * events without a handler are dropped. Returns the count drained.
+ */
+static int mcl_net_dispatch(lua_State *L) {
+    mcl_net_t *n = luaX_checknet(L, 1);
+    int max = (int)luaL_optinteger(L, 3, NET_BATCH);
+    mc_net_event_t *evt;
+    mcl_peer_t *p;
+    int peers, names, cmd, count = 0;
+
+    luaL_checktype(L, 2, LUA_TTABLE);
+    lua_settop(L, 2);
+
+    peers = push_peers(L, n);
+    lua_rawgetp(L, LUA_REGISTRYINDEX, &g_cmds_key);
+    names = lua_gettop(L);
+
+    while ((count < max) && !!(evt = net_next(L, n, &p))) {
+        count += 1;
+        cmd = net_cmd(evt);
+
+        lua_rawgeti(L, names, cmd);
+
+        if (LUA_TNIL == lua_gettable(L, 2)) {
+            lua_pop(L, 1);
+            mc_free(evt);
+            continue;
+        }
+
+        lua_rawgeti(L, peers, p->index);
+
+        if (!push_value(L, cmd, evt)) {
+            lua_pushnil(L);
+        }
+
+        /* The event is copied out, a raising handler can't leak it. */
+        mc_free(evt);
+
+        lua_call(L, 2, 0);
+    }
+
+    lua_pushinteger(L, count);
     return 1;
 }
 
 static int mcl_net_update(lua_State *L) {
     mcl_net_t *n = luaX_checknet(L, 1);
     unsigned int timeout = (unsigned int)luaL_optinteger(L, 2, 0);
+    mcl_peer_t *p, *next;
+
+    /* Corked peers send what they gathered since the last update. */
+    for (p = n->corked; p; p = p->next) {
+        peer_flush(p);
+    }
+
+    /* Blocked peers report going under low, then being empty. */
+    for (p = n->watched; p; p = next) {
+        int queued;
+
+        next = p->wnext;
+
+        if (!p->peer && !p->info.id) {
+            peer_unwatch(p);
+            continue;
+        }
+
+        queued = peer_queued(p);
+
+        if (p->blocked && (queued <= p->limits.low)) {
+            p->blocked = 0;
+            net_note(n, NET_EV_WRITABLE, p->index);
+        }
+
+        if (!p->blocked && (0 == queued)) {
+            peer_unwatch(p);
+            net_note(n, NET_EV_DRAINED, p->index);
+        }
+    }
+
+    /*
+     * The I/O threads do the work, only wait for their events. In a
+     * worker they also kick its inbound channel, so sleep there and a
+     * message ends the wait as well.
+     */
+    if (n->pool) {
+        if (!n->inbox) {
+            netpool_wait(n->pool, timeout);
+        } else if (!netpool_wait(n->pool, 0)) {
+            channel_wait(n->inbox, timeout);
+        }
+        lua_pushboolean(L, 1);
+        return 1;
+    }
+
+    /* A direct net cannot be woken by a message, only wait a slice. */
+    if (n->inbox) {
+        timeout = MC_MIN(timeout, NET_INBOX_SLICE);
+    }
+
     lua_pushboolean(L, 0 == mc_net_update(n->net, timeout));
     return 1;
 }
 
 static int mcl_peer__gc(lua_State *L) {
-    mcl_peer_t *p = luaX_checkpeer(L, -1);
+    mcl_peer_t *p = (mcl_peer_t *)luaL_checkudata(L, -1, g_meta_peer);
     if (p) {
+        peer_uncork(p);
+        peer_unwatch(p);
+
+        if (p->cork) {
+            mc_free(p->cork);
+            p->cork = NULL;
+        }
+
+        if (!p->holder) {
+            return 0;
+        }
+
         if (p->peer) {
             mc_net_set(p->peer, NULL);
             mc_net_close(p->peer);
+        } else if (p->info.id) {
+            peer_post(p, NETSHARD_CLOSE, NULL, 0, 0);
         }
 
         lua_rawgeti(L, LUA_REGISTRYINDEX, p->holder->ref);
@@ -305,7 +1056,11 @@ static int mcl_peer_addr(lua_State *L) {
 
     if (0 == strcasecmp(ty, "hwaddr") ||
         0 == strcasecmp(ty, "macaddr")) {
-        mc_net_hwaddr(p->peer, hw);
+        if (p->peer) {
+            mc_net_hwaddr(p->peer, hw);
+        } else {
+            memcpy(hw, p->info.hwaddr, MC_HWADDR_LEN);
+        }
 
         mc_byte2hex(hw[0], hwaddr + 0); hwaddr[2] = ':';
         mc_byte2hex(hw[1], hwaddr + 3); hwaddr[5] = ':';
@@ -319,7 +1074,7 @@ static int mcl_peer_addr(lua_State *L) {
     }
 
     if (0 == strcasecmp(ty, "local")) {
-        mc_socket_sockname(mc_net_socket(p->peer), &ss);
+        mc_socket_sockname(p->peer ? mc_net_socket(p->peer) : p->info.fd, &ss);
         mc_addr_info(&addr, &ss);
 
         lua_pushstring(L, addr.addr);
@@ -328,7 +1083,7 @@ static int mcl_peer_addr(lua_State *L) {
     }
 
     if (0 == strcasecmp(ty, "remote")) {
-        mc_socket_peername(mc_net_socket(p->peer), &ss);
+        mc_socket_peername(p->peer ? mc_net_socket(p->peer) : p->info.fd, &ss);
         mc_addr_info(&addr, &ss);
 
         lua_pushstring(L, addr.addr);
@@ -341,7 +1096,7 @@ static int mcl_peer_addr(lua_State *L) {
 
 static int mcl_peer_mode(lua_State *L) {
     mcl_peer_t *p = luaX_checkpeer(L, 1);
-    int type = mc_net_type(p->peer);
+    int type = p->peer ? mc_net_type(p->peer) : p->info.type;
 
     if (MC_NET_TCP == type) {
         lua_pushliteral(L, "tcp");
@@ -356,7 +1111,7 @@ static int mcl_peer_mode(lua_State *L) {
 
 static int mcl_peer_close(lua_State *L) {
     mcl_peer_t *p = luaX_checkpeer(L, 1);
-    lua_pushboolean(L, 0 == mc_net_close(p->peer));
+    lua_pushboolean(L, 0 == (p->peer ? mc_net_close(p->peer) : peer_post(p, NETSHARD_CLOSE, NULL, 0, 0)));
     return 1;
 }
 
@@ -366,7 +1121,7 @@ static int mcl_peer_auth(lua_State *L) {
     const char *passwd = luaL_checklstring(L, 2, &l);
     int len = (int)luaL_optinteger(L, 3, (lua_Integer)l);
 
-    lua_pushboolean(L, 0 == mc_net_auth(p->peer, passwd, len));
+    lua_pushboolean(L, 0 == (p->peer ? mc_net_auth(p->peer, passwd, len) : peer_post(p, NETSHARD_AUTH, passwd, len, 0)));
     return 1;
 }
 
@@ -376,7 +1131,7 @@ static int mcl_peer_accept(lua_State *L) {
     const char *welcome = luaL_checklstring(L, 2, &l);
     int len = (int)luaL_optinteger(L, 3, (lua_Integer)l);
 
-    lua_pushboolean(L, 0 == mc_net_accept(p->peer, welcome, len));
+    lua_pushboolean(L, 0 == (p->peer ? mc_net_accept(p->peer, welcome, len) : peer_post(p, NETSHARD_ACCEPT, welcome, len, 0)));
     return 1;
 }
 
@@ -386,45 +1141,194 @@ static int mcl_peer_reject(lua_State *L) {
     const char *reason = luaL_checklstring(L, 2, &l);
     int len = (int)luaL_optinteger(L, 3, (lua_Integer)l);
 
-    lua_pushboolean(L, 0 == mc_net_reject(p->peer, reason, len));
+    lua_pushboolean(L, 0 == (p->peer ? mc_net_reject(p->peer, reason, len) : peer_post(p, NETSHARD_REJECT, reason, len, 0)));
     return 1;
 }
 
 static int mcl_peer_ping(lua_State *L) {
     mcl_peer_t *p = luaX_checkpeer(L, 1);
-    mpz_t ts;
+    unsigned long long t = luaX_checkull(L, 2);
 
-    mpz_init(ts);
+    lua_pushboolean(L, 0 == (p->peer ? mc_net_ping(p->peer, t) : peer_post(p, NETSHARD_PING, NULL, 0, t)));
+    return 1;
+}
 
-    luaX_checkmpz(L, 2, ts);
-    lua_pushboolean(L, 0 == mc_net_ping(p->peer, mpz_get_ull(ts)));
+static int mcl_peer_pong(lua_State *L) {
+    mcl_peer_t *p = luaX_checkpeer(L, 1);
+    unsigned long long t = luaX_checkull(L, 2);
 
-    mpz_clear(ts);
+    lua_pushboolean(L, 0 == (p->peer ? mc_net_pong(p->peer, t) : peer_post(p, NETSHARD_PONG, NULL, 0, t)));
+    return 1;
+}
+
+/* Strings, or dbm views sent straight out of the map. */
+static const char *net_checkbytes(lua_State *L, int idx, size_t *l) {
+    const char *data = luaX_toview(L, idx, l);
+    return data ? data : luaL_checklstring(L, idx, l);
+}
 
+static int mcl_peer_send(lua_State *L) {
+    mcl_peer_t *p = luaX_checkpeer(L, 1);
+    size_t l = 0;
+    const char *data = net_checkbytes(L, 2, &l);
+    int len = (int)luaL_optinteger(L, 3, (lua_Integer)l);
+
+    luaL_argcheck(L, len >= 0 && (size_t)len <= l, 3, "Invalid length");
+
+    lua_pushboolean(L, 0 == peer_output(p, data, len));
     return 1;
 }
 
-static int mcl_peer_pong(lua_State *L) {
+/* Copies items 1..count of the table at 2 to dst, checked by the caller. */
+static void net_gather(lua_State *L, lua_Integer count, char *dst) {
+    lua_Integer i;
+    size_t l;
+    const char *s;
+
+    for (i = 1; i <= count; ++i) {
+        lua_rawgeti(L, 2, i);
+        s = net_checkbytes(L, -1, &l);
+        memcpy(dst, s, l);
+        dst += l;
+        lua_pop(L, 1);
+    }
+}
+
+/*
+ * peer:sendv({ s1, s2, ... }) sends the strings (or dbm views) as one
+ * message, gathered in C so Lua never builds the concatenation.
+ */
+static int mcl_peer_sendv(lua_State *L) {
     mcl_peer_t *p = luaX_checkpeer(L, 1);
-    mpz_t ts;
+    mcl_net_t *n = p->holder;
+    lua_Integer i, count;
+    size_t l, total = 0;
+    int r = 0, queued = 0;
+
+    luaL_checktype(L, 2, LUA_TTABLE);
+    count = (lua_Integer)lua_rawlen(L, 2);
+
+    for (i = 1; i <= count; ++i) {
+        lua_rawgeti(L, 2, i);
+        if (!lua_isstring(L, -1) && !luaX_toview(L, -1, &l)) {
+            return luaL_error(L, "Invalid operand. Item %d is not a string", (int)i);
+        }
+        net_checkbytes(L, -1, &l);
+        total += l;
+        lua_pop(L, 1);
+    }
 
-    mpz_init(ts);
+    luaL_argcheck(L, total <= 0x7FFFFFFF, 2, "Message too large");
 
-    luaX_checkmpz(L, 2, ts);
-    lua_pushboolean(L, 0 == mc_net_pong(p->peer, mpz_get_ull(ts)));
+    if (peer_limited(p)) {
+        queued = peer_queued(p);
+        if (!peer_admit(p, queued, (int)total)) {
+            lua_pushboolean(L, 0);
+            return 1;
+        }
+    }
+
+    if (0 == total) {
+        lua_pushboolean(L, 1);
+        return 1;
+    }
+
+    /* A corked list is one message, so it never straddles a flush. */
+    if (p->corked && (p->corklen + (int)total > NET_CORK_MAX)) {
+        r = peer_flush(p);
+    }
+
+    if ((0 == r) && p->corked && ((int)total < NET_CORK_MAX)) {
+        peer_reserve(p, (int)total);
+        net_gather(L, count, p->cork + p->corklen);
+        p->corklen += (int)total;
+        p->corkmsgs += 1;
+    } else if (0 == r) {
+        if ((int)total > n->scratchcap) {
+            n->scratchcap = MC_MAX((int)total, 256);
+            n->scratch = (char *)mc_realloc(n->scratch, n->scratchcap);
+        }
+
+        net_gather(L, count, n->scratch);
+        r = peer_write(p, n->scratch, (int)total);
+    }
 
-    mpz_clear(ts);
+    if ((0 == r) && peer_limited(p)) {
+        peer_check(p, queued + (int)total);
+    }
 
+    lua_pushboolean(L, 0 == r);
     return 1;
 }
 
-static int mcl_peer_send(lua_State *L) {
+/*
+ * Holds sends in one buffer until net:update(), peer:flush() or
+ * peer:uncork(), so many small messages leave as one. The receiver
+ * gets the concatenation, peers framing their own data are unaffected.
+ */
+static int mcl_peer_cork(lua_State *L) {
     mcl_peer_t *p = luaX_checkpeer(L, 1);
-    size_t l = 0;
-    const char *data = luaL_checklstring(L, 2, &l);
-    int len = (int)luaL_optinteger(L, 3, (lua_Integer)l);
+    mcl_net_t *n = p->holder;
+
+    if (!p->corked) {
+        p->corked = 1;
+        p->prev = NULL;
+        p->next = n->corked;
+
+        if (n->corked) {
+            n->corked->prev = p;
+        }
+        n->corked = p;
+    }
+    return 0;
+}
+
+static int mcl_peer_uncork(lua_State *L) {
+    mcl_peer_t *p = luaX_checkpeer(L, 1);
+
+    peer_uncork(p);
+    lua_pushboolean(L, 0 == peer_flush(p));
+    return 1;
+}
+
+/*
+ * peer:watermark(low, high, [hard], [policy]). Past high the peer turns
+ * unwritable until its queue is back under low, raising "writable" and
+ * then "drained" when empty. Sends past hard are dropped, or close the
+ * peer with the "close" policy. A direct peer only sees the kernel
+ * queue, so high and hard must be under its socket send buffer and
+ * "drained" means the kernel is empty, mc_net may still hold data.
+ */
+static int mcl_peer_watermark(lua_State *L) {
+    mcl_peer_t *p = luaX_checkpeer(L, 1);
+
+    check_limits(L, 2, &p->limits, p->peer ? netshard_sndbuf(mc_net_socket(p->peer)) : 0);
+
+    if (p->limits.high <= 0) {
+        p->blocked = 0;
+        peer_unwatch(p);
+    }
+    return 0;
+}
 
-    lua_pushboolean(L, 0 == mc_net_send(p->peer, data, len));
+/* Returns the bytes and corked messages still to leave the peer. */
+static int mcl_peer_queued(lua_State *L) {
+    mcl_peer_t *p = luaX_checkpeer(L, 1);
+
+    lua_pushinteger(L, peer_queued(p));
+    lua_pushinteger(L, p->corkmsgs);
+    return 2;
+}
+
+static int mcl_peer_writable(lua_State *L) {
+    mcl_peer_t *p = luaX_checkpeer(L, 1);
+    lua_pushboolean(L, !p->blocked);
+    return 1;
+}
+
+static int mcl_peer_flush(lua_State *L) {
+    mcl_peer_t *p = luaX_checkpeer(L, 1);
+    lua_pushboolean(L, 0 == peer_flush(p));
     return 1;
 }
 
@@ -432,7 +1336,12 @@ static int mcl_peer_status(lua_State *L) {
     mcl_peer_t *p = luaX_checkpeer(L, 1);
 
     if (!p->peer) {
-        lua_pushliteral(L, "closed");
+        switch (p->info.status) {
+        case NETSHARD_CONNECTING:   lua_pushliteral(L, "connecting"); break;
+        case NETSHARD_CONNECTED:    lua_pushliteral(L, "connected"); break;
+        case NETSHARD_CLOSING:      lua_pushliteral(L, "closing"); break;
+        default:                    lua_pushliteral(L, "closed"); break;
+        }
     } else if (mc_net_is_connecting(p->peer)) {
         lua_pushliteral(L, "connecting");
     } else if (mc_net_is_connected(p->peer)) {
@@ -447,11 +1356,206 @@ static int mcl_peer_status(lua_State *L) {
     return 1;
 }
 
+/*
+ * Members are kept alive by the group's user value, which maps
+ * [slot + 1] = peer and [lightuserdata peer] = slot.
+ */
+static int mcl_net_group(lua_State *L) {
+    mcl_net_t *n = luaX_checknet(L, 1);
+    mcl_group_t *g = (mcl_group_t *)luaX_newuserdata(L, g_meta_group, sizeof(mcl_group_t));
+
+    g->holder = n;
+    g->members = NULL;
+    g->ids = NULL;
+    g->count = 0;
+    g->capacity = 0;
+
+    lua_newtable(L);
+    lua_setuservalue(L, -2);
+
+    return 1;
+}
+
+/* Swaps the last member into slot, t is the user value index. */
+static void group_remove_at(lua_State *L, mcl_group_t *g, int t, int slot) {
+    mcl_peer_t *p = g->members[slot];
+    int last = g->count - 1;
+
+    if (slot != last) {
+        g->members[slot] = g->members[last];
+
+        lua_rawgeti(L, t, last + 1);
+        lua_rawseti(L, t, slot + 1);
+
+        lua_pushinteger(L, slot);
+        lua_rawsetp(L, t, g->members[slot]);
+    }
+
+    lua_pushnil(L);
+    lua_rawseti(L, t, last + 1);
+
+    lua_pushnil(L);
+    lua_rawsetp(L, t, p);
+
+    g->count = last;
+}
+
+static int mcl_group__gc(lua_State *L) {
+    mcl_group_t *g = luaX_checkgroup(L, 1);
+
+    if (g->members) {
+        mc_free(g->members);
+        g->members = NULL;
+    }
+
+    if (g->ids) {
+        mc_free(g->ids);
+        g->ids = NULL;
+    }
+
+    g->count = g->capacity = 0;
+    return 0;
+}
+
+static int mcl_group_add(lua_State *L) {
+    mcl_group_t *g = luaX_checkgroup(L, 1);
+    mcl_peer_t *p = luaX_checkpeer(L, 2);
+    int t;
+
+    luaL_argcheck(L, p->holder == g->holder, 2, "Peer belongs to another net");
+
+    lua_settop(L, 2);
+    lua_getuservalue(L, 1);
+    t = lua_gettop(L);
+
+    if (LUA_TNIL != lua_rawgetp(L, t, p)) {
+        lua_pushboolean(L, 0);
+        return 1;
+    }
+
+    if (g->count == g->capacity) {
+        g->capacity = MC_MAX(g->capacity * 2, 16);
+        g->members = (mcl_peer_t **)mc_realloc(g->members, g->capacity * sizeof(mcl_peer_t *));
+        g->ids = (long long *)mc_realloc(g->ids, g->capacity * sizeof(long long));
+    }
+
+    g->members[g->count] = p;
+
+    lua_pushvalue(L, 2);
+    lua_rawseti(L, t, g->count + 1);
+
+    lua_pushinteger(L, g->count);
+    lua_rawsetp(L, t, p);
+
+    g->count += 1;
+
+    lua_pushboolean(L, 1);
+    return 1;
+}
+
+static int mcl_group_remove(lua_State *L) {
+    mcl_group_t *g = luaX_checkgroup(L, 1);
+    mcl_peer_t *p = (mcl_peer_t *)luaL_checkudata(L, 2, g_meta_peer);
+    int t;
+
+    lua_settop(L, 2);
+    lua_getuservalue(L, 1);
+    t = lua_gettop(L);
+
+    if (LUA_TNUMBER != lua_rawgetp(L, t, p)) {
+        lua_pushboolean(L, 0);
+        return 1;
+    }
+
+    group_remove_at(L, g, t, (int)lua_tointeger(L, -1));
+
+    lua_pushboolean(L, 1);
+    return 1;
+}
+
+static int mcl_group_size(lua_State *L) {
+    mcl_group_t *g = luaX_checkgroup(L, 1);
+    lua_pushinteger(L, g->count);
+    return 1;
+}
+
+/*
+ * group:send(data, [len]) sends to every member in one call. Pool
+ * members share a single copy of data across the I/O threads, closed
+ * members are dropped. Returns the count of peers sent to.
+ */
+static int mcl_group_send(lua_State *L) {
+    mcl_group_t *g = luaX_checkgroup(L, 1);
+    size_t l = 0;
+    const char *data = net_checkbytes(L, 2, &l);
+    int len = (int)luaL_optinteger(L, 3, (lua_Integer)l);
+    netpool_t *pool = NULL;
+    int i, t, nids = 0, sent = 0;
+    mcl_peer_t *p;
+
+    luaL_argcheck(L, len >= 0 && (size_t)len <= l, 3, "Invalid length");
+
+    lua_settop(L, 3);
+    lua_getuservalue(L, 1);
+    t = lua_gettop(L);
+
+    for (i = g->count - 1; i >= 0; --i) {
+        p = g->members[i];
+
+        if (!p->holder || (!p->peer && !p->info.id)) {
+            group_remove_at(L, g, t, i);
+            continue;
+        }
+
+        if (p->corked || p->peer || peer_limited(p)) {
+            sent += (0 == peer_output(p, data, len));
+        } else if (p->holder->pool) {
+            pool = p->holder->pool;
+            g->ids[nids++] = p->info.id;
+        }
+    }
+
+    if (nids > 0) {
+        sent += netpool_broadcast(pool, g->ids, nids, data, len);
+    }
+
+    lua_pushinteger(L, sent);
+    return 1;
+}
+
+/* sevo.net.new([{ threads = n }]), n I/O threads run the net off this one. */
 static int mcl_net_new(lua_State *L) {
-    mcl_net_t *n = (mcl_net_t *)luaX_newuserdata(L, g_meta_net, sizeof(mcl_net_t));
+    int threads = 0;
+    mcl_net_t *n;
+
+    if (lua_istable(L, 1)) {
+        lua_getfield(L, 1, "threads");
+        threads = (int)luaL_optinteger(L, -1, 0);
+        lua_pop(L, 1);
+    }
+
+    n = (mcl_net_t *)luaX_newuserdata(L, g_meta_net, sizeof(mcl_net_t));
 
     n->peercnt = 0;
-    n->net = mc_net_create();
+    n->net = NULL;
+    n->pool = NULL;
+    n->inbox = thread_inbox();
+    n->corked = NULL;
+    n->scratch = NULL;
+    n->scratchcap = 0;
+    memset(&n->limits, 0, sizeof(n->limits));
+    n->watched = NULL;
+    n->notes = NULL;
+    n->nnotes = n->notehead = n->notecap = 0;
+
+    if (threads > 0) {
+        n->pool = netpool_create(threads);
+        if (n->inbox) {
+            netpool_link(n->pool, n->inbox);
+        }
+    } else {
+        n->net = mc_net_create();
+    }
 
     lua_newtable(L);
     n->ref = luaL_ref(L, LUA_REGISTRYINDEX);
@@ -466,7 +1570,21 @@ int luaopen_sevo_net(lua_State* L) {
         { "connect", mcl_net_connect },
         { "timeout", mcl_net_timeout },
         { "receive", mcl_net_receive },
+        { "next", mcl_net_next },
+        { "receive_batch", mcl_net_receive_batch },
+        { "dispatch", mcl_net_dispatch },
         { "update", mcl_net_update },
+        { "group", mcl_net_group },
+        { "watermark", mcl_net_watermark },
+        { NULL, NULL }
+    };
+    luaL_Reg meta_group[] = {
+        { "__gc", mcl_group__gc },
+        { "__len", mcl_group_size },
+        { "add", mcl_group_add },
+        { "remove", mcl_group_remove },
+        { "size", mcl_group_size },
+        { "send", mcl_group_send },
         { NULL, NULL }
     };
     luaL_Reg meta_peer[] = {
@@ -480,6 +1598,13 @@ int luaopen_sevo_net(lua_State* L) {
         { "ping", mcl_peer_ping },
         { "pong", mcl_peer_pong },
         { "send", mcl_peer_send },
+        { "sendv", mcl_peer_sendv },
+        { "cork", mcl_peer_cork },
+        { "uncork", mcl_peer_uncork },
+        { "flush", mcl_peer_flush },
+        { "watermark", mcl_peer_watermark },
+        { "queued", mcl_peer_queued },
+        { "writable", mcl_peer_writable },
         { "status", mcl_peer_status },
         { NULL, NULL }
     };
@@ -488,8 +1613,21 @@ int luaopen_sevo_net(lua_State* L) {
         { NULL, NULL }
     };
 
+    int i;
+
+    lua_createtable(L, CMD_NUM, CMD_NUM);
+    for (i = 1; i < CMD_NUM; ++i) {
+        lua_pushstring(L, g_cmd_names[i]);
+        lua_pushvalue(L, -1);
+        lua_rawseti(L, -3, i);
+        lua_pushinteger(L, i);
+        lua_rawset(L, -3);
+    }
+    lua_rawsetp(L, LUA_REGISTRYINDEX, &g_cmds_key);
+
     luaX_register_type(L, g_meta_net, meta_net);
     luaX_register_type(L, g_meta_peer, meta_peer);
+    luaX_register_type(L, g_meta_group, meta_group);
     luaX_register_module(L, "net", mod_net);
     return 0;
 }
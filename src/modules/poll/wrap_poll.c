@@ -0,0 +1,494 @@
+/*
+ *  wrap_poll.c
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#include "wrap_poll.h"
+#include "common/logger.h"
+#include <string.h>
+#include <errno.h>
+
+#if defined(__linux__)
+# include <sys/epoll.h>
+# include <unistd.h>
+# define POLL_EPOLL
+#elif defined(_WIN32)
+# include <winsock2.h>
+# define poll WSAPoll
+#else
+# include <poll.h>
+#endif
+
+/* Most events taken from the poller per wait */
+#define POLL_MAX        256
+
+#define POLL_READ       1
+#define POLL_WRITE      2
+
+/* Slots of the uservalue table */
+#define POLL_ENTRIES    1   /* fd -> entry */
+#define POLL_OBJECTS    2   /* object -> fd */
+#define POLL_PENDING    3   /* fd -> true, buffered input left unread */
+
+/* Slots of an entry */
+#define ENTRY_OBJ       1
+#define ENTRY_FUNC      2
+#define ENTRY_EVENTS    3
+#define ENTRY_DIRTY     4
+
+typedef struct mcl_poll_t {
+    int                 epfd;
+    int                 count;
+#ifndef POLL_EPOLL
+    struct pollfd       *fds;
+    int                 capacity;
+#endif
+} mcl_poll_t;
+
+typedef struct mcl_ready_t {
+    lua_Integer         fd;
+    int                 events;
+} mcl_ready_t;
+
+static const char g_meta_poll[] = { CODE_NAME ".meta.poll" };
+
+/* Registry key of the per-state poller */
+static const char g_poll_key = 0;
+
+static int mcl_poll__gc(lua_State * L) {
+    mcl_poll_t *p = (mcl_poll_t *)luaL_checkudata(L, 1, g_meta_poll);
+
+#ifdef POLL_EPOLL
+    if (p->epfd >= 0) {
+        close(p->epfd);
+        p->epfd = -1;
+    }
+#else
+    if (p->fds) {
+        mc_free(p->fds);
+        p->fds = NULL;
+    }
+#endif
+    return 0;
+}
+
+/* Pushes the uservalue table, returns the poller of this state. */
+static mcl_poll_t *poll_get(lua_State * L) {
+    mcl_poll_t *p;
+
+    lua_rawgetp(L, LUA_REGISTRYINDEX, &g_poll_key);
+    p = (mcl_poll_t *)lua_touserdata(L, -1);
+    lua_getuservalue(L, -1);
+    lua_remove(L, -2);
+
+    return p;
+}
+
+/* An fd given as is, or by any object with a getfd method. */
+static lua_Integer poll_fd(lua_State * L, int idx) {
+    lua_Integer fd;
+
+    if (lua_isinteger(L, idx)) {
+        return lua_tointeger(L, idx);
+    }
+
+    if ((!lua_isuserdata(L, idx) && !lua_istable(L, idx)) || LUA_TFUNCTION != lua_getfield(L, idx, "getfd")) {
+        luaL_argerror(L, idx, "fd or object with getfd expected");
+    }
+
+    lua_pushvalue(L, idx);
+    lua_call(L, 1, 1);
+    fd = (lua_Integer)lua_tonumber(L, -1);
+    lua_pop(L, 1);
+
+    if (fd < 0) {
+        luaL_argerror(L, idx, "closed socket");
+    }
+    return fd;
+}
+
+static int poll_events(lua_State * L, int idx) {
+    const char *s = luaL_optstring(L, idx, "r");
+    int events = 0;
+
+    for (; *s; ++s) {
+        if ('r' == *s) {
+            events |= POLL_READ;
+        } else if ('w' == *s) {
+            events |= POLL_WRITE;
+        } else {
+            luaL_argerror(L, idx, "events must be made of 'r' and 'w'");
+        }
+    }
+    return events;
+}
+
+static int poll_ctl(mcl_poll_t *p, int add, lua_Integer fd, int events) {
+#ifdef POLL_EPOLL
+    struct epoll_event ev;
+    int retval;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.data.fd = (int)fd;
+    if (events & POLL_READ) ev.events |= EPOLLIN;
+    if (events & POLL_WRITE) ev.events |= EPOLLOUT;
+
+    retval = epoll_ctl(p->epfd, add ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, (int)fd, &ev);
+
+    /* A closed and reused fd leaves the kernel and the table apart */
+    if (0 != retval && (add ? EEXIST : ENOENT) == errno) {
+        retval = epoll_ctl(p->epfd, add ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, (int)fd, &ev);
+    }
+    return retval;
+#else
+    (void)p; (void)add; (void)fd; (void)events;
+    return 0;
+#endif
+}
+
+static void poll_del(mcl_poll_t *p, lua_Integer fd) {
+#ifdef POLL_EPOLL
+    struct epoll_event ev;
+    /* fails once the fd is closed, the kernel dropped it already */
+    epoll_ctl(p->epfd, EPOLL_CTL_DEL, (int)fd, &ev);
+#else
+    (void)p; (void)fd;
+#endif
+}
+
+/* Fills ready with up to max fds, entries is the table at that index. */
+static int poll_select(lua_State * L, mcl_poll_t *p, int entries, mcl_ready_t *ready, int max, int timeout) {
+#ifdef POLL_EPOLL
+    struct epoll_event evs[POLL_MAX];
+    int i, n;
+
+    (void)L; (void)entries;
+
+    n = epoll_wait(p->epfd, evs, MC_MIN(max, POLL_MAX), timeout);
+
+    for (i = 0; i < n; ++i) {
+        ready[i].fd = evs[i].data.fd;
+        ready[i].events = 0;
+
+        if (evs[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) ready[i].events |= POLL_READ;
+        if (evs[i].events & (EPOLLOUT | EPOLLERR)) ready[i].events |= POLL_WRITE;
+    }
+    return MC_MAX(n, 0);
+#else
+    int i, n = 0, count = 0;
+
+    if (p->capacity < p->count) {
+        p->capacity = MC_MAX(p->count, p->capacity * 2);
+        p->fds = (struct pollfd *)mc_realloc(p->fds, p->capacity * sizeof(struct pollfd));
+    }
+
+    /* Rebuilt per wait, costs O(fds) but has no FD_SETSIZE ceiling */
+    lua_pushnil(L);
+    while (lua_next(L, entries)) {
+        int events;
+
+        lua_rawgeti(L, -1, ENTRY_EVENTS);
+        events = (int)lua_tointeger(L, -1);
+        lua_pop(L, 2);
+
+        p->fds[n].fd = lua_tointeger(L, -1);
+        p->fds[n].events = 0;
+        p->fds[n].revents = 0;
+        if (events & POLL_READ) p->fds[n].events |= POLLIN;
+        if (events & POLL_WRITE) p->fds[n].events |= POLLOUT;
+        n += 1;
+    }
+
+    if (0 == n) {
+        if (timeout > 0) mc_sleep(timeout);
+        return 0;
+    }
+
+    if (poll(p->fds, n, timeout) <= 0) {
+        return 0;
+    }
+
+    for (i = 0; i < n && count < max; ++i) {
+        short re = p->fds[i].revents;
+
+        if (!re) continue;
+
+        ready[count].fd = (lua_Integer)p->fds[i].fd;
+        ready[count].events = 0;
+
+        if (re & (POLLIN | POLLERR | POLLHUP)) ready[count].events |= POLL_READ;
+        if (re & (POLLOUT | POLLERR)) ready[count].events |= POLL_WRITE;
+        count += 1;
+    }
+    return count;
+#endif
+}
+
+/* Calls the entry of fd, marking it pending when its object buffered input. */
+static int poll_dispatch(lua_State * L, int entries, int pending, lua_Integer fd, int events) {
+    int ent, wanted;
+
+    if (LUA_TTABLE != lua_rawgeti(L, entries, fd)) {
+        lua_pop(L, 1);
+        return 0;
+    }
+    ent = lua_gettop(L);
+
+    lua_rawgeti(L, ent, ENTRY_EVENTS);
+    wanted = (int)lua_tointeger(L, -1);
+    lua_pop(L, 1);
+
+    events &= wanted;
+    if (!events) {
+        lua_pop(L, 1);
+        return 0;
+    }
+
+    lua_rawgeti(L, ent, ENTRY_FUNC);
+    lua_rawgeti(L, ent, ENTRY_OBJ);
+    lua_pushboolean(L, events & POLL_READ);
+    lua_pushboolean(L, events & POLL_WRITE);
+
+    if (LUA_OK != lua_pcall(L, 3, 0, 0)) {
+        LG_ERR("poll callback: %s", lua_tostring(L, -1));
+        lua_pop(L, 1);
+    }
+
+    /* Input the object already read from the socket never wakes the poller */
+    if ((wanted & POLL_READ) && LUA_TFUNCTION == lua_rawgeti(L, ent, ENTRY_DIRTY)) {
+        lua_rawgeti(L, ent, ENTRY_OBJ);
+
+        if (LUA_OK == lua_pcall(L, 1, 1, 0) && lua_toboolean(L, -1)) {
+            lua_rawgeti(L, entries, fd);
+            if (lua_rawequal(L, -1, ent)) {
+                lua_pushboolean(L, 1);
+                lua_rawseti(L, pending, fd);
+            }
+            lua_pop(L, 1);
+        }
+    }
+    lua_settop(L, ent - 1);
+
+    return 1;
+}
+
+static int mcl_add(lua_State * L) {
+    lua_Integer fd = poll_fd(L, 1);
+    int events = poll_events(L, 2);
+    mcl_poll_t *p;
+    int uv, exists;
+
+    luaL_checktype(L, 3, LUA_TFUNCTION);
+
+    p = poll_get(L);
+    uv = lua_gettop(L);
+
+    lua_rawgeti(L, uv, POLL_ENTRIES);
+    exists = (LUA_TNIL != lua_rawgeti(L, -1, fd));
+
+    /* Replacing an entry forgets the object it had */
+    if (exists) {
+        lua_rawgeti(L, uv, POLL_OBJECTS);
+        lua_rawgeti(L, -2, ENTRY_OBJ);
+        lua_pushnil(L);
+        lua_rawset(L, -3);
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 1);
+
+    if (0 != poll_ctl(p, !exists, fd, events)) {
+        lua_pushnil(L);
+        lua_pushstring(L, strerror(errno));
+        return 2;
+    }
+
+    /* entries[fd] = { obj, func, events, dirty } */
+    lua_createtable(L, 4, 0);
+    lua_pushvalue(L, 1);
+    lua_rawseti(L, -2, ENTRY_OBJ);
+    lua_pushvalue(L, 3);
+    lua_rawseti(L, -2, ENTRY_FUNC);
+    lua_pushinteger(L, events);
+    lua_rawseti(L, -2, ENTRY_EVENTS);
+
+    if (!lua_isinteger(L, 1)) {
+        if (LUA_TFUNCTION == lua_getfield(L, 1, "dirty")) {
+            lua_rawseti(L, -2, ENTRY_DIRTY);
+        } else {
+            lua_pop(L, 1);
+        }
+
+        lua_rawgeti(L, uv, POLL_OBJECTS);
+        lua_pushvalue(L, 1);
+        lua_pushinteger(L, fd);
+        lua_rawset(L, -3);
+        lua_pop(L, 1);
+    }
+
+    lua_rawseti(L, -2, fd);
+
+    if (!exists) {
+        p->count += 1;
+    }
+
+    lua_pushboolean(L, 1);
+    return 1;
+}
+
+static int mcl_remove(lua_State * L) {
+    mcl_poll_t *p = poll_get(L);
+    int uv = lua_gettop(L);
+    lua_Integer fd;
+
+    /* By object first, it still names its fd after being closed */
+    lua_rawgeti(L, uv, POLL_OBJECTS);
+    lua_pushvalue(L, 1);
+    if (LUA_TNUMBER == lua_rawget(L, -2)) {
+        fd = lua_tointeger(L, -1);
+        lua_pop(L, 1);
+        lua_pushvalue(L, 1);
+        lua_pushnil(L);
+        lua_rawset(L, -3);
+        lua_pop(L, 1);
+    } else {
+        lua_pop(L, 2);
+        fd = poll_fd(L, 1);
+    }
+
+    lua_rawgeti(L, uv, POLL_ENTRIES);
+    if (LUA_TNIL == lua_rawgeti(L, -1, fd)) {
+        lua_pushboolean(L, 0);
+        return 1;
+    }
+    lua_pop(L, 1);
+
+    lua_pushnil(L);
+    lua_rawseti(L, -2, fd);
+
+    lua_rawgeti(L, uv, POLL_PENDING);
+    lua_pushnil(L);
+    lua_rawseti(L, -2, fd);
+
+    poll_del(p, fd);
+    p->count -= 1;
+
+    lua_pushboolean(L, 1);
+    return 1;
+}
+
+static int mcl_count(lua_State * L) {
+    mcl_poll_t *p = poll_get(L);
+    lua_pushinteger(L, p->count);
+    return 1;
+}
+
+/*
+ * Waits up to timeout ms (0 polls, -1 blocks) and calls back every
+ * ready fd, returns the count called.
+ */
+static int mcl_wait(lua_State * L) {
+    int timeout = (int)luaL_optinteger(L, 1, 0);
+    mcl_ready_t ready[POLL_MAX];
+    mcl_poll_t *p = poll_get(L);
+    int uv = lua_gettop(L);
+    int entries, old, pending;
+    int i, n, count = 0;
+
+    lua_rawgeti(L, uv, POLL_ENTRIES);
+    entries = lua_gettop(L);
+
+    /* Swap the pending set, callbacks refill the new one */
+    lua_rawgeti(L, uv, POLL_PENDING);
+    old = lua_gettop(L);
+    lua_newtable(L);
+    lua_pushvalue(L, -1);
+    lua_rawseti(L, uv, POLL_PENDING);
+    pending = lua_gettop(L);
+
+    lua_pushnil(L);
+    if (lua_next(L, old)) {
+        lua_pop(L, 2);
+        timeout = 0;
+    }
+
+    if (0 == p->count && timeout < 0) {
+        return luaL_error(L, "Nothing to wait for.");
+    }
+
+    n = poll_select(L, p, entries, ready, POLL_MAX, timeout);
+
+    for (i = 0; i < n; ++i) {
+        if (ready[i].events & POLL_READ) {
+            lua_pushnil(L);
+            lua_rawseti(L, old, ready[i].fd);
+        }
+        count += poll_dispatch(L, entries, pending, ready[i].fd, ready[i].events);
+    }
+
+    lua_pushnil(L);
+    while (lua_next(L, old)) {
+        lua_pop(L, 1);
+        count += poll_dispatch(L, entries, pending, lua_tointeger(L, -1), POLL_READ);
+    }
+
+    lua_pushinteger(L, count);
+    return 1;
+}
+
+static int mcl_backend(lua_State * L) {
+#ifdef POLL_EPOLL
+    lua_pushliteral(L, "epoll");
+#else
+    lua_pushliteral(L, "poll");
+#endif
+    return 1;
+}
+
+int luaopen_sevo_poll(lua_State* L) {
+    luaL_Reg meta_poll[] = {
+        { "__gc", mcl_poll__gc },
+        { NULL, NULL }
+    };
+    luaL_Reg mod_poll[] = {
+        { "add", mcl_add },
+        { "remove", mcl_remove },
+        { "count", mcl_count },
+        { "wait", mcl_wait },
+        { "backend", mcl_backend },
+        { NULL, NULL }
+    };
+
+    luaX_register_type(L, g_meta_poll, meta_poll);
+    luaX_register_module(L, "poll", mod_poll);
+
+    if (LUA_TNIL == lua_rawgetp(L, LUA_REGISTRYINDEX, &g_poll_key)) {
+        mcl_poll_t *p = (mcl_poll_t *)luaX_newuserdata(L, g_meta_poll, sizeof(mcl_poll_t));
+
+        memset(p, 0, sizeof(mcl_poll_t));
+#ifdef POLL_EPOLL
+        p->epfd = epoll_create1(EPOLL_CLOEXEC);
+        if (p->epfd < 0) {
+            return luaL_error(L, "Poller create failed: %s", strerror(errno));
+        }
+#else
+        p->epfd = -1;
+#endif
+
+        lua_createtable(L, 3, 0);
+        lua_newtable(L);
+        lua_rawseti(L, -2, POLL_ENTRIES);
+        lua_newtable(L);
+        lua_rawseti(L, -2, POLL_OBJECTS);
+        lua_newtable(L);
+        lua_rawseti(L, -2, POLL_PENDING);
+        lua_setuservalue(L, -2);
+        lua_rawsetp(L, LUA_REGISTRYINDEX, &g_poll_key);
+    }
+    lua_pop(L, 1);
+
+    return 0;
+}
@@ -22,9 +22,11 @@
 #include "modules/secure/wrap_secure.h"
 #include "modules/socket/wrap_socket.h"
 #include "modules/thread/wrap_thread.h"
+#include "modules/worker/wrap_worker.h"
 #include "modules/math/wrap_math.h"
 #include "modules/dbm/wrap_dbm.h"
 #include "modules/env/wrap_env.h"
+#include "modules/poll/wrap_poll.h"
 #include <ffi.h>
 
 #ifndef FQDN_LEN
@@ -82,6 +84,9 @@ int luaopen_sevo(lua_State * L) {
         { CODE_NAME ".net", luaopen_sevo_net },
         { CODE_NAME ".secure", luaopen_sevo_secure },
         { CODE_NAME ".thread", luaopen_sevo_thread },
+        { CODE_NAME ".worker", luaopen_sevo_worker },
+        /* poll */
+        { CODE_NAME ".poll", luaopen_sevo_poll },
         /* vfs */
         { CODE_NAME ".vfs", luaopen_sevo_vfs },
         /* logger */
@@ -5,81 +5,294 @@ static const unsigned char sevo_lua[] = {
     0x1B, 0x4C, 0x75, 0x61, 0x53, 0x00, 0x19, 0x93, 0x0D, 0x0A, 0x1A, 0x0A, 0x04, 0x08, 0x04, 0x08,
     0x08, 0x78, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x77,
     0x40, 0x01, 0x0A, 0x40, 0x73, 0x65, 0x76, 0x6F, 0x2E, 0x6C, 0x75, 0x61, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x8A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x4B,
-    0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x80, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x80, 0x4B,
-    0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x81, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x81, 0x4B,
-    0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x82, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x82, 0x4B,
-    0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x83, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x83, 0x4B,
-    0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x84, 0x47, 0x40, 0x40, 0x00, 0x86, 0x80, 0x42, 0x00, 0x87,
-    0xC0, 0x42, 0x01, 0xA4, 0x80, 0x80, 0x00, 0x4A, 0x80, 0x80, 0x84, 0x47, 0xC0, 0x40, 0x00, 0x8B,
-    0x00, 0x00, 0x00, 0x4A, 0x80, 0x80, 0x84, 0x6C, 0x00, 0x00, 0x00, 0xAC, 0x40, 0x00, 0x00, 0xEC,
-    0x80, 0x00, 0x00, 0x2C, 0xC1, 0x00, 0x00, 0x6C, 0x01, 0x01, 0x00, 0xAC, 0x41, 0x01, 0x00, 0xEC,
-    0x81, 0x01, 0x00, 0x2C, 0xC2, 0x01, 0x00, 0x6C, 0x02, 0x02, 0x00, 0x0A, 0x40, 0x02, 0x86, 0x6C,
-    0x42, 0x02, 0x00, 0x0A, 0x40, 0x82, 0x86, 0x6C, 0x82, 0x02, 0x00, 0x0A, 0x40, 0x02, 0x87, 0x6C,
-    0xC2, 0x02, 0x00, 0x0A, 0x40, 0x82, 0x87, 0x6C, 0x02, 0x03, 0x00, 0x0A, 0x40, 0x02, 0x88, 0x6C,
-    0x42, 0x03, 0x00, 0x0A, 0x40, 0x82, 0x88, 0x6C, 0x82, 0x03, 0x00, 0x0A, 0x40, 0x02, 0x89, 0x6C,
-    0xC2, 0x03, 0x00, 0x0A, 0x40, 0x82, 0x89, 0x6C, 0x02, 0x04, 0x00, 0x0A, 0x40, 0x02, 0x8A, 0x6C,
-    0x42, 0x04, 0x00, 0x0A, 0x40, 0x82, 0x8A, 0x6C, 0x82, 0x04, 0x00, 0x0A, 0x40, 0x02, 0x8B, 0x6C,
-    0xC2, 0x04, 0x00, 0x0A, 0x40, 0x82, 0x8B, 0x6C, 0x02, 0x05, 0x00, 0x0A, 0x40, 0x02, 0x8C, 0x6C,
-    0x42, 0x05, 0x00, 0x0A, 0x40, 0x82, 0x8C, 0x6C, 0x82, 0x05, 0x00, 0x0A, 0x40, 0x02, 0x8D, 0x6C,
-    0xC2, 0x05, 0x00, 0x0A, 0x40, 0x82, 0x8D, 0x6C, 0x02, 0x06, 0x00, 0x0A, 0x40, 0x02, 0x8E, 0x6C,
-    0x42, 0x06, 0x00, 0x0A, 0x40, 0x82, 0x8E, 0x6C, 0x82, 0x06, 0x00, 0x0A, 0x40, 0x02, 0x8F, 0x6C,
-    0xC2, 0x06, 0x00, 0x0A, 0x40, 0x82, 0x8F, 0x6C, 0x02, 0x07, 0x00, 0x0A, 0x40, 0x02, 0x90, 0x6C,
-    0x42, 0x07, 0x00, 0x0A, 0x40, 0x82, 0x90, 0x46, 0x82, 0x48, 0x00, 0x47, 0xC2, 0xC8, 0x04, 0x87,
-    0x02, 0x49, 0x00, 0xC7, 0x42, 0x44, 0x00, 0x64, 0x42, 0x80, 0x01, 0x46, 0x82, 0x48, 0x00, 0x47,
-    0xC2, 0xC8, 0x04, 0x87, 0x42, 0x49, 0x00, 0xC7, 0x42, 0x44, 0x00, 0x64, 0x42, 0x80, 0x01, 0x46,
-    0x82, 0x48, 0x00, 0x47, 0xC2, 0xC8, 0x04, 0x87, 0x02, 0x49, 0x00, 0xC0, 0x02, 0x00, 0x03, 0x64,
-    0x42, 0x80, 0x01, 0x46, 0x82, 0x48, 0x00, 0x47, 0xC2, 0xC8, 0x04, 0x87, 0x42, 0x49, 0x00, 0xC0,
-    0x02, 0x80, 0x03, 0x64, 0x42, 0x80, 0x01, 0x46, 0x82, 0x48, 0x00, 0x47, 0xC2, 0xC8, 0x04, 0x87,
-    0x02, 0x49, 0x00, 0xC0, 0x02, 0x00, 0x04, 0x64, 0x42, 0x80, 0x01, 0x46, 0x82, 0x48, 0x00, 0x47,
-    0xC2, 0xC8, 0x04, 0x87, 0x42, 0x49, 0x00, 0xC0, 0x02, 0x00, 0x04, 0x64, 0x42, 0x80, 0x01, 0x46,
-    0x82, 0x49, 0x00, 0x80, 0x02, 0x00, 0x00, 0x64, 0x02, 0x01, 0x01, 0x1E, 0x80, 0x01, 0x80, 0x86,
-    0xC3, 0x49, 0x00, 0xC0, 0x03, 0x80, 0x06, 0xA4, 0x83, 0x00, 0x01, 0x1F, 0x00, 0x4A, 0x07, 0x1E,
-    0x40, 0x00, 0x80, 0x86, 0x43, 0x4A, 0x00, 0x8A, 0x43, 0x03, 0x06, 0x69, 0x82, 0x00, 0x00, 0xEA,
-    0x82, 0xFD, 0x7F, 0x46, 0x42, 0x4A, 0x00, 0xAC, 0x82, 0x07, 0x00, 0x4A, 0x82, 0x02, 0x95, 0x46,
-    0x42, 0x4A, 0x00, 0xAC, 0xC2, 0x07, 0x00, 0x4A, 0x82, 0x82, 0x95, 0x46, 0x42, 0x4A, 0x00, 0xAC,
-    0x02, 0x08, 0x00, 0x4A, 0x82, 0x02, 0x96, 0x46, 0x42, 0x4A, 0x00, 0xAC, 0x42, 0x08, 0x00, 0x4A,
-    0x82, 0x82, 0x96, 0x46, 0x42, 0x4A, 0x00, 0xAC, 0x82, 0x08, 0x00, 0x4A, 0x82, 0x02, 0x97, 0x26,
-    0x00, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x04, 0x06, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x04, 0x0A,
-    0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x04, 0x0B, 0x73, 0x6C, 0x61, 0x75, 0x67,
-    0x68, 0x74, 0x65, 0x72, 0x73, 0x04, 0x0A, 0x6D, 0x61, 0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73,
-    0x04, 0x09, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x73, 0x04, 0x06, 0x6C, 0x69, 0x6E, 0x6B,
-    0x73, 0x04, 0x09, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x73, 0x04, 0x08, 0x6F, 0x6E, 0x64,
-    0x65, 0x61, 0x74, 0x68, 0x04, 0x0E, 0x6F, 0x6E, 0x64, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
-    0x69, 0x6F, 0x6E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x63, 0x6F,
-    0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x04, 0x08, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67,
-    0x04, 0x06, 0x77, 0x68, 0x6F, 0x69, 0x73, 0x04, 0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69, 0x73,
-    0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x08, 0x69, 0x73, 0x61, 0x6C, 0x69, 0x76, 0x65, 0x04,
-    0x09, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x04, 0x0B, 0x75, 0x6E, 0x72, 0x65, 0x67,
-    0x69, 0x73, 0x74, 0x65, 0x72, 0x04, 0x0B, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x65,
-    0x64, 0x04, 0x06, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x04, 0x05, 0x65, 0x78, 0x69, 0x74, 0x04, 0x05,
-    0x6B, 0x69, 0x6C, 0x6C, 0x04, 0x06, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x04, 0x05, 0x73, 0x65, 0x6E,
-    0x64, 0x04, 0x08, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x04, 0x0A, 0x73, 0x63, 0x68, 0x65,
-    0x64, 0x75, 0x6C, 0x65, 0x72, 0x04, 0x05, 0x6C, 0x69, 0x6E, 0x6B, 0x04, 0x0A, 0x73, 0x70, 0x61,
-    0x77, 0x6E, 0x6C, 0x69, 0x6E, 0x6B, 0x04, 0x07, 0x75, 0x6E, 0x6C, 0x69, 0x6E, 0x6B, 0x04, 0x07,
-    0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x04, 0x08, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x04,
-    0x0D, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x04, 0x0A, 0x64,
-    0x65, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x04, 0x07, 0x6E, 0x6F, 0x74, 0x69, 0x66, 0x79,
-    0x04, 0x06, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x04, 0x07, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x04,
-    0x08, 0x6F, 0x6E, 0x64, 0x65, 0x61, 0x74, 0x68, 0x04, 0x0E, 0x6F, 0x6E, 0x64, 0x65, 0x73, 0x74,
-    0x72, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x05,
-    0x74, 0x79, 0x70, 0x65, 0x04, 0x09, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x04, 0x05,
-    0x73, 0x65, 0x76, 0x6F, 0x04, 0x0B, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74,
-    0x04, 0x0D, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x04, 0x0C,
-    0x73, 0x65, 0x74, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x04, 0x0E, 0x63, 0x6C, 0x65,
-    0x61, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x04, 0x08, 0x65, 0x6D, 0x69, 0x74,
-    0x74, 0x65, 0x72, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0xCC, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x80, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x80, 0x46,
+    0xC0, 0x40, 0x00, 0x8B, 0x00, 0x00, 0x00, 0xCB, 0x40, 0x00, 0x00, 0xCA, 0x40, 0x41, 0x82, 0x64,
+    0x80, 0x80, 0x01, 0x0A, 0x40, 0x00, 0x81, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x83, 0x4B,
+    0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x83, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x84, 0x4B,
+    0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x84, 0x0A, 0xC0, 0x42, 0x85, 0x4B, 0x00, 0x00, 0x00, 0x0A,
+    0x40, 0x00, 0x86, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x86, 0x0A, 0xC0, 0x43, 0x87, 0x0A,
+    0xC0, 0x43, 0x88, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x88, 0x4B, 0x00, 0x00, 0x00, 0x0A,
+    0x40, 0x00, 0x89, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x89, 0x4B, 0x00, 0x00, 0x00, 0x0A,
+    0x40, 0x00, 0x8A, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x8A, 0x0A, 0xC0, 0x43, 0x8B, 0x0A,
+    0xC0, 0xC3, 0x8B, 0x0A, 0xC0, 0x43, 0x8C, 0x0A, 0xC0, 0xC2, 0x8C, 0x0A, 0xC0, 0x42, 0x8D, 0x4B,
+    0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x8D, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x8E, 0x41,
+    0x40, 0x07, 0x00, 0x97, 0x40, 0x00, 0x8F, 0x8E, 0x80, 0x47, 0x01, 0xC1, 0xC0, 0x07, 0x00, 0x01,
+    0x01, 0x08, 0x00, 0x41, 0x41, 0x08, 0x00, 0x87, 0x41, 0x40, 0x00, 0xC6, 0x81, 0x48, 0x00, 0xC7,
+    0xC1, 0xC8, 0x03, 0xE4, 0x81, 0x80, 0x00, 0x8A, 0xC1, 0x81, 0x87, 0x87, 0x81, 0x40, 0x00, 0xC7,
+    0x41, 0x40, 0x00, 0xC7, 0xC1, 0xC3, 0x03, 0x8A, 0xC1, 0xC3, 0x03, 0xAC, 0x01, 0x00, 0x00, 0xEC,
+    0x41, 0x00, 0x00, 0x2C, 0x82, 0x00, 0x00, 0x6C, 0xC2, 0x00, 0x00, 0xAC, 0x02, 0x01, 0x00, 0xEC,
+    0x42, 0x01, 0x00, 0x2C, 0x83, 0x01, 0x00, 0x6C, 0xC3, 0x01, 0x00, 0xAC, 0x03, 0x02, 0x00, 0xEC,
+    0x43, 0x02, 0x00, 0x2C, 0x84, 0x02, 0x00, 0x6C, 0xC4, 0x02, 0x00, 0x80, 0x04, 0x00, 0x03, 0xA4,
+    0x84, 0x80, 0x00, 0x0A, 0x80, 0x04, 0x85, 0x87, 0xC4, 0x41, 0x00, 0xC0, 0x04, 0x00, 0x03, 0xE4,
+    0x84, 0x80, 0x00, 0x8A, 0xC4, 0x04, 0x92, 0xAC, 0x04, 0x03, 0x00, 0xEC, 0x44, 0x03, 0x00, 0x2C,
+    0x85, 0x03, 0x00, 0x6C, 0xC5, 0x03, 0x00, 0xAC, 0x05, 0x04, 0x00, 0xEC, 0x45, 0x04, 0x00, 0x2C,
+    0x86, 0x04, 0x00, 0x6C, 0xC6, 0x04, 0x00, 0xAC, 0x06, 0x05, 0x00, 0xEC, 0x46, 0x05, 0x00, 0x2C,
+    0x87, 0x05, 0x00, 0x0A, 0x00, 0x87, 0x92, 0x2C, 0xC7, 0x05, 0x00, 0x0A, 0x00, 0x07, 0x93, 0x2C,
+    0x07, 0x06, 0x00, 0x0A, 0x00, 0x87, 0x93, 0x2C, 0x47, 0x06, 0x00, 0x0A, 0x00, 0x07, 0x94, 0x2C,
+    0x87, 0x06, 0x00, 0x0A, 0x00, 0x87, 0x94, 0x2C, 0xC7, 0x06, 0x00, 0x0A, 0x00, 0x07, 0x95, 0x2C,
+    0x07, 0x07, 0x00, 0x0A, 0x00, 0x87, 0x95, 0x2C, 0x47, 0x07, 0x00, 0x0A, 0x00, 0x07, 0x96, 0x2C,
+    0x87, 0x07, 0x00, 0x0A, 0x00, 0x87, 0x96, 0x2C, 0xC7, 0x07, 0x00, 0x0A, 0x00, 0x07, 0x97, 0x2C,
+    0x07, 0x08, 0x00, 0x0A, 0x00, 0x87, 0x97, 0x2C, 0x47, 0x08, 0x00, 0x0A, 0x00, 0x07, 0x98, 0x2C,
+    0x87, 0x08, 0x00, 0x0A, 0x00, 0x87, 0x98, 0x2C, 0xC7, 0x08, 0x00, 0x0A, 0x00, 0x07, 0x99, 0x2C,
+    0x07, 0x09, 0x00, 0x0A, 0x00, 0x87, 0x99, 0x2C, 0x47, 0x09, 0x00, 0x0A, 0x00, 0x07, 0x9A, 0x2C,
+    0x87, 0x09, 0x00, 0x0A, 0x00, 0x87, 0x9A, 0x2C, 0xC7, 0x09, 0x00, 0x0A, 0x00, 0x07, 0x9B, 0x2C,
+    0x07, 0x0A, 0x00, 0x0A, 0x00, 0x87, 0x9B, 0x2C, 0x47, 0x0A, 0x00, 0x0A, 0x00, 0x07, 0x9C, 0x2C,
+    0x87, 0x0A, 0x00, 0x0A, 0x00, 0x87, 0x9C, 0x2C, 0xC7, 0x0A, 0x00, 0x0A, 0x00, 0x07, 0x9D, 0x2C,
+    0x07, 0x0B, 0x00, 0x0A, 0x00, 0x87, 0x9D, 0x2C, 0x47, 0x0B, 0x00, 0x0A, 0x00, 0x07, 0x9E, 0x2C,
+    0x87, 0x0B, 0x00, 0x0A, 0x00, 0x87, 0x9E, 0x2C, 0xC7, 0x0B, 0x00, 0x0A, 0x00, 0x07, 0x9F, 0x2C,
+    0x07, 0x0C, 0x00, 0x0A, 0x00, 0x87, 0x9F, 0x2C, 0x47, 0x0C, 0x00, 0x0A, 0x00, 0x07, 0xA0, 0x06,
+    0x47, 0x50, 0x00, 0x07, 0x87, 0x50, 0x0E, 0x47, 0xC7, 0x50, 0x00, 0x87, 0x47, 0x4B, 0x00, 0x24,
+    0x47, 0x80, 0x01, 0x06, 0x47, 0x50, 0x00, 0x07, 0x87, 0x50, 0x0E, 0x47, 0x07, 0x51, 0x00, 0x87,
+    0x47, 0x4B, 0x00, 0x24, 0x47, 0x80, 0x01, 0x06, 0x47, 0x50, 0x00, 0x07, 0x87, 0x50, 0x0E, 0x47,
+    0xC7, 0x50, 0x00, 0x80, 0x07, 0x80, 0x0C, 0x24, 0x47, 0x80, 0x01, 0x06, 0x47, 0x50, 0x00, 0x07,
+    0x87, 0x50, 0x0E, 0x47, 0x07, 0x51, 0x00, 0x80, 0x07, 0x00, 0x0D, 0x24, 0x47, 0x80, 0x01, 0x06,
+    0x47, 0x50, 0x00, 0x07, 0x87, 0x50, 0x0E, 0x47, 0xC7, 0x50, 0x00, 0x80, 0x07, 0x80, 0x0D, 0x24,
+    0x47, 0x80, 0x01, 0x06, 0x47, 0x50, 0x00, 0x07, 0x87, 0x50, 0x0E, 0x47, 0x07, 0x51, 0x00, 0x80,
+    0x07, 0x80, 0x0D, 0x24, 0x47, 0x80, 0x01, 0x06, 0x47, 0x51, 0x00, 0x40, 0x07, 0x00, 0x00, 0x24,
+    0x07, 0x01, 0x01, 0x1E, 0x80, 0x01, 0x80, 0x46, 0x88, 0x51, 0x00, 0x80, 0x08, 0x00, 0x10, 0x64,
+    0x88, 0x00, 0x01, 0x1F, 0xC0, 0xD1, 0x10, 0x1E, 0x40, 0x00, 0x80, 0x46, 0x08, 0x52, 0x00, 0x4A,
+    0x08, 0x88, 0x0F, 0x29, 0x87, 0x00, 0x00, 0xAA, 0x87, 0xFD, 0x7F, 0x06, 0x07, 0x52, 0x00, 0x6C,
+    0x87, 0x0C, 0x00, 0x0A, 0x47, 0x87, 0xA4, 0x06, 0x07, 0x52, 0x00, 0x6C, 0xC7, 0x0C, 0x00, 0x0A,
+    0x47, 0x07, 0xA5, 0x06, 0x07, 0x52, 0x00, 0x6C, 0x07, 0x0D, 0x00, 0x0A, 0x47, 0x87, 0xA5, 0x06,
+    0x07, 0x52, 0x00, 0x6C, 0x47, 0x0D, 0x00, 0x0A, 0x47, 0x07, 0xA6, 0x06, 0x07, 0x52, 0x00, 0x6C,
+    0x87, 0x0D, 0x00, 0x0A, 0x47, 0x87, 0xA6, 0x26, 0x00, 0x80, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x04,
+    0x06, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x04, 0x0A, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65,
+    0x73, 0x04, 0x05, 0x70, 0x69, 0x64, 0x73, 0x04, 0x0D, 0x73, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x04, 0x07, 0x5F, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x04, 0x02, 0x6B,
+    0x04, 0x0B, 0x73, 0x6C, 0x61, 0x75, 0x67, 0x68, 0x74, 0x65, 0x72, 0x73, 0x04, 0x0A, 0x6D, 0x61,
+    0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73, 0x04, 0x09, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74,
+    0x73, 0x04, 0x07, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x73, 0x04, 0x09, 0x72, 0x75, 0x6E, 0x71, 0x75,
+    0x65, 0x75, 0x65, 0x00, 0x04, 0x06, 0x72, 0x65, 0x61, 0x64, 0x79, 0x04, 0x08, 0x77, 0x61, 0x69,
+    0x74, 0x69, 0x6E, 0x67, 0x04, 0x06, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x04, 0x06, 0x6C, 0x69, 0x6E,
+    0x6B, 0x73, 0x04, 0x09, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x73, 0x04, 0x09, 0x77, 0x61,
+    0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x04, 0x0C, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x04, 0x0A, 0x66, 0x72, 0x65, 0x65, 0x73, 0x6C, 0x6F, 0x74, 0x73, 0x04, 0x08,
+    0x6D, 0x61, 0x78, 0x73, 0x6C, 0x6F, 0x74, 0x04, 0x07, 0x77, 0x6F, 0x72, 0x6B, 0x65, 0x72, 0x04,
+    0x05, 0x72, 0x6F, 0x6F, 0x74, 0x04, 0x06, 0x72, 0x6F, 0x75, 0x74, 0x65, 0x04, 0x05, 0x70, 0x6F,
+    0x6C, 0x6C, 0x04, 0x08, 0x6F, 0x6E, 0x64, 0x65, 0x61, 0x74, 0x68, 0x04, 0x0E, 0x6F, 0x6E, 0x64,
+    0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x13, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69,
+    0x6E, 0x65, 0x04, 0x08, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x77, 0x6F, 0x72, 0x6B, 0x65, 0x72, 0x6F, 0x66, 0x04, 0x07,
+    0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x04, 0x07, 0x6C, 0x69, 0x76, 0x69, 0x6E, 0x67, 0x04, 0x06,
+    0x77, 0x68, 0x6F, 0x69, 0x73, 0x04, 0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69, 0x73, 0x04, 0x05,
+    0x73, 0x65, 0x6C, 0x66, 0x04, 0x08, 0x69, 0x73, 0x61, 0x6C, 0x69, 0x76, 0x65, 0x04, 0x09, 0x72,
+    0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x04, 0x0B, 0x75, 0x6E, 0x72, 0x65, 0x67, 0x69, 0x73,
+    0x74, 0x65, 0x72, 0x04, 0x0B, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x65, 0x64, 0x04,
+    0x06, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x04, 0x05, 0x65, 0x78, 0x69, 0x74, 0x04, 0x05, 0x6B, 0x69,
+    0x6C, 0x6C, 0x04, 0x06, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x04, 0x05, 0x73, 0x65, 0x6E, 0x64, 0x04,
+    0x08, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x04, 0x0D, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76,
+    0x65, 0x5F, 0x6D, 0x61, 0x6E, 0x79, 0x04, 0x08, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x04,
+    0x0A, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x65, 0x72, 0x04, 0x05, 0x69, 0x64, 0x6C, 0x65,
+    0x04, 0x05, 0x6C, 0x69, 0x6E, 0x6B, 0x04, 0x0A, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x6C, 0x69, 0x6E,
+    0x6B, 0x04, 0x07, 0x75, 0x6E, 0x6C, 0x69, 0x6E, 0x6B, 0x04, 0x07, 0x73, 0x69, 0x67, 0x6E, 0x61,
+    0x6C, 0x04, 0x08, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x04, 0x0D, 0x73, 0x70, 0x61, 0x77,
+    0x6E, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x04, 0x0A, 0x64, 0x65, 0x6D, 0x6F, 0x6E, 0x69,
+    0x74, 0x6F, 0x72, 0x04, 0x07, 0x6E, 0x6F, 0x74, 0x69, 0x66, 0x79, 0x04, 0x06, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x04, 0x07, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x04, 0x08, 0x6F, 0x6E, 0x64, 0x65,
+    0x61, 0x74, 0x68, 0x04, 0x0E, 0x6F, 0x6E, 0x64, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x05, 0x74, 0x79, 0x70, 0x65, 0x04,
+    0x09, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x04, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x04,
+    0x0B, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x04, 0x0D, 0x63, 0x6C, 0x65,
+    0x61, 0x72, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x04, 0x0C, 0x73, 0x65, 0x74, 0x69, 0x6E,
+    0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x04, 0x0E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x69, 0x6E, 0x74,
+    0x65, 0x72, 0x76, 0x61, 0x6C, 0x04, 0x08, 0x65, 0x6D, 0x69, 0x74, 0x74, 0x65, 0x72, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0A, 0x40, 0x40, 0x80,
+    0x0A, 0xC0, 0x40, 0x81, 0x26, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x04, 0x06, 0x66, 0x69, 0x72, 0x73, 0x74, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x05, 0x6C, 0x61, 0x73, 0x74, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x03, 0x06, 0x00, 0x00, 0x00, 0x47, 0x00, 0x40, 0x00, 0x87, 0x40, 0x40, 0x00, 0x4E,
+    0x80, 0x80, 0x00, 0x4D, 0x80, 0xC0, 0x00, 0x66, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x04, 0x05, 0x6C, 0x61, 0x73, 0x74, 0x04, 0x06, 0x66, 0x69, 0x72, 0x73, 0x74,
+    0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x03, 0x6D, 0x62, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3B, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x05, 0x00, 0x00, 0x00,
+    0x87, 0x00, 0x40, 0x00, 0x8D, 0x40, 0x40, 0x01, 0x0A, 0x80, 0x00, 0x80, 0x0A, 0x40, 0x00, 0x01,
+    0x26, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x05, 0x6C, 0x61, 0x73, 0x74, 0x13, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3E,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x6D, 0x62, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x6D, 0x73, 0x67, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x05, 0x6C, 0x61, 0x73, 0x74, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x12,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x40, 0x00, 0x87, 0x40, 0x40, 0x00, 0x20, 0x40, 0x00, 0x01, 0x1E,
+    0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x87, 0x40, 0x00, 0x00, 0x0A, 0x80, 0xC0, 0x00, 0xC7,
+    0x40, 0x40, 0x00, 0x1F, 0xC0, 0x80, 0x00, 0x1E, 0xC0, 0x00, 0x80, 0xC1, 0xC0, 0x00, 0x00, 0x0A,
+    0x00, 0xC1, 0x80, 0x0A, 0xC0, 0x00, 0x80, 0x1E, 0x40, 0x00, 0x80, 0xCD, 0xC0, 0xC0, 0x00, 0x0A,
+    0xC0, 0x00, 0x80, 0xA6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04,
+    0x06, 0x66, 0x69, 0x72, 0x73, 0x74, 0x04, 0x05, 0x6C, 0x61, 0x73, 0x74, 0x00, 0x13, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x43,
+    0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x44,
+    0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4C,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x6D, 0x62, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+    0x00, 0x00, 0x06, 0x66, 0x69, 0x72, 0x73, 0x74, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x04, 0x6D, 0x73, 0x67, 0x06, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4E, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1D, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x40, 0x00, 0x07, 0x40, 0x40, 0x00, 0x46, 0x80, 0xC0, 0x00, 0x24, 0x80, 0x00, 0x01,
+    0x22, 0x40, 0x00, 0x00, 0x1E, 0xC0, 0x02, 0x80, 0x46, 0xC0, 0xC0, 0x00, 0x0D, 0x00, 0xC1, 0x00,
+    0x45, 0x00, 0x00, 0x01, 0x20, 0x00, 0x80, 0x00, 0x1E, 0xC0, 0x00, 0x80, 0x46, 0x40, 0x41, 0x00,
+    0x81, 0x80, 0x01, 0x00, 0xC1, 0xC0, 0x01, 0x00, 0x64, 0x40, 0x80, 0x01, 0x48, 0x00, 0x80, 0x81,
+    0x46, 0x00, 0xC2, 0x00, 0x4A, 0x40, 0x42, 0x00, 0x46, 0x00, 0xC2, 0x00, 0x47, 0x00, 0x80, 0x00,
+    0x85, 0x00, 0x80, 0x01, 0x57, 0x80, 0x80, 0x00, 0x86, 0x80, 0xC2, 0x00, 0xC5, 0x00, 0x00, 0x02,
+    0x97, 0xC0, 0x00, 0x01, 0x55, 0x80, 0x80, 0x00, 0x55, 0x00, 0x80, 0x00, 0x66, 0x00, 0x00, 0x01,
+    0x26, 0x00, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x04, 0x06, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x04,
+    0x07, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x04, 0x0A, 0x66, 0x72, 0x65, 0x65, 0x73, 0x6C, 0x6F,
+    0x74, 0x73, 0x04, 0x08, 0x6D, 0x61, 0x78, 0x73, 0x6C, 0x6F, 0x74, 0x13, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x04, 0x13, 0x74, 0x6F, 0x6F,
+    0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x13,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07,
+    0x77, 0x6F, 0x72, 0x6B, 0x65, 0x72, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02,
+    0x01, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00,
+    0x4F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+    0x54, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x05, 0x73, 0x6C, 0x6F, 0x74, 0x04, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x02, 0x4D, 0x0E, 0x50, 0x49, 0x44,
+    0x5F, 0x53, 0x4C, 0x4F, 0x54, 0x5F, 0x4D, 0x41, 0x53, 0x4B, 0x0E, 0x50, 0x49, 0x44, 0x5F, 0x47,
+    0x45, 0x4E, 0x5F, 0x53, 0x48, 0x49, 0x46, 0x54, 0x0E, 0x50, 0x49, 0x44, 0x5F, 0x53, 0x4C, 0x4F,
+    0x54, 0x5F, 0x42, 0x49, 0x54, 0x53, 0x00, 0x59, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x05, 0x0F, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x54, 0x40, 0x00, 0x00, 0x86, 0x00,
+    0xC0, 0x00, 0xC6, 0x00, 0xC0, 0x00, 0xC7, 0x40, 0x80, 0x01, 0xCD, 0x40, 0xC0, 0x01, 0x05, 0x01,
+    0x00, 0x01, 0xD4, 0x00, 0x81, 0x01, 0x8A, 0xC0, 0x80, 0x00, 0x86, 0x80, 0xC0, 0x01, 0x87, 0xC0,
+    0x40, 0x01, 0xC6, 0x00, 0xC1, 0x00, 0x00, 0x01, 0x80, 0x00, 0xA4, 0x40, 0x80, 0x01, 0x26, 0x00,
+    0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x04, 0x07, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x04, 0x0A, 0x66, 0x72, 0x65,
+    0x65, 0x73, 0x6C, 0x6F, 0x74, 0x73, 0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x5A, 0x00,
+    0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5B, 0x00,
+    0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5C, 0x00,
+    0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x5C, 0x00,
+    0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x73, 0x6C, 0x6F, 0x74, 0x02, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x49, 0x44, 0x5F, 0x53, 0x4C, 0x4F, 0x54,
+    0x5F, 0x4D, 0x41, 0x53, 0x4B, 0x02, 0x4D, 0x0D, 0x50, 0x49, 0x44, 0x5F, 0x47, 0x45, 0x4E, 0x5F,
+    0x4D, 0x41, 0x53, 0x4B, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x61, 0x00, 0x00, 0x00, 0x64, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x80, 0x00, 0x8A, 0x40, 0x00,
+    0x80, 0x26, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x06, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+    0x63, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x68, 0x65, 0x61,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x69, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x02, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x15, 0x00, 0x00,
+    0x00, 0x20, 0x40, 0x00, 0x80, 0x1E, 0x00, 0x03, 0x80, 0xD3, 0x40, 0xC0, 0x00, 0x07, 0xC1, 0x00,
+    0x00, 0x07, 0x81, 0x40, 0x02, 0x47, 0x81, 0x40, 0x01, 0x61, 0x40, 0x01, 0x02, 0x1E, 0x80, 0x01,
+    0x80, 0x05, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80, 0x00, 0xC7, 0xC1, 0x00,
+    0x00, 0x24, 0x41, 0x00, 0x02, 0x40, 0x00, 0x80, 0x01, 0x1E, 0x00, 0xFC, 0x7F, 0xC5, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x01, 0x80, 0x00, 0x80, 0x01, 0x00, 0x01, 0xE4, 0x40, 0x00,
+    0x02, 0x26, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x64, 0x65, 0x61,
+    0x64, 0x6C, 0x69, 0x6E, 0x65, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x69,
+    0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x69,
+    0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x6A,
+    0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x6D,
+    0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x6D,
+    0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x68, 0x65, 0x61, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x69, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+    0x00, 0x00, 0x02, 0x74, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x70, 0x61, 0x72,
+    0x65, 0x6E, 0x74, 0x03, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C,
+    0x74, 0x69, 0x6D, 0x65, 0x72, 0x5F, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x00, 0x70, 0x00, 0x00, 0x00,
+    0x7D, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09, 0x20, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x0F,
+    0x01, 0xC0, 0x00, 0x60, 0x00, 0x81, 0x01, 0x1E, 0x40, 0x05, 0x80, 0x20, 0xC0, 0x00, 0x02, 0x1E,
+    0xC0, 0x01, 0x80, 0x4D, 0x41, 0x40, 0x02, 0x47, 0x41, 0x01, 0x00, 0x47, 0x81, 0xC0, 0x02, 0x87,
+    0x01, 0x01, 0x00, 0x87, 0x81, 0x40, 0x03, 0x20, 0x80, 0x81, 0x02, 0x1E, 0x00, 0x00, 0x80, 0x0D,
+    0x41, 0x40, 0x02, 0x47, 0x81, 0x40, 0x01, 0x87, 0x01, 0x01, 0x00, 0x87, 0x81, 0x40, 0x03, 0x61,
+    0x80, 0x81, 0x02, 0x1E, 0x80, 0x01, 0x80, 0x45, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0,
+    0x01, 0x80, 0x00, 0x07, 0x02, 0x01, 0x00, 0x64, 0x41, 0x00, 0x02, 0x40, 0x00, 0x00, 0x02, 0x1E,
+    0x80, 0xF9, 0x7F, 0x05, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80, 0x00, 0xC0,
+    0x01, 0x00, 0x01, 0x24, 0x41, 0x00, 0x02, 0x26, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x09, 0x64, 0x65, 0x61, 0x64, 0x6C, 0x69, 0x6E, 0x65, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00,
+    0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00,
+    0x00, 0x75, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00,
+    0x00, 0x75, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00,
+    0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00,
+    0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x7C, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x68, 0x65,
+    0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x69, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x02, 0x74, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x6E,
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x06, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x02, 0x00,
+    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x74, 0x69, 0x6D, 0x65, 0x72,
+    0x5F, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x06, 0x08, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x85, 0x00, 0x80, 0x00, 0xC0, 0x00,
+    0x80, 0x00, 0x1C, 0x01, 0x80, 0x00, 0x0D, 0x41, 0x40, 0x02, 0x40, 0x01, 0x00, 0x00, 0xA4, 0x40,
+    0x00, 0x02, 0x26, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x07, 0x74, 0x69, 0x6D, 0x65,
+    0x72, 0x73, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
+    0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 0x68, 0x65, 0x61, 0x70, 0x01, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x09, 0x74, 0x69, 0x6D,
+    0x65, 0x72, 0x5F, 0x75, 0x70, 0x00, 0x84, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x09, 0x22, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x87, 0x40, 0x40, 0x00, 0xDC, 0x00, 0x80,
+    0x00, 0xA2, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x07, 0x81, 0x80, 0x00, 0x5F, 0x00, 0x00,
+    0x02, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x07, 0xC1, 0x80, 0x00, 0x4A, 0x80, 0xC0,
+    0x01, 0x0A, 0x80, 0xC0, 0x80, 0x20, 0xC0, 0x00, 0x01, 0x1E, 0x80, 0x04, 0x80, 0x20, 0x80, 0x80,
+    0x81, 0x1E, 0xC0, 0x02, 0x80, 0x47, 0x01, 0x41, 0x02, 0x93, 0x41, 0x41, 0x01, 0x87, 0x81, 0x81,
+    0x00, 0x87, 0x01, 0x41, 0x03, 0x20, 0x80, 0x81, 0x02, 0x1E, 0x40, 0x01, 0x80, 0x45, 0x01, 0x80,
+    0x00, 0x80, 0x01, 0x80, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x64, 0x41, 0x00,
+    0x02, 0x1E, 0x00, 0x01, 0x80, 0x45, 0x01, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0xC0, 0x01, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0x02, 0x64, 0x41, 0x00, 0x02, 0x26, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x04, 0x07, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x73, 0x04, 0x06, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x00, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x64, 0x65, 0x61, 0x64,
+    0x6C, 0x69, 0x6E, 0x65, 0x13, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x0D, 0x01, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x85,
+    0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x8B,
+    0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x8C,
+    0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x8C,
+    0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x8D,
+    0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x74, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x00, 0x00, 0x00, 0x05, 0x68, 0x65, 0x61, 0x70, 0x01, 0x00, 0x00, 0x00, 0x22, 0x00,
+    0x00, 0x00, 0x02, 0x69, 0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x02, 0x6E, 0x03, 0x00,
+    0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x05, 0x6C, 0x61, 0x73, 0x74, 0x0A, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x09, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x5F,
+    0x75, 0x70, 0x0B, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x5F, 0x64, 0x6F, 0x77, 0x6E, 0x00, 0x94, 0x00,
+    0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40,
+    0x00, 0x07, 0x40, 0x40, 0x00, 0x45, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x64, 0x40, 0x00,
+    0x01, 0x26, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x07, 0x74,
+    0x69, 0x6D, 0x65, 0x72, 0x73, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x95, 0x00,
+    0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00,
+    0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x74,
+    0x6F, 0x70, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D,
+    0x0D, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x5F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x00, 0x9F, 0x00,
+    0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40,
     0x00, 0x24, 0x80, 0x80, 0x00, 0x46, 0x40, 0xC0, 0x00, 0x86, 0x80, 0x40, 0x00, 0x64, 0x00, 0x01,
     0x01, 0x1E, 0xC0, 0x00, 0x80, 0x80, 0x01, 0x80, 0x02, 0xC0, 0x01, 0x00, 0x00, 0x01, 0xC2, 0x00,
     0x00, 0xA4, 0x41, 0x80, 0x01, 0x69, 0x80, 0x00, 0x00, 0xEA, 0x40, 0xFE, 0x7F, 0x26, 0x00, 0x80,
     0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x07, 0x69, 0x70, 0x61,
     0x69, 0x72, 0x73, 0x04, 0x0E, 0x6F, 0x6E, 0x64, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69,
     0x6F, 0x6E, 0x04, 0x07, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x00,
+    0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0xA1, 0x00,
+    0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0xA2, 0x00,
+    0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x06, 0x00,
     0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x02, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x28,
     0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x05, 0x00,
     0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74,
@@ -87,15 +300,15 @@ static const unsigned char sevo_lua[] = {
     0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x05, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
     0x02, 0x5F, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03, 0x66, 0x6E, 0x06, 0x00, 0x00,
     0x00, 0x0A, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56,
-    0x00, 0x25, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0A, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0xA6, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0A, 0x0B, 0x00, 0x00, 0x00,
     0x86, 0x00, 0x40, 0x00, 0xC6, 0x40, 0xC0, 0x00, 0xA4, 0x00, 0x01, 0x01, 0x1E, 0xC0, 0x00, 0x80,
     0xC0, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x40, 0x02, 0x80, 0x00, 0xE4, 0x41, 0x80, 0x01,
     0xA9, 0x80, 0x00, 0x00, 0x2A, 0x41, 0xFE, 0x7F, 0x26, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00,
     0x04, 0x07, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x08, 0x6F, 0x6E, 0x64, 0x65, 0x61, 0x74,
     0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
-    0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00,
-    0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0xA7, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00,
+    0x00, 0xA8, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00,
+    0x00, 0xA7, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
     0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65,
     0x61, 0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F,
     0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x03, 0x00, 0x00, 0x00,
@@ -103,820 +316,1064 @@ static const unsigned char sevo_lua[] = {
     0x03, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F,
     0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x02, 0x5F,
     0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x66, 0x6E, 0x04, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x02, 0x4D, 0x00, 0x2B,
-    0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x1E, 0x00, 0x00, 0x00, 0x46, 0x00,
-    0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0x64, 0x80, 0x00, 0x01, 0x1F, 0x40, 0xC0, 0x00, 0x1E, 0x40,
-    0x01, 0x80, 0x46, 0x80, 0x40, 0x00, 0x47, 0xC0, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x64, 0x80,
-    0x00, 0x01, 0x5F, 0x00, 0xC1, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x46, 0x80,
-    0x40, 0x00, 0x47, 0x40, 0xC1, 0x00, 0x80, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0x64, 0xC0,
-    0x00, 0x00, 0x62, 0x40, 0x00, 0x00, 0x1E, 0x80, 0x01, 0x80, 0xC6, 0x80, 0xC1, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0xE4, 0x80, 0x00, 0x01, 0x05, 0x01, 0x00, 0x01, 0x40, 0x01, 0x80, 0x01, 0x80, 0x01,
-    0x00, 0x01, 0x24, 0x41, 0x80, 0x01, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x01, 0xE6, 0x00,
-    0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x05, 0x74, 0x79, 0x70, 0x65,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x02, 0x4D, 0x00, 0xAC,
+    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0C, 0x00, 0x00, 0x00, 0x46, 0x00,
+    0x40, 0x00, 0x47, 0x00, 0x80, 0x00, 0x62, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00,
+    0x80, 0x00, 0x46, 0x00, 0x40, 0x00, 0x4A, 0x40, 0x40, 0x00, 0x45, 0x00, 0x80, 0x00, 0x86, 0x80,
+    0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x64, 0x40, 0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x04, 0x06, 0x72, 0x65, 0x61, 0x64, 0x79, 0x01, 0x01, 0x04, 0x09, 0x72, 0x75, 0x6E,
+    0x71, 0x75, 0x65, 0x75, 0x65, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00,
+    0x00, 0xAD, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0xB0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x0B, 0x71, 0x75, 0x65, 0x75,
+    0x65, 0x5F, 0x70, 0x75, 0x73, 0x68, 0x00, 0xB3, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x07, 0x55, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x4E, 0x40, 0xC0, 0x00, 0x08, 0x40,
+    0x00, 0x80, 0x46, 0x80, 0x40, 0x00, 0x4A, 0xC0, 0x40, 0x00, 0x46, 0x00, 0x41, 0x00, 0x4A, 0xC0,
+    0x40, 0x00, 0x46, 0x40, 0x41, 0x00, 0x4A, 0xC0, 0x40, 0x00, 0x46, 0x80, 0x41, 0x00, 0x47, 0x00,
+    0x80, 0x00, 0x62, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x01, 0x80, 0x45, 0x00, 0x80, 0x00, 0x86, 0x80,
+    0x41, 0x00, 0x87, 0x00, 0x00, 0x01, 0x64, 0x40, 0x00, 0x01, 0x46, 0x80, 0x41, 0x00, 0x4A, 0xC0,
+    0x40, 0x00, 0x46, 0xC0, 0x41, 0x00, 0x4A, 0xC0, 0x40, 0x00, 0x46, 0x00, 0x42, 0x00, 0x47, 0x00,
+    0x80, 0x00, 0x62, 0x00, 0x00, 0x00, 0x1E, 0xC0, 0x03, 0x80, 0x46, 0x40, 0x42, 0x01, 0x86, 0x00,
+    0x42, 0x00, 0x87, 0x00, 0x00, 0x01, 0x64, 0x00, 0x01, 0x01, 0x1E, 0x80, 0x01, 0x80, 0x46, 0x01,
+    0x42, 0x00, 0x47, 0x01, 0x81, 0x02, 0x62, 0x01, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x46, 0x01,
+    0x42, 0x00, 0x47, 0x01, 0x81, 0x02, 0x4A, 0xC1, 0x40, 0x00, 0x69, 0x40, 0x00, 0x00, 0xEA, 0x80,
+    0xFD, 0x7F, 0x46, 0x00, 0x42, 0x00, 0x4A, 0xC0, 0x40, 0x00, 0x46, 0x80, 0x42, 0x00, 0x47, 0x00,
+    0x80, 0x00, 0x62, 0x00, 0x00, 0x00, 0x1E, 0xC0, 0x03, 0x80, 0x46, 0x40, 0x42, 0x01, 0x86, 0x80,
+    0x42, 0x00, 0x87, 0x00, 0x00, 0x01, 0x64, 0x00, 0x01, 0x01, 0x1E, 0x80, 0x01, 0x80, 0x46, 0xC1,
+    0x42, 0x00, 0x47, 0x01, 0x81, 0x02, 0x62, 0x01, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x46, 0xC1,
+    0x42, 0x00, 0x47, 0x01, 0x81, 0x02, 0x4A, 0xC1, 0x40, 0x00, 0x69, 0x40, 0x00, 0x00, 0xEA, 0x80,
+    0xFD, 0x7F, 0x46, 0x80, 0x42, 0x00, 0x4A, 0xC0, 0x40, 0x00, 0x46, 0xC0, 0x42, 0x00, 0x47, 0x00,
+    0x80, 0x00, 0x62, 0x00, 0x00, 0x00, 0x1E, 0xC0, 0x03, 0x80, 0x46, 0x40, 0x42, 0x01, 0x86, 0xC0,
+    0x42, 0x00, 0x87, 0x00, 0x00, 0x01, 0x64, 0x00, 0x01, 0x01, 0x1E, 0x80, 0x01, 0x80, 0x46, 0x81,
+    0x42, 0x00, 0x47, 0x01, 0x81, 0x02, 0x62, 0x01, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x46, 0x81,
+    0x42, 0x00, 0x47, 0x01, 0x81, 0x02, 0x4A, 0xC1, 0x40, 0x00, 0x69, 0x40, 0x00, 0x00, 0xEA, 0x80,
+    0xFD, 0x7F, 0x46, 0xC0, 0x42, 0x00, 0x4A, 0xC0, 0x40, 0x00, 0x45, 0x00, 0x80, 0x01, 0x80, 0x00,
+    0x00, 0x00, 0x64, 0x40, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x04, 0x06,
+    0x63, 0x6F, 0x75, 0x6E, 0x74, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0A,
+    0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x00, 0x04, 0x0A, 0x6D, 0x61, 0x69, 0x6C,
+    0x62, 0x6F, 0x78, 0x65, 0x73, 0x04, 0x08, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x04, 0x09,
+    0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x73, 0x04, 0x0B, 0x73, 0x6C, 0x61, 0x75, 0x67, 0x68,
+    0x74, 0x65, 0x72, 0x73, 0x04, 0x06, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x04, 0x06, 0x70, 0x61, 0x69,
+    0x72, 0x73, 0x04, 0x09, 0x77, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x04, 0x09, 0x6D, 0x6F,
+    0x6E, 0x69, 0x74, 0x6F, 0x72, 0x73, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x01, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB4, 0x00,
+    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0xB6, 0x00,
+    0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0xB8, 0x00,
+    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00,
+    0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xBA, 0x00,
+    0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBE, 0x00,
+    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00,
+    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
+    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC5, 0x00,
+    0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC6, 0x00,
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0xC6, 0x00,
+    0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00,
+    0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC6, 0x00,
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xCC, 0x00,
+    0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00,
+    0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0x0D, 0x00,
+    0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x10, 0x28,
+    0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x1D, 0x00,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74,
+    0x65, 0x29, 0x1D, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20,
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x1D, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+    0x06, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x1E, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x10, 0x28,
+    0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x31, 0x00,
+    0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74,
+    0x65, 0x29, 0x31, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20,
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x31, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00,
+    0x07, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x32, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x10,
+    0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x45,
+    0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x29, 0x45, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x45, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00,
+    0x00, 0x08, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x72, 0x46, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x0D, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x5F, 0x72, 0x65,
+    0x6D, 0x6F, 0x76, 0x65, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x09, 0x70, 0x69, 0x64, 0x5F, 0x66, 0x72,
+    0x65, 0x65, 0x00, 0xD6, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x29, 0x00,
+    0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0x64, 0x80, 0x00, 0x01, 0x1F, 0x40,
+    0xC0, 0x00, 0x1E, 0x40, 0x01, 0x80, 0x46, 0x80, 0x40, 0x00, 0x47, 0xC0, 0xC0, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x64, 0x80, 0x00, 0x01, 0x5F, 0x00, 0xC1, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00,
+    0x80, 0x00, 0x46, 0x80, 0x40, 0x00, 0x47, 0x40, 0xC1, 0x00, 0x80, 0x00, 0x00, 0x00, 0xED, 0x00,
+    0x00, 0x00, 0x64, 0xC0, 0x00, 0x00, 0x62, 0x40, 0x00, 0x00, 0x1E, 0x80, 0x01, 0x80, 0xC6, 0x80,
+    0xC1, 0x00, 0x00, 0x01, 0x00, 0x00, 0xE4, 0x80, 0x00, 0x01, 0x05, 0x01, 0x00, 0x01, 0x40, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0x00, 0x01, 0x24, 0x41, 0x80, 0x01, 0xC6, 0x80, 0x40, 0x00, 0xC7, 0xC0,
+    0xC0, 0x01, 0x00, 0x01, 0x00, 0x00, 0xE4, 0x80, 0x00, 0x01, 0x1F, 0xC0, 0xC1, 0x01, 0x1E, 0x00,
+    0x01, 0x80, 0xC5, 0x00, 0x80, 0x01, 0x06, 0x81, 0xC1, 0x00, 0x40, 0x01, 0x00, 0x00, 0x24, 0x01,
+    0x00, 0x01, 0xE4, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x01, 0xE6, 0x00,
+    0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x05, 0x74, 0x79, 0x70, 0x65,
     0x04, 0x07, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74,
     0x69, 0x6E, 0x65, 0x04, 0x07, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x04, 0x0A, 0x73, 0x75, 0x73,
     0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x04, 0x07, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x04, 0x06,
-    0x77, 0x68, 0x6F, 0x69, 0x73, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x32,
-    0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x34,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x03, 0x63, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x73,
-    0x74, 0x61, 0x74, 0x75, 0x73, 0x11, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x65, 0x72,
-    0x72, 0x6D, 0x73, 0x67, 0x11, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64,
-    0x16, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E,
-    0x56, 0x02, 0x4D, 0x0C, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x64, 0x69, 0x65, 0x00,
-    0x37, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x40, 0x00, 0x07, 0x40, 0x40, 0x00, 0x24, 0x80, 0x80, 0x00, 0x1F, 0x80, 0x40, 0x00, 0x1E,
-    0x80, 0x00, 0x80, 0x06, 0xC0, 0xC0, 0x00, 0x41, 0x80, 0x00, 0x00, 0x24, 0x40, 0x00, 0x01, 0x26,
-    0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69,
-    0x6E, 0x65, 0x04, 0x06, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x04, 0x05, 0x45, 0x58, 0x49, 0x54, 0x04,
-    0x05, 0x65, 0x78, 0x69, 0x74, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x02, 0x4D, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x07, 0x29, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x40, 0x00, 0x1E, 0x80, 0x00, 0x80,
-    0x85, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x80, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x86, 0x40, 0xC0, 0x00,
-    0x87, 0x80, 0x40, 0x01, 0x87, 0xC0, 0x40, 0x01, 0xA4, 0x80, 0x80, 0x00, 0xC6, 0x00, 0x41, 0x01,
-    0xC7, 0x00, 0x80, 0x01, 0xDC, 0x00, 0x80, 0x01, 0x60, 0xC0, 0x00, 0x80, 0x1E, 0x40, 0x06, 0x80,
-    0xC6, 0x40, 0xC0, 0x00, 0xC7, 0x80, 0xC0, 0x01, 0xC7, 0xC0, 0xC0, 0x01, 0xE4, 0x80, 0x80, 0x00,
-    0x0E, 0x81, 0x80, 0x01, 0x46, 0x41, 0x41, 0x01, 0x47, 0x01, 0x80, 0x02, 0x62, 0x01, 0x00, 0x00,
-    0x1E, 0x80, 0x01, 0x80, 0x46, 0x41, 0x41, 0x01, 0x47, 0x01, 0x80, 0x02, 0x21, 0x00, 0x81, 0x02,
-    0x1E, 0x80, 0x00, 0x80, 0x46, 0x41, 0x41, 0x01, 0x4A, 0x81, 0x41, 0x00, 0x26, 0x00, 0x80, 0x00,
-    0x46, 0x41, 0xC0, 0x00, 0x47, 0xC1, 0xC1, 0x02, 0x80, 0x01, 0x00, 0x02, 0x64, 0x41, 0x00, 0x01,
-    0x46, 0x41, 0xC0, 0x00, 0x47, 0x81, 0xC0, 0x02, 0x47, 0x01, 0xC2, 0x02, 0x81, 0x01, 0x00, 0x00,
-    0x64, 0x41, 0x00, 0x01, 0x1E, 0x00, 0xF8, 0x7F, 0x26, 0x00, 0x80, 0x00, 0x09, 0x00, 0x00, 0x00,
-    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x04,
-    0x05, 0x74, 0x69, 0x6D, 0x65, 0x04, 0x09, 0x6D, 0x69, 0x6C, 0x6C, 0x69, 0x73, 0x65, 0x63, 0x04,
-    0x0A, 0x6D, 0x61, 0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73, 0x04, 0x09, 0x74, 0x69, 0x6D, 0x65,
-    0x6F, 0x75, 0x74, 0x73, 0x00, 0x04, 0x0A, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x65, 0x72,
-    0x04, 0x06, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x03, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
-    0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
-    0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00,
-    0x00, 0x44, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00,
-    0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00,
-    0x00, 0x46, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
-    0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00,
-    0x00, 0x4C, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00,
-    0x00, 0x4C, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x08, 0x74, 0x69,
-    0x6D, 0x65, 0x6F, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74,
-    0x61, 0x72, 0x74, 0x09, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x04, 0x6E, 0x6F, 0x77, 0x12,
-    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x08, 0x65, 0x6C, 0x61, 0x70, 0x73, 0x65, 0x64, 0x13,
-    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x73, 0x63, 0x68, 0x65,
-    0x64, 0x75, 0x6C, 0x65, 0x72, 0x5F, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x05, 0x5F, 0x45, 0x4E, 0x56,
-    0x02, 0x4D, 0x00, 0x50, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0B, 0x14, 0x00,
+    0x77, 0x68, 0x6F, 0x69, 0x73, 0x04, 0x05, 0x64, 0x65, 0x61, 0x64, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x13, 0x01, 0x15, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xD7,
+    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD7,
+    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD7,
+    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0xDA,
+    0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0xDA,
+    0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0xDC,
+    0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xDD,
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0xDF,
+    0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0xE0,
+    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0,
+    0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0xE3,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x63, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
+    0x00, 0x00, 0x07, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x11, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
+    0x00, 0x07, 0x65, 0x72, 0x72, 0x6D, 0x73, 0x67, 0x11, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+    0x04, 0x70, 0x69, 0x64, 0x16, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x05, 0x5F, 0x45, 0x4E, 0x56, 0x02, 0x4D, 0x0C, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F,
+    0x64, 0x69, 0x65, 0x0D, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x72, 0x65, 0x61, 0x70,
+    0x00, 0xE5, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x40, 0x00, 0x07, 0x40, 0x40, 0x00, 0x24, 0x80, 0x80, 0x00, 0x1F, 0x80, 0x40, 0x00,
+    0x1E, 0x80, 0x00, 0x80, 0x06, 0xC0, 0xC0, 0x00, 0x41, 0x80, 0x00, 0x00, 0x24, 0x40, 0x00, 0x01,
+    0x26, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74,
+    0x69, 0x6E, 0x65, 0x04, 0x06, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x04, 0x05, 0x45, 0x58, 0x49, 0x54,
+    0x04, 0x05, 0x65, 0x78, 0x69, 0x74, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0xE6, 0x00,
+    0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0xE6, 0x00,
+    0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x02, 0x4D, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x07, 0x28, 0x00, 0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0x5F, 0x80, 0x00,
+    0x00, 0x1E, 0x80, 0x00, 0x80, 0x85, 0x00, 0x80, 0x00, 0xA5, 0x00, 0x80, 0x00, 0xA6, 0x00, 0x00,
+    0x00, 0x86, 0x40, 0x40, 0x01, 0x87, 0x80, 0x40, 0x01, 0x87, 0xC0, 0x40, 0x01, 0xA4, 0x80, 0x80,
+    0x00, 0xC1, 0x00, 0x01, 0x00, 0x05, 0x01, 0x80, 0x01, 0x46, 0x41, 0x41, 0x00, 0x47, 0x01, 0x80,
+    0x02, 0x24, 0x81, 0x00, 0x01, 0x1F, 0x00, 0x41, 0x02, 0x1E, 0x40, 0x05, 0x80, 0x62, 0x00, 0x00,
+    0x00, 0x1E, 0x80, 0x00, 0x80, 0x21, 0xC0, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80,
+    0x00, 0x06, 0x41, 0x40, 0x01, 0x07, 0x81, 0x40, 0x02, 0x07, 0xC1, 0x40, 0x02, 0x24, 0x81, 0x80,
+    0x00, 0x4E, 0x81, 0x00, 0x02, 0xCD, 0x40, 0x81, 0x01, 0x46, 0x41, 0x40, 0x01, 0x47, 0x81, 0xC1,
+    0x02, 0x8E, 0x81, 0x00, 0x02, 0x64, 0x41, 0x00, 0x01, 0x46, 0x41, 0x40, 0x01, 0x47, 0x81, 0xC0,
+    0x02, 0x47, 0xC1, 0xC1, 0x02, 0x81, 0x01, 0x01, 0x00, 0x64, 0x41, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x02, 0x1E, 0xC0, 0xF8, 0x7F, 0x26, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x05, 0x72,
+    0x6F, 0x6F, 0x74, 0x04, 0x05, 0x73, 0x65, 0x76, 0x6F, 0x04, 0x05, 0x74, 0x69, 0x6D, 0x65, 0x04,
+    0x09, 0x6D, 0x69, 0x6C, 0x6C, 0x69, 0x73, 0x65, 0x63, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x0A, 0x6D, 0x61, 0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73, 0x04, 0x0A, 0x73,
+    0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x65, 0x72, 0x04, 0x06, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x17, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0xEA,
+    0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC,
+    0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0xEF,
+    0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0xEF,
+    0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0xF2,
+    0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0xF3,
+    0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5,
+    0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0xF6,
+    0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0x00, 0x00, 0x00, 0x08, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0x00, 0x00, 0x00, 0x05, 0x6C, 0x61, 0x73, 0x74, 0x0A, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x08, 0x65, 0x6C, 0x61, 0x70, 0x73, 0x65, 0x64, 0x0B, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x04, 0x6E, 0x6F, 0x77, 0x1A, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x02, 0x4D, 0x10, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x65, 0x72, 0x5F, 0x79, 0x69, 0x65,
+    0x6C, 0x64, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x0B, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5F, 0x73, 0x69,
+    0x7A, 0x65, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0A, 0x12, 0x00,
     0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0x87, 0x00, 0x00, 0x01, 0x1F, 0x40, 0x40, 0x01, 0x1E, 0x00,
     0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x86, 0x80, 0xC0, 0x00, 0xC6, 0x00, 0x40, 0x00, 0xC7, 0x00,
-    0x80, 0x01, 0xA4, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x01, 0x80, 0xC6, 0xC1, 0x40, 0x00, 0x00, 0x02,
-    0x00, 0x03, 0x40, 0x02, 0x00, 0x00, 0x80, 0x02, 0x80, 0x00, 0xE4, 0x41, 0x00, 0x02, 0xA9, 0x80,
-    0x00, 0x00, 0x2A, 0x01, 0xFE, 0x7F, 0x86, 0x00, 0x40, 0x00, 0x8A, 0x40, 0x40, 0x00, 0x26, 0x00,
-    0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x06, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x00, 0x04, 0x06,
-    0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x07, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x02, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00,
-    0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00,
-    0x00, 0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00,
-    0x00, 0x52, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00,
-    0x00, 0x53, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x05, 0x64, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x72,
-    0x65, 0x61, 0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66,
+    0x80, 0x01, 0xA4, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x01, 0x80, 0x86, 0xC1, 0x40, 0x00, 0xC0, 0x01,
+    0x80, 0x02, 0x00, 0x02, 0x00, 0x00, 0x40, 0x02, 0x80, 0x00, 0xA4, 0x41, 0x00, 0x02, 0xA9, 0x40,
+    0x00, 0x00, 0x2A, 0x01, 0xFE, 0x7F, 0x26, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x06,
+    0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x00, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x07, 0x73,
+    0x69, 0x67, 0x6E, 0x61, 0x6C, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
+    0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x05, 0x64, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x72,
+    0x65, 0x61, 0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66,
     0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x09, 0x00, 0x00,
     0x00, 0x11, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
     0x29, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63,
     0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02,
-    0x5F, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x76, 0x0A, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x58,
-    0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x40, 0x00, 0x24, 0x80, 0x80, 0x00, 0x46, 0x40, 0x40, 0x00, 0x47, 0x00, 0x80, 0x00, 0x1F, 0x80,
-    0xC0, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x46, 0xC0, 0xC0, 0x00, 0x86, 0x40,
-    0x40, 0x00, 0x87, 0x00, 0x00, 0x01, 0x64, 0x00, 0x01, 0x01, 0x1E, 0x80, 0x00, 0x80, 0x86, 0x01,
-    0x41, 0x00, 0xC0, 0x01, 0x80, 0x02, 0xA4, 0x41, 0x00, 0x01, 0x69, 0x80, 0x00, 0x00, 0xEA, 0x80,
-    0xFE, 0x7F, 0x46, 0x40, 0x40, 0x00, 0x4A, 0x80, 0x40, 0x00, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x06, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x00,
-    0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x07, 0x75, 0x6E, 0x6C, 0x69, 0x6E, 0x6B, 0x02,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x59,
-    0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x5A,
-    0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5B,
-    0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5C,
-    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x5B,
-    0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x02, 0x73, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66,
-    0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x0B, 0x00, 0x00,
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
-    0x29, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63,
-    0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02,
-    0x5F, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x76, 0x0C, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0B, 0x14, 0x00, 0x00, 0x00, 0x86, 0x00,
-    0x40, 0x00, 0x87, 0x00, 0x00, 0x01, 0x1F, 0x40, 0x40, 0x01, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00,
-    0x80, 0x00, 0x86, 0x80, 0xC0, 0x00, 0xC6, 0x00, 0x40, 0x00, 0xC7, 0x00, 0x80, 0x01, 0xA4, 0x00,
-    0x01, 0x01, 0x1E, 0x00, 0x01, 0x80, 0xC6, 0xC1, 0x40, 0x00, 0x00, 0x02, 0x00, 0x03, 0x40, 0x02,
-    0x00, 0x00, 0x80, 0x02, 0x80, 0x00, 0xE4, 0x41, 0x00, 0x02, 0xA9, 0x80, 0x00, 0x00, 0x2A, 0x01,
-    0xFE, 0x7F, 0x86, 0x00, 0x40, 0x00, 0x8A, 0x40, 0x40, 0x00, 0x26, 0x00, 0x80, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x04, 0x09, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x73, 0x00, 0x04, 0x06, 0x70,
-    0x61, 0x69, 0x72, 0x73, 0x04, 0x07, 0x6E, 0x6F, 0x74, 0x69, 0x66, 0x79, 0x02, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
-    0x62, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
-    0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
-    0x63, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
-    0x66, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x05, 0x64, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65,
-    0x61, 0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F,
-    0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x09, 0x00, 0x00, 0x00,
-    0x11, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29,
-    0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F,
-    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x5F,
-    0x0A, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x76, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x69, 0x00,
-    0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x0A, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40,
-    0x00, 0x86, 0x40, 0xC0, 0x00, 0x64, 0x00, 0x01, 0x01, 0x1E, 0x80, 0x00, 0x80, 0x1F, 0x40, 0x01,
-    0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x01, 0x00, 0x01, 0x69, 0x80, 0x00, 0x00, 0xEA, 0x80, 0xFE,
-    0x7F, 0x26, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73,
-    0x04, 0x0A, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x6A,
-    0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x6B,
-    0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x6D,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x63, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F,
-    0x72, 0x29, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20,
-    0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x28,
-    0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x03, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x02, 0x6B, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x76,
-    0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E,
-    0x56, 0x02, 0x4D, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x0F,
-    0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0x64, 0x80, 0x00, 0x01, 0x1F,
-    0x40, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x00, 0x01, 0x46, 0x80, 0xC0, 0x00, 0x47,
-    0x00, 0x80, 0x00, 0x62, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x46,
-    0x80, 0xC0, 0x00, 0x47, 0x00, 0x80, 0x00, 0x66, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x04, 0x05, 0x74, 0x79, 0x70, 0x65, 0x04, 0x07, 0x6E, 0x75, 0x6D, 0x62, 0x65,
-    0x72, 0x04, 0x06, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x71, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
-    0x71, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
-    0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x02, 0x4D,
-    0x00, 0x75, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x40, 0x00, 0x07, 0x40, 0x40, 0x00, 0x24, 0x80, 0x80, 0x00, 0x22, 0x00, 0x00, 0x00,
-    0x1E, 0xC0, 0x00, 0x80, 0x46, 0x80, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x01,
-    0x66, 0x00, 0x00, 0x00, 0x26, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x63, 0x6F,
-    0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x04, 0x08, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67,
-    0x04, 0x06, 0x77, 0x68, 0x6F, 0x69, 0x73, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x76,
-    0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x77,
-    0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x03, 0x63, 0x6F, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x02, 0x4D, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x04, 0x14, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x47, 0x00, 0x80,
-    0x00, 0x62, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x86, 0x40, 0xC0, 0x00, 0xC0, 0x00, 0x80,
-    0x00, 0xA4, 0x80, 0x00, 0x01, 0x1F, 0x80, 0x40, 0x01, 0x1E, 0xC0, 0x01, 0x80, 0x86, 0xC0, 0xC0,
-    0x00, 0x87, 0x00, 0x41, 0x01, 0xC0, 0x00, 0x80, 0x00, 0xA4, 0x80, 0x00, 0x01, 0x5F, 0x40, 0x41,
-    0x01, 0x1E, 0x40, 0x00, 0x80, 0x83, 0x00, 0x80, 0x00, 0xA6, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00,
-    0x00, 0xA6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x70,
-    0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x04, 0x05, 0x74, 0x79, 0x70, 0x65, 0x04, 0x07,
-    0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E,
-    0x65, 0x04, 0x07, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x04, 0x05, 0x64, 0x65, 0x61, 0x64, 0x02,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x7B,
-    0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03,
-    0x63, 0x6F, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D,
-    0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x82, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x04, 0x11, 0x00, 0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x80, 0x00,
-    0x01, 0xA2, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0x83, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00,
-    0x01, 0x62, 0x40, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x86, 0x40, 0x40, 0x00, 0xA4, 0x80, 0x80,
-    0x00, 0x40, 0x00, 0x00, 0x01, 0x86, 0x80, 0x40, 0x00, 0x8A, 0x40, 0x00, 0x00, 0x83, 0x00, 0x80,
-    0x00, 0xA6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x08, 0x77,
-    0x68, 0x65, 0x72, 0x65, 0x69, 0x73, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x06, 0x6E, 0x61,
-    0x6D, 0x65, 0x73, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
-    0x00, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00,
-    0x00, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00,
-    0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00,
-    0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00,
-    0x00, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x00,
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0x89, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x07, 0x16, 0x00, 0x00, 0x00, 0x22, 0x40, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80,
-    0x46, 0x00, 0x40, 0x00, 0x64, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x46, 0x40, 0xC0, 0x00,
-    0x86, 0x80, 0x40, 0x00, 0x64, 0x00, 0x01, 0x01, 0x1E, 0xC0, 0x01, 0x80, 0x5F, 0x00, 0x01, 0x00,
-    0x1E, 0x40, 0x00, 0x80, 0x1F, 0x40, 0x01, 0x00, 0x1E, 0xC0, 0x00, 0x80, 0x86, 0x81, 0x40, 0x00,
-    0x8A, 0xC1, 0x40, 0x02, 0x83, 0x01, 0x80, 0x00, 0xA6, 0x01, 0x00, 0x01, 0x69, 0x80, 0x00, 0x00,
-    0xEA, 0x40, 0xFD, 0x7F, 0x43, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72,
-    0x73, 0x04, 0x06, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00,
-    0x00, 0x8A, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00,
-    0x00, 0x8B, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00,
-    0x00, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00,
-    0x00, 0x8D, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00,
-    0x00, 0x8B, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
-    0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F,
-    0x72, 0x29, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20,
-    0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0E, 0x28,
-    0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x08, 0x00, 0x00, 0x00,
-    0x13, 0x00, 0x00, 0x00, 0x02, 0x6B, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x76,
-    0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F,
-    0x45, 0x4E, 0x56, 0x00, 0x94, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0E,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x86, 0x40, 0xC0, 0x00, 0x64,
-    0x00, 0x01, 0x01, 0x1E, 0x00, 0x01, 0x80, 0x86, 0x81, 0x40, 0x00, 0x87, 0xC1, 0x40, 0x03, 0xC0,
-    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0xA4, 0x41, 0x80, 0x01, 0x69, 0x80, 0x00, 0x00, 0xEA,
-    0x00, 0xFE, 0x7F, 0x26, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x06, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x04, 0x06, 0x74,
-    0x61, 0x62, 0x6C, 0x65, 0x04, 0x07, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
-    0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
-    0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
-    0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
-    0x98, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x6E, 0x01, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F,
-    0x72, 0x29, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20,
-    0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x28,
-    0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x04, 0x00, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x02, 0x6B, 0x05, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x02, 0x5F,
-    0x05, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E,
-    0x56, 0x02, 0x4D, 0x00, 0x9A, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x1B,
-    0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x47, 0x40, 0xC0, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x64,
-    0x80, 0x00, 0x01, 0x86, 0x80, 0x40, 0x00, 0x87, 0xC0, 0x40, 0x01, 0xC6, 0x00, 0x41, 0x01, 0x00,
-    0x01, 0x80, 0x00, 0xA4, 0x40, 0x80, 0x01, 0x86, 0x00, 0x41, 0x01, 0x9C, 0x00, 0x00, 0x01, 0xC6,
-    0x40, 0x41, 0x01, 0x0B, 0x01, 0x00, 0x00, 0xCA, 0x00, 0x01, 0x01, 0xC6, 0x80, 0x41, 0x01, 0xCA,
-    0xC0, 0x41, 0x01, 0xC5, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x6D, 0x01, 0x00, 0x00, 0xE4,
-    0xC0, 0x00, 0x00, 0xE2, 0x40, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x44, 0x01, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x02, 0x66, 0x01, 0x80, 0x01, 0xA6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x04, 0x07,
-    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x04, 0x06, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x04, 0x07, 0x69,
-    0x6E, 0x73, 0x65, 0x72, 0x74, 0x04, 0x0A, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73,
-    0x04, 0x0A, 0x6D, 0x61, 0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73, 0x04, 0x09, 0x74, 0x69, 0x6D,
-    0x65, 0x6F, 0x75, 0x74, 0x73, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x9C,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x40, 0x00, 0x07, 0x40, 0x40, 0x00, 0x24, 0x40, 0x80, 0x00, 0x05, 0x00, 0x80, 0x00, 0x6D, 0x00,
-    0x00, 0x00, 0x24, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x24, 0x40, 0x80, 0x00, 0x26, 0x00,
-    0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E,
-    0x65, 0x04, 0x06, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x9D, 0x00,
-    0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00,
-    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x05, 0x66, 0x75, 0x6E, 0x63,
-    0x10, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x64, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x79,
-    0x1B, 0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x9B, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00,
-    0xA1, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00,
-    0xA3, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00,
-    0xA5, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00,
-    0xA6, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00,
-    0x00, 0x03, 0x63, 0x6F, 0x04, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64,
-    0x0B, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x07, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x14,
-    0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x07, 0x65, 0x72, 0x72, 0x6D, 0x73, 0x67, 0x14, 0x00,
-    0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x10,
-    0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x64, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x02,
-    0x4D, 0x0F, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65,
-    0x00, 0xAA, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00,
-    0x46, 0x00, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC1, 0x40, 0x00, 0x00, 0x64, 0x40, 0x80, 0x01,
-    0x26, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x06, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x13,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0xAB, 0x00,
-    0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x72,
-    0x65, 0x61, 0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0xAE, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x07, 0x1E, 0x00, 0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0xC6, 0x40, 0xC0, 0x00, 0xC7, 0x00,
-    0x80, 0x01, 0xA4, 0x80, 0x00, 0x01, 0x1F, 0x80, 0x40, 0x01, 0x1E, 0x00, 0x05, 0x80, 0x86, 0xC0,
-    0x40, 0x00, 0x87, 0x00, 0x41, 0x01, 0xC6, 0x40, 0xC0, 0x00, 0xC7, 0x00, 0x80, 0x01, 0xA4, 0x80,
-    0x00, 0x01, 0x1F, 0x40, 0x41, 0x01, 0x1E, 0xC0, 0x02, 0x80, 0x86, 0xC0, 0x40, 0x00, 0x87, 0x80,
-    0x41, 0x01, 0xC6, 0x40, 0xC0, 0x00, 0xC7, 0x00, 0x80, 0x01, 0x01, 0xC1, 0x01, 0x00, 0xA4, 0xC0,
-    0x80, 0x01, 0x05, 0x01, 0x00, 0x01, 0x40, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80, 0x00, 0x24, 0x41,
-    0x80, 0x01, 0x03, 0x01, 0x80, 0x00, 0x26, 0x01, 0x00, 0x01, 0x86, 0x00, 0xC2, 0x00, 0x8A, 0x40,
-    0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x04, 0x05, 0x74, 0x79, 0x70, 0x65, 0x04, 0x0A, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73,
-    0x73, 0x65, 0x73, 0x04, 0x07, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x04, 0x0A, 0x63, 0x6F, 0x72,
-    0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x04, 0x07, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x04, 0x0A,
-    0x73, 0x75, 0x73, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x04, 0x07, 0x72, 0x65, 0x73, 0x75, 0x6D,
-    0x65, 0x04, 0x05, 0x45, 0x58, 0x49, 0x54, 0x04, 0x0B, 0x73, 0x6C, 0x61, 0x75, 0x67, 0x68, 0x74,
-    0x65, 0x72, 0x73, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00,
-    0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x00,
-    0x00, 0xB1, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x00,
-    0x00, 0xB2, 0x00, 0x00, 0x00, 0xB2, 0x00, 0x00, 0x00, 0xB2, 0x00, 0x00, 0x00, 0xB2, 0x00, 0x00,
-    0x00, 0xB3, 0x00, 0x00, 0x00, 0xB3, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00,
-    0x00, 0xB7, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65,
-    0x61, 0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x73, 0x74, 0x61,
-    0x74, 0x75, 0x73, 0x13, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x07, 0x65, 0x72, 0x72, 0x6D,
-    0x73, 0x67, 0x13, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x5F,
-    0x45, 0x4E, 0x56, 0x02, 0x4D, 0x0C, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x64, 0x69,
-    0x65, 0x00, 0xBA, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x0F, 0x00, 0x00,
-    0x00, 0x46, 0x00, 0x40, 0x00, 0x64, 0x80, 0x80, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00,
-    0x80, 0x86, 0x40, 0x40, 0x00, 0x8A, 0x00, 0x80, 0x00, 0x85, 0x00, 0x80, 0x00, 0xC0, 0x00, 0x80,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0xA4, 0x40, 0x80, 0x01, 0x22, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00,
-    0x80, 0x86, 0x40, 0x40, 0x00, 0x8A, 0x80, 0xC0, 0x00, 0x26, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x09, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74,
-    0x73, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x08, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x02, 0x4D, 0x0C, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x5F, 0x79, 0x69, 0x65, 0x6C, 0x64,
-    0x00, 0xC1, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x10, 0x00, 0x00, 0x00,
-    0x86, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x80, 0x00, 0x01, 0xA2, 0x40, 0x00, 0x00,
-    0x1E, 0x40, 0x00, 0x80, 0xC3, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x01, 0xC6, 0x40, 0xC0, 0x00,
-    0xC7, 0x80, 0xC0, 0x01, 0x06, 0xC1, 0x40, 0x00, 0x07, 0x81, 0x00, 0x02, 0x40, 0x01, 0x80, 0x00,
-    0xE4, 0x40, 0x80, 0x01, 0xC3, 0x00, 0x80, 0x00, 0xE6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69, 0x73, 0x04, 0x06, 0x74,
-    0x61, 0x62, 0x6C, 0x65, 0x04, 0x07, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x04, 0x0A, 0x6D, 0x61,
-    0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0xC2,
-    0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0xC3,
-    0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0xC4,
-    0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5,
-    0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x6D, 0x73, 0x67, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0xC8, 0x00, 0x00, 0x00,
-    0xCE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x17, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x64,
-    0x80, 0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0x87, 0x40, 0x00, 0x01, 0x9C, 0x00, 0x00, 0x01, 0x1F,
-    0x80, 0x40, 0x01, 0x1E, 0x80, 0x00, 0x80, 0x86, 0xC0, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4,
-    0x40, 0x00, 0x01, 0x86, 0x40, 0x40, 0x00, 0x87, 0x40, 0x00, 0x01, 0x9C, 0x00, 0x00, 0x01, 0x20,
-    0x80, 0x00, 0x81, 0x1E, 0x80, 0x01, 0x80, 0x86, 0x00, 0xC1, 0x00, 0x87, 0x40, 0x41, 0x01, 0xC6,
-    0x40, 0x40, 0x00, 0xC7, 0x40, 0x80, 0x01, 0x01, 0x81, 0x01, 0x00, 0xA5, 0x00, 0x80, 0x01, 0xA6,
-    0x00, 0x00, 0x00, 0x26, 0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C,
-    0x66, 0x04, 0x0A, 0x6D, 0x61, 0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73, 0x13, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x04, 0x06, 0x74, 0x61,
-    0x62, 0x6C, 0x65, 0x04, 0x07, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x13, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x17, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00,
-    0xCA, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00,
-    0xCA, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00,
-    0xCB, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00,
-    0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00,
-    0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x08, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00,
-    0x17, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0xD0, 0x00, 0x00, 0x00,
-    0xEA, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0A, 0x41, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x86,
-    0x00, 0x40, 0x00, 0xC6, 0x40, 0xC0, 0x00, 0xA4, 0x00, 0x01, 0x01, 0x1E, 0xC0, 0x01, 0x80, 0xC6,
-    0x81, 0xC0, 0x00, 0x00, 0x02, 0x80, 0x02, 0x40, 0x02, 0x00, 0x03, 0xE4, 0x81, 0x80, 0x01, 0xE2,
-    0x01, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0xC6, 0x41, 0xC0, 0x00, 0xCA, 0xC1, 0xC0, 0x02, 0xA9,
-    0x80, 0x00, 0x00, 0x2A, 0x41, 0xFD, 0x7F, 0x86, 0x00, 0x40, 0x00, 0xC6, 0x00, 0xC1, 0x00, 0xA4,
-    0x00, 0x01, 0x01, 0x1E, 0x40, 0x0A, 0x80, 0xC6, 0x41, 0xC1, 0x00, 0xC7, 0x41, 0x81, 0x03, 0xE2,
-    0x01, 0x00, 0x00, 0x1E, 0x00, 0x01, 0x80, 0xC6, 0x41, 0xC1, 0x00, 0x06, 0x42, 0xC1, 0x00, 0x07,
-    0x42, 0x01, 0x04, 0x0E, 0x02, 0x00, 0x04, 0xCA, 0x01, 0x82, 0x02, 0xC6, 0x81, 0xC1, 0x00, 0xC7,
-    0x41, 0x81, 0x03, 0xDC, 0x01, 0x80, 0x03, 0x60, 0xC0, 0x81, 0x83, 0x1E, 0xC0, 0x01, 0x80, 0xC6,
-    0x41, 0xC1, 0x00, 0xC7, 0x41, 0x81, 0x03, 0xE2, 0x01, 0x00, 0x00, 0x1E, 0x00, 0x03, 0x80, 0xC6,
-    0x41, 0xC1, 0x00, 0xC7, 0x41, 0x81, 0x03, 0x21, 0xC0, 0xC1, 0x03, 0x1E, 0x00, 0x02, 0x80, 0xC6,
-    0x41, 0xC1, 0x00, 0xC7, 0x41, 0x81, 0x03, 0xE2, 0x01, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0xC6,
-    0x41, 0xC1, 0x00, 0xCA, 0xC1, 0xC0, 0x02, 0xC5, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0xE4,
-    0x41, 0x00, 0x01, 0x62, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x02, 0x80, 0xC6, 0x01, 0x42, 0x00, 0xC7,
-    0x41, 0xC2, 0x03, 0x00, 0x02, 0x00, 0x03, 0xE4, 0x81, 0x00, 0x01, 0x5F, 0x80, 0xC2, 0x03, 0x1E,
-    0x80, 0x00, 0x80, 0x5F, 0xC0, 0xC1, 0x02, 0x1E, 0x00, 0x00, 0x80, 0x43, 0x00, 0x80, 0x00, 0xA9,
-    0x80, 0x00, 0x00, 0x2A, 0xC1, 0xF4, 0x7F, 0x66, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x0B, 0x73, 0x6C, 0x61, 0x75,
-    0x67, 0x68, 0x74, 0x65, 0x72, 0x73, 0x04, 0x05, 0x6B, 0x69, 0x6C, 0x6C, 0x00, 0x04, 0x0A, 0x70,
-    0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x04, 0x09, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75,
-    0x74, 0x73, 0x04, 0x0A, 0x6D, 0x61, 0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73, 0x13, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E,
-    0x65, 0x04, 0x07, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x04, 0x05, 0x64, 0x65, 0x61, 0x64, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
-    0x00, 0xD1, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00,
-    0x00, 0xD3, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00,
-    0x00, 0xD4, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00,
-    0x00, 0xD5, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00,
-    0x00, 0xD9, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00,
-    0x00, 0xDA, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00,
-    0x00, 0xDB, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00,
-    0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00,
-    0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00,
-    0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00,
-    0x00, 0xDE, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00,
-    0x00, 0xDF, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00,
-    0x00, 0xE3, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00,
-    0x00, 0xE3, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x00,
-    0x00, 0xE4, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00,
-    0x00, 0xEA, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x00,
-    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x06, 0x61, 0x6C, 0x69, 0x76, 0x65, 0x01, 0x00, 0x00,
-    0x00, 0x41, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72,
-    0x61, 0x74, 0x6F, 0x72, 0x29, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66,
-    0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x04,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x05, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x61, 0x73, 0x6F, 0x6E, 0x05, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F,
-    0x72, 0x29, 0x12, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20,
-    0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x12, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0E, 0x28,
-    0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x12, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x02, 0x6B, 0x13, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x02, 0x76,
-    0x13, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E,
-    0x56, 0x02, 0x4D, 0x0F, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x72, 0x65, 0x73, 0x75,
-    0x6D, 0x65, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x2D, 0x00,
-    0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x64, 0x80, 0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0xC0, 0x00,
-    0x00, 0x00, 0xA4, 0x80, 0x00, 0x01, 0xA2, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00,
-    0x80, 0x00, 0xC6, 0x80, 0x40, 0x00, 0xC7, 0x40, 0x80, 0x01, 0x1F, 0xC0, 0xC0, 0x01, 0x1E, 0x80,
-    0x00, 0x80, 0xC6, 0x80, 0x40, 0x00, 0x0B, 0x01, 0x00, 0x00, 0xCA, 0x00, 0x81, 0x00, 0xC6, 0x80,
-    0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0x1F, 0xC0, 0xC0, 0x01, 0x1E, 0x80, 0x00, 0x80, 0xC6, 0x80,
-    0x40, 0x00, 0x0B, 0x01, 0x00, 0x00, 0xCA, 0x00, 0x01, 0x01, 0xC6, 0x00, 0xC1, 0x00, 0x06, 0x81,
-    0x40, 0x00, 0x07, 0x41, 0x00, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x1E, 0x80, 0x00, 0x80, 0x1F, 0xC0,
-    0x01, 0x01, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0xE9, 0x80, 0x00, 0x00, 0x6A, 0x81,
-    0xFE, 0x7F, 0xC6, 0x40, 0xC1, 0x00, 0xC7, 0x80, 0xC1, 0x01, 0x06, 0x81, 0x40, 0x00, 0x07, 0x41,
-    0x00, 0x02, 0x40, 0x01, 0x00, 0x01, 0xE4, 0x40, 0x80, 0x01, 0xC6, 0x40, 0xC1, 0x00, 0xC7, 0x80,
-    0xC1, 0x01, 0x06, 0x81, 0x40, 0x00, 0x07, 0x81, 0x00, 0x02, 0x40, 0x01, 0x80, 0x00, 0xE4, 0x40,
-    0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66,
-    0x04, 0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69, 0x73, 0x04, 0x06, 0x6C, 0x69, 0x6E, 0x6B, 0x73,
-    0x00, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x06, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x04,
-    0x07, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0xEE,
-    0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0xEF,
-    0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0xF1,
-    0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0xF2,
-    0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0xF2,
-    0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0xF2,
-    0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5,
-    0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF6,
-    0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0xF6,
-    0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05,
-    0x64, 0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x02, 0x73, 0x02, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x05, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F,
-    0x72, 0x29, 0x1A, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20,
-    0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x1A, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0E, 0x28,
-    0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x1A, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x02, 0x5F, 0x1B, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02, 0x76,
-    0x1B, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F,
-    0x45, 0x4E, 0x56, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0D,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x24, 0xC0, 0x00, 0x00, 0x22,
-    0x40, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x84, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0xA6,
-    0x00, 0x80, 0x01, 0x86, 0x40, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x40, 0x00, 0x01, 0x26,
-    0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x06, 0x73, 0x70, 0x61,
-    0x77, 0x6E, 0x04, 0x05, 0x6C, 0x69, 0x6E, 0x6B, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00,
-    0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFB, 0x00,
-    0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x70,
-    0x69, 0x64, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 0x65, 0x72, 0x72, 0x6D, 0x73,
-    0x67, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x0D, 0x01, 0x00, 0x00, 0x01, 0x00, 0x09, 0x2A, 0x00, 0x00, 0x00, 0x46,
-    0x00, 0x40, 0x00, 0x64, 0x80, 0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4,
-    0x80, 0x00, 0x01, 0xA2, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0xC6,
-    0x80, 0x40, 0x00, 0xC7, 0x40, 0x80, 0x01, 0x5F, 0xC0, 0xC0, 0x01, 0x1E, 0xC0, 0x00, 0x80, 0xC6,
-    0x80, 0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0x1F, 0xC0, 0xC0, 0x01, 0x1E, 0x00, 0x00, 0x80, 0x26,
-    0x00, 0x80, 0x00, 0xC6, 0x00, 0xC1, 0x00, 0x06, 0x81, 0x40, 0x00, 0x07, 0x41, 0x00, 0x02, 0xE4,
-    0x00, 0x01, 0x01, 0x1E, 0x00, 0x01, 0x80, 0x1F, 0xC0, 0x01, 0x01, 0x1E, 0x80, 0x00, 0x80, 0x06,
-    0x82, 0x40, 0x00, 0x07, 0x42, 0x00, 0x04, 0x0A, 0xC2, 0x40, 0x03, 0xE9, 0x80, 0x00, 0x00, 0x6A,
-    0x01, 0xFE, 0x7F, 0xC6, 0x00, 0xC1, 0x00, 0x06, 0x81, 0x40, 0x00, 0x07, 0x81, 0x00, 0x02, 0xE4,
-    0x00, 0x01, 0x01, 0x1E, 0x00, 0x01, 0x80, 0x1F, 0xC0, 0x81, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x06,
-    0x82, 0x40, 0x00, 0x07, 0x82, 0x00, 0x04, 0x0A, 0xC2, 0x40, 0x03, 0xE9, 0x80, 0x00, 0x00, 0x6A,
-    0x01, 0xFE, 0x7F, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C,
-    0x66, 0x04, 0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69, 0x73, 0x04, 0x06, 0x6C, 0x69, 0x6E, 0x6B,
-    0x73, 0x00, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
-    0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00,
-    0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00,
+    0x76, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05,
+    0x5F, 0x45, 0x4E, 0x56, 0x00, 0x02, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x24, 0x80, 0x80, 0x00, 0x46, 0x40, 0x40, 0x00,
+    0x47, 0x00, 0x80, 0x00, 0x1F, 0x80, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00,
+    0x46, 0xC0, 0xC0, 0x00, 0x86, 0x40, 0x40, 0x00, 0x87, 0x00, 0x00, 0x01, 0x64, 0x00, 0x01, 0x01,
+    0x1E, 0x80, 0x00, 0x80, 0x46, 0x01, 0x41, 0x00, 0x80, 0x01, 0x00, 0x02, 0x64, 0x41, 0x00, 0x01,
+    0x69, 0x40, 0x00, 0x00, 0xEA, 0x80, 0xFE, 0x7F, 0x46, 0x40, 0x40, 0x00, 0x4A, 0x80, 0x40, 0x00,
+    0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x06,
+    0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x00, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x07, 0x75,
+    0x6E, 0x6C, 0x69, 0x6E, 0x6B, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00,
     0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00,
-    0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00,
-    0x00, 0x07, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00,
-    0x00, 0x08, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00,
-    0x00, 0x08, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x0A, 0x01, 0x00,
-    0x00, 0x0A, 0x01, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x0A, 0x01, 0x00,
-    0x00, 0x0B, 0x01, 0x00, 0x00, 0x0B, 0x01, 0x00, 0x00, 0x0B, 0x01, 0x00, 0x00, 0x0B, 0x01, 0x00,
-    0x00, 0x0B, 0x01, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x0D, 0x01, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00,
-    0x00, 0x00, 0x02, 0x73, 0x02, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64,
-    0x05, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65,
-    0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x15, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x15, 0x00, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F,
-    0x6C, 0x29, 0x15, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x02, 0x6B, 0x16, 0x00, 0x00, 0x00,
-    0x1B, 0x00, 0x00, 0x00, 0x02, 0x76, 0x16, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x10, 0x28,
-    0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x21, 0x00,
-    0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74,
-    0x65, 0x29, 0x21, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20,
-    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x21, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-    0x02, 0x6B, 0x22, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x76, 0x22, 0x00, 0x00, 0x00,
-    0x27, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00,
-    0x0F, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x03, 0x00, 0x06, 0x05, 0x00, 0x00, 0x00, 0xC6,
-    0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x01, 0xE4, 0x40, 0x80, 0x01, 0x26,
-    0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x05, 0x6B, 0x69, 0x6C, 0x6C, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x10,
-    0x01, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x05, 0x64, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65,
-    0x61, 0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x02, 0x4D, 0x00, 0x13, 0x01, 0x00, 0x00, 0x1C, 0x01, 0x00, 0x00, 0x01, 0x00, 0x09, 0x20, 0x00,
+    0x00, 0x05, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00,
+    0x00, 0x05, 0x01, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x06, 0x01, 0x00,
+    0x00, 0x05, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00,
+    0x00, 0x09, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x73, 0x02, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74,
+    0x6F, 0x72, 0x29, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72,
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E,
+    0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x0B, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x76, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x0B, 0x01, 0x00, 0x00, 0x12,
+    0x01, 0x00, 0x00, 0x02, 0x00, 0x0A, 0x1B, 0x00, 0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0x87, 0x00,
+    0x00, 0x01, 0x1F, 0x40, 0x40, 0x01, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x86, 0x80,
+    0xC0, 0x00, 0xC6, 0x00, 0x40, 0x00, 0xC7, 0x00, 0x80, 0x01, 0xA4, 0x00, 0x01, 0x01, 0x1E, 0xC0,
+    0x02, 0x80, 0x86, 0xC1, 0x40, 0x00, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x02, 0x00, 0x00, 0x40, 0x02,
+    0x80, 0x00, 0xA4, 0x41, 0x00, 0x02, 0x86, 0x01, 0x41, 0x00, 0x87, 0x41, 0x01, 0x03, 0xA2, 0x01,
+    0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x86, 0x01, 0x41, 0x00, 0x87, 0x41, 0x01, 0x03, 0x8A, 0x41,
+    0x40, 0x00, 0xA9, 0x40, 0x00, 0x00, 0x2A, 0x41, 0xFC, 0x7F, 0x86, 0x00, 0x40, 0x00, 0x8A, 0x40,
+    0x40, 0x00, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x09, 0x6D, 0x6F, 0x6E, 0x69,
+    0x74, 0x6F, 0x72, 0x73, 0x00, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x07, 0x6E, 0x6F,
+    0x74, 0x69, 0x66, 0x79, 0x04, 0x09, 0x77, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x02, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x0C, 0x01,
+    0x00, 0x00, 0x0C, 0x01, 0x00, 0x00, 0x0C, 0x01, 0x00, 0x00, 0x0C, 0x01, 0x00, 0x00, 0x0C, 0x01,
+    0x00, 0x00, 0x0D, 0x01, 0x00, 0x00, 0x0D, 0x01, 0x00, 0x00, 0x0D, 0x01, 0x00, 0x00, 0x0D, 0x01,
+    0x00, 0x00, 0x0D, 0x01, 0x00, 0x00, 0x0E, 0x01, 0x00, 0x00, 0x0E, 0x01, 0x00, 0x00, 0x0E, 0x01,
+    0x00, 0x00, 0x0E, 0x01, 0x00, 0x00, 0x0E, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01,
+    0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0F, 0x01,
+    0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0D, 0x01, 0x00, 0x00, 0x0D, 0x01, 0x00, 0x00, 0x11, 0x01,
+    0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x64,
+    0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x61, 0x73,
+    0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20,
+    0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x09, 0x00, 0x00, 0x00, 0x18, 0x00,
+    0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x09, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+    0x72, 0x6F, 0x6C, 0x29, 0x09, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0x76, 0x0A, 0x00,
+    0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E,
+    0x56, 0x00, 0x14, 0x01, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x06, 0x00, 0x00,
+    0x00, 0x45, 0x00, 0x00, 0x00, 0x58, 0x40, 0x00, 0x00, 0x85, 0x00, 0x80, 0x00, 0x54, 0x80, 0x80,
+    0x00, 0x66, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x15, 0x01, 0x00,
+    0x00, 0x15, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00,
+    0x00, 0x16, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x49, 0x44, 0x5F, 0x53, 0x4C,
+    0x4F, 0x54, 0x5F, 0x42, 0x49, 0x54, 0x53, 0x10, 0x50, 0x49, 0x44, 0x5F, 0x57, 0x4F, 0x52, 0x4B,
+    0x45, 0x52, 0x5F, 0x4D, 0x41, 0x53, 0x4B, 0x00, 0x19, 0x01, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x0A, 0x23, 0x00, 0x00, 0x00, 0xE3, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0xC1,
+    0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0xD7, 0x00, 0x81, 0x01, 0x06, 0x41, 0xC0, 0x00, 0x5F,
+    0x00, 0x81, 0x01, 0x1E, 0xC0, 0x04, 0x80, 0x06, 0x81, 0xC0, 0x00, 0x46, 0x41, 0xC0, 0x00, 0x07,
+    0x41, 0x01, 0x02, 0x46, 0x81, 0xC0, 0x00, 0x86, 0x81, 0xC0, 0x00, 0xC6, 0x41, 0xC0, 0x00, 0x00,
+    0x02, 0x00, 0x02, 0x8A, 0xC1, 0xC0, 0x03, 0x4A, 0x01, 0x82, 0x01, 0x46, 0x01, 0xC1, 0x00, 0x86,
+    0x01, 0xC1, 0x00, 0xC6, 0x41, 0xC0, 0x00, 0x06, 0x02, 0xC1, 0x00, 0x46, 0x42, 0xC0, 0x00, 0x07,
+    0x42, 0x02, 0x04, 0x8A, 0xC1, 0xC0, 0x03, 0x4A, 0x01, 0x82, 0x01, 0x46, 0x41, 0xC1, 0x00, 0x4A,
+    0xC1, 0x00, 0x02, 0x48, 0xC0, 0x80, 0x80, 0x23, 0x41, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x01,
+    0x01, 0x00, 0x00, 0x48, 0x00, 0x01, 0x83, 0x48, 0x40, 0x80, 0x83, 0x48, 0x80, 0x00, 0x84, 0x26,
+    0x00, 0x80, 0x00, 0x09, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x05, 0x72, 0x6F, 0x6F, 0x74, 0x04, 0x0A, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65,
+    0x73, 0x00, 0x04, 0x0A, 0x6D, 0x61, 0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73, 0x04, 0x05, 0x70,
+    0x69, 0x64, 0x73, 0x04, 0x07, 0x77, 0x6F, 0x72, 0x6B, 0x65, 0x72, 0x04, 0x06, 0x72, 0x6F, 0x75,
+    0x74, 0x65, 0x04, 0x05, 0x70, 0x6F, 0x6C, 0x6C, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x00,
+    0x1A, 0x01, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x00, 0x1B, 0x01, 0x00, 0x00,
+    0x1B, 0x01, 0x00, 0x00, 0x1B, 0x01, 0x00, 0x00, 0x1C, 0x01, 0x00, 0x00, 0x1C, 0x01, 0x00, 0x00,
+    0x1C, 0x01, 0x00, 0x00, 0x1D, 0x01, 0x00, 0x00, 0x1D, 0x01, 0x00, 0x00, 0x1D, 0x01, 0x00, 0x00,
+    0x1D, 0x01, 0x00, 0x00, 0x1D, 0x01, 0x00, 0x00, 0x1D, 0x01, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x00,
+    0x1E, 0x01, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x00,
+    0x1E, 0x01, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00,
+    0x1F, 0x01, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00,
+    0x22, 0x01, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00,
+    0x25, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x77, 0x6F, 0x72, 0x6B, 0x65, 0x72, 0x00,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x06, 0x72, 0x6F, 0x75, 0x74, 0x65, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x00, 0x00, 0x00, 0x05, 0x70, 0x6F, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00,
+    0x00, 0x00, 0x05, 0x72, 0x6F, 0x6F, 0x74, 0x05, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03,
+    0x63, 0x6F, 0x0B, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0E, 0x50,
+    0x49, 0x44, 0x5F, 0x53, 0x4C, 0x4F, 0x54, 0x5F, 0x42, 0x49, 0x54, 0x53, 0x02, 0x4D, 0x00, 0x27,
+    0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x40, 0x00, 0x26, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x06,
+    0x63, 0x6F, 0x75, 0x6E, 0x74, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x2D, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x47, 0x00, 0x80,
+    0x00, 0x66, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x05, 0x70,
+    0x69, 0x64, 0x73, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x2C, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x2D, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x63, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0x2F, 0x01, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0x64, 0x80,
+    0x00, 0x01, 0x1F, 0x40, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x00, 0x01, 0x46, 0x80,
+    0xC0, 0x00, 0x47, 0x00, 0x80, 0x00, 0x62, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00,
+    0x80, 0x00, 0x46, 0x80, 0xC0, 0x00, 0x47, 0x00, 0x80, 0x00, 0x66, 0x00, 0x00, 0x01, 0x26, 0x00,
+    0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x05, 0x74, 0x79, 0x70, 0x65, 0x04, 0x07, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x04, 0x06, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x30,
+    0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x30,
+    0x01, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x31,
+    0x01, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x32,
+    0x01, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x61, 0x6D, 0x65,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E,
+    0x56, 0x02, 0x4D, 0x00, 0x35, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x07, 0x40, 0x40, 0x00, 0x24, 0x80, 0x80, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x1E, 0xC0, 0x00, 0x80, 0x46, 0x80, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x65,
+    0x00, 0x00, 0x01, 0x66, 0x00, 0x00, 0x00, 0x26, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04,
+    0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x04, 0x08, 0x72, 0x75, 0x6E, 0x6E,
+    0x69, 0x6E, 0x67, 0x04, 0x06, 0x77, 0x68, 0x6F, 0x69, 0x73, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x36, 0x01,
+    0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x37, 0x01,
+    0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x38, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x63, 0x6F, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x02, 0x4D, 0x00, 0x3A, 0x01, 0x00,
+    0x00, 0x40, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x14, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00,
+    0x47, 0x00, 0x80, 0x00, 0x62, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x86, 0x40, 0xC0, 0x00,
+    0xC0, 0x00, 0x80, 0x00, 0xA4, 0x80, 0x00, 0x01, 0x1F, 0x80, 0x40, 0x01, 0x1E, 0xC0, 0x01, 0x80,
+    0x86, 0xC0, 0xC0, 0x00, 0x87, 0x00, 0x41, 0x01, 0xC0, 0x00, 0x80, 0x00, 0xA4, 0x80, 0x00, 0x01,
+    0x5F, 0x40, 0x41, 0x01, 0x1E, 0x40, 0x00, 0x80, 0x83, 0x00, 0x80, 0x00, 0xA6, 0x00, 0x00, 0x01,
+    0x83, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x04, 0x0A, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x04, 0x05, 0x74, 0x79, 0x70,
+    0x65, 0x04, 0x07, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75,
+    0x74, 0x69, 0x6E, 0x65, 0x04, 0x07, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x04, 0x05, 0x64, 0x65,
+    0x61, 0x64, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+    0x00, 0x00, 0x3B, 0x01, 0x00, 0x00, 0x3B, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01,
+    0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01,
+    0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01,
+    0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3D, 0x01,
+    0x00, 0x00, 0x3D, 0x01, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x40, 0x01,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+    0x00, 0x00, 0x03, 0x63, 0x6F, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x42, 0x01, 0x00, 0x00, 0x47, 0x01, 0x00,
+    0x00, 0x02, 0x00, 0x04, 0x11, 0x00, 0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00,
+    0xA4, 0x80, 0x00, 0x01, 0xA2, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0x83, 0x00, 0x00, 0x00,
+    0xA6, 0x00, 0x00, 0x01, 0x62, 0x40, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x86, 0x40, 0x40, 0x00,
+    0xA4, 0x80, 0x80, 0x00, 0x40, 0x00, 0x00, 0x01, 0x86, 0x80, 0x40, 0x00, 0x8A, 0x40, 0x00, 0x00,
+    0x83, 0x00, 0x80, 0x00, 0xA6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x04, 0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69, 0x73, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04,
+    0x06, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00,
+    0x43, 0x01, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00,
+    0x44, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00,
+    0x44, 0x01, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x46, 0x01, 0x00, 0x00,
+    0x46, 0x01, 0x00, 0x00, 0x47, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x61, 0x6D,
+    0x65, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0x49, 0x01, 0x00, 0x00,
+    0x52, 0x01, 0x00, 0x00, 0x01, 0x00, 0x07, 0x16, 0x00, 0x00, 0x00, 0x22, 0x40, 0x00, 0x00, 0x1E,
+    0x80, 0x00, 0x80, 0x46, 0x00, 0x40, 0x00, 0x64, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x46,
+    0x40, 0xC0, 0x00, 0x86, 0x80, 0x40, 0x00, 0x64, 0x00, 0x01, 0x01, 0x1E, 0xC0, 0x01, 0x80, 0x5F,
+    0x00, 0x01, 0x00, 0x1E, 0x40, 0x00, 0x80, 0x1F, 0x40, 0x01, 0x00, 0x1E, 0xC0, 0x00, 0x80, 0x86,
+    0x81, 0x40, 0x00, 0x8A, 0xC1, 0x40, 0x02, 0x83, 0x01, 0x80, 0x00, 0xA6, 0x01, 0x00, 0x01, 0x69,
+    0x80, 0x00, 0x00, 0xEA, 0x40, 0xFD, 0x7F, 0x43, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x01, 0x26,
+    0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x06, 0x70,
+    0x61, 0x69, 0x72, 0x73, 0x04, 0x06, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x4A, 0x01, 0x00, 0x00,
+    0x4A, 0x01, 0x00, 0x00, 0x4A, 0x01, 0x00, 0x00, 0x4A, 0x01, 0x00, 0x00, 0x4A, 0x01, 0x00, 0x00,
+    0x4B, 0x01, 0x00, 0x00, 0x4B, 0x01, 0x00, 0x00, 0x4B, 0x01, 0x00, 0x00, 0x4B, 0x01, 0x00, 0x00,
+    0x4C, 0x01, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00,
+    0x4D, 0x01, 0x00, 0x00, 0x4D, 0x01, 0x00, 0x00, 0x4E, 0x01, 0x00, 0x00, 0x4E, 0x01, 0x00, 0x00,
+    0x4B, 0x01, 0x00, 0x00, 0x4B, 0x01, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00,
+    0x52, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72,
+    0x61, 0x74, 0x6F, 0x72, 0x29, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66,
+    0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00,
+    0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x08,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x6B, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x02, 0x76, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
+    0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x54, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x86, 0x40,
+    0xC0, 0x00, 0x64, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x01, 0x80, 0x86, 0x81, 0x40, 0x00, 0x87, 0xC1,
+    0x40, 0x03, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0xA4, 0x41, 0x80, 0x01, 0x69, 0x80,
+    0x00, 0x00, 0xEA, 0x00, 0xFE, 0x7F, 0x26, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x06, 0x6E, 0x61, 0x6D, 0x65, 0x73,
+    0x04, 0x06, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x04, 0x07, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x55,
+    0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x56,
+    0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x56,
+    0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x57,
+    0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x6E, 0x01, 0x00, 0x00,
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72,
+    0x61, 0x74, 0x6F, 0x72, 0x29, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66,
+    0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,
+    0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x04,
+    0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x6B, 0x05, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    0x00, 0x02, 0x5F, 0x05, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05,
+    0x5F, 0x45, 0x4E, 0x56, 0x02, 0x4D, 0x00, 0x5A, 0x01, 0x00, 0x00, 0x6A, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x07, 0x1F, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x47, 0x40, 0xC0, 0x00, 0xAC, 0x00,
+    0x00, 0x00, 0x64, 0x80, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0xA4, 0x80, 0x80, 0x00, 0xC6, 0x80,
+    0xC0, 0x01, 0xCA, 0x40, 0x00, 0x01, 0xC6, 0xC0, 0xC0, 0x01, 0xCA, 0x80, 0x80, 0x00, 0xC6, 0x00,
+    0xC1, 0x01, 0x05, 0x01, 0x00, 0x02, 0x24, 0x81, 0x80, 0x00, 0xCA, 0x00, 0x01, 0x01, 0xC6, 0x40,
+    0xC1, 0x01, 0xCD, 0x80, 0xC1, 0x01, 0xC8, 0xC0, 0x80, 0x82, 0xC5, 0x00, 0x80, 0x02, 0x00, 0x01,
+    0x80, 0x00, 0x6D, 0x01, 0x00, 0x00, 0xE4, 0xC0, 0x00, 0x00, 0xE2, 0x40, 0x00, 0x00, 0x1E, 0x80,
+    0x00, 0x80, 0x44, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x02, 0x66, 0x01, 0x80, 0x01, 0x45, 0x01,
+    0x00, 0x03, 0x80, 0x01, 0x00, 0x01, 0x64, 0x41, 0x00, 0x01, 0xA6, 0x00, 0x00, 0x01, 0x26, 0x00,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E,
+    0x65, 0x04, 0x07, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x04, 0x0A, 0x70, 0x72, 0x6F, 0x63, 0x65,
+    0x73, 0x73, 0x65, 0x73, 0x04, 0x05, 0x70, 0x69, 0x64, 0x73, 0x04, 0x0A, 0x6D, 0x61, 0x69, 0x6C,
+    0x62, 0x6F, 0x78, 0x65, 0x73, 0x04, 0x06, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x13, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x01, 0x0A, 0x01,
+    0x00, 0x01, 0x06, 0x01, 0x16, 0x01, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x01, 0x00, 0x00,
+    0x60, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x07,
+    0x40, 0x40, 0x00, 0x24, 0x40, 0x80, 0x00, 0x05, 0x00, 0x80, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x24,
+    0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x24, 0x40, 0x80, 0x00, 0x26, 0x00, 0x80, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x04, 0x06,
+    0x79, 0x69, 0x65, 0x6C, 0x64, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x5D, 0x01, 0x00, 0x00, 0x5D, 0x01, 0x00, 0x00, 0x5D,
+    0x01, 0x00, 0x00, 0x5E, 0x01, 0x00, 0x00, 0x5E, 0x01, 0x00, 0x00, 0x5E, 0x01, 0x00, 0x00, 0x5F,
+    0x01, 0x00, 0x00, 0x5F, 0x01, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x10, 0x70, 0x72,
+    0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x64, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x1F, 0x00, 0x00,
+    0x00, 0x5B, 0x01, 0x00, 0x00, 0x5B, 0x01, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x5B, 0x01, 0x00,
+    0x00, 0x61, 0x01, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00,
+    0x00, 0x63, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x64, 0x01, 0x00,
+    0x00, 0x64, 0x01, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00,
+    0x00, 0x65, 0x01, 0x00, 0x00, 0x66, 0x01, 0x00, 0x00, 0x66, 0x01, 0x00, 0x00, 0x66, 0x01, 0x00,
+    0x00, 0x66, 0x01, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x67, 0x01, 0x00,
+    0x00, 0x67, 0x01, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x68, 0x01, 0x00,
+    0x00, 0x68, 0x01, 0x00, 0x00, 0x69, 0x01, 0x00, 0x00, 0x6A, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0x63,
+    0x6F, 0x04, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x06, 0x00, 0x00,
+    0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x15, 0x00, 0x00, 0x00,
+    0x1F, 0x00, 0x00, 0x00, 0x07, 0x65, 0x72, 0x72, 0x6D, 0x73, 0x67, 0x15, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x10, 0x70, 0x72, 0x6F,
+    0x63, 0x65, 0x73, 0x73, 0x5F, 0x64, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x0A, 0x70, 0x69, 0x64,
+    0x5F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x02, 0x4D, 0x0A, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5F, 0x6E,
+    0x65, 0x77, 0x0F, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x72, 0x65, 0x73, 0x75, 0x6D,
+    0x65, 0x0D, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x77, 0x61, 0x6B, 0x65, 0x00, 0x6C,
+    0x01, 0x00, 0x00, 0x6E, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x46, 0x00,
+    0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC1, 0x40, 0x00, 0x00, 0x64, 0x40, 0x80, 0x01, 0x26, 0x00,
+    0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x06, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x6D, 0x01, 0x00, 0x00, 0x6D, 0x01, 0x00, 0x00, 0x6D, 0x01, 0x00, 0x00,
+    0x6D, 0x01, 0x00, 0x00, 0x6E, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x61,
+    0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05,
+    0x5F, 0x45, 0x4E, 0x56, 0x00, 0x70, 0x01, 0x00, 0x00, 0x7E, 0x01, 0x00, 0x00, 0x02, 0x00, 0x08,
+    0x2A, 0x00, 0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0x87, 0x00, 0x00, 0x01, 0xC6, 0x40, 0xC0, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0xE4, 0x80, 0x00, 0x01, 0x1F, 0x80, 0xC0, 0x01, 0x1E, 0xC0, 0x07, 0x80,
+    0xC6, 0xC0, 0xC0, 0x00, 0xC7, 0x00, 0xC1, 0x01, 0x00, 0x01, 0x00, 0x01, 0xE4, 0x80, 0x00, 0x01,
+    0x1F, 0x40, 0xC1, 0x01, 0x1E, 0xC0, 0x05, 0x80, 0xC6, 0xC0, 0xC0, 0x00, 0xC7, 0x80, 0xC1, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x41, 0xC1, 0x01, 0x00, 0xE4, 0xC0, 0x80, 0x01, 0x45, 0x01, 0x00, 0x01,
+    0x80, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x80, 0x00, 0x64, 0x41, 0x80, 0x01, 0x46, 0xC1, 0xC0, 0x00,
+    0x47, 0x01, 0xC1, 0x02, 0x80, 0x01, 0x00, 0x01, 0x64, 0x81, 0x00, 0x01, 0x1F, 0x00, 0xC2, 0x02,
+    0x1E, 0x80, 0x01, 0x80, 0x46, 0x01, 0x40, 0x00, 0x47, 0x01, 0x80, 0x02, 0x62, 0x01, 0x00, 0x00,
+    0x1E, 0x80, 0x00, 0x80, 0x45, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x64, 0x41, 0x00, 0x01,
+    0x43, 0x01, 0x80, 0x00, 0x66, 0x01, 0x00, 0x01, 0xC6, 0x40, 0x42, 0x00, 0xCA, 0x40, 0x00, 0x00,
+    0xC3, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x00,
+    0x04, 0x0A, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x04, 0x05, 0x74, 0x79, 0x70,
+    0x65, 0x04, 0x07, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x04, 0x0A, 0x63, 0x6F, 0x72, 0x6F, 0x75,
+    0x74, 0x69, 0x6E, 0x65, 0x04, 0x07, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x04, 0x0A, 0x73, 0x75,
+    0x73, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x04, 0x07, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x04,
+    0x05, 0x45, 0x58, 0x49, 0x54, 0x04, 0x05, 0x64, 0x65, 0x61, 0x64, 0x04, 0x0B, 0x73, 0x6C, 0x61,
+    0x75, 0x67, 0x68, 0x74, 0x65, 0x72, 0x73, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x13, 0x01, 0x15, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x71, 0x01, 0x00, 0x00, 0x71,
+    0x01, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x72,
+    0x01, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x73,
+    0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x74,
+    0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x74,
+    0x01, 0x00, 0x00, 0x75, 0x01, 0x00, 0x00, 0x75, 0x01, 0x00, 0x00, 0x75, 0x01, 0x00, 0x00, 0x75,
+    0x01, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x76,
+    0x01, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x76,
+    0x01, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00, 0x77,
+    0x01, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00, 0x79, 0x01, 0x00, 0x00, 0x79, 0x01, 0x00, 0x00, 0x7B,
+    0x01, 0x00, 0x00, 0x7B, 0x01, 0x00, 0x00, 0x7D, 0x01, 0x00, 0x00, 0x7D, 0x01, 0x00, 0x00, 0x7E,
+    0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x2A,
+    0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x61, 0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00,
+    0x00, 0x00, 0x03, 0x63, 0x6F, 0x02, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x07, 0x73, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x12, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x07, 0x65, 0x72, 0x72,
+    0x6D, 0x73, 0x67, 0x12, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02,
+    0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x0C, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x64,
+    0x69, 0x65, 0x0D, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x72, 0x65, 0x61, 0x70, 0x00,
+    0x80, 0x01, 0x00, 0x00, 0x8F, 0x01, 0x00, 0x00, 0x01, 0x00, 0x05, 0x25, 0x00, 0x00, 0x00, 0x46,
+    0x00, 0x40, 0x00, 0x64, 0x80, 0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0x5F, 0x80, 0x80, 0x00, 0x1E,
+    0x80, 0x03, 0x80, 0x22, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x02, 0x80, 0x86, 0x80, 0x40, 0x00, 0xCB,
+    0x80, 0x00, 0x00, 0x06, 0x01, 0x41, 0x00, 0x0D, 0x01, 0x00, 0x02, 0xCA, 0x00, 0x81, 0x81, 0xCA,
+    0x40, 0x80, 0x82, 0x8A, 0xC0, 0x80, 0x00, 0x85, 0x00, 0x80, 0x00, 0xC6, 0x80, 0x40, 0x00, 0xC7,
+    0x40, 0x80, 0x01, 0xA4, 0x40, 0x00, 0x01, 0x86, 0x80, 0x41, 0x00, 0x8A, 0xC0, 0xC1, 0x00, 0x85,
+    0x00, 0x00, 0x01, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0xA4, 0x40, 0x80, 0x01, 0x86,
+    0x80, 0x41, 0x00, 0x8A, 0x00, 0xC2, 0x00, 0x86, 0x80, 0x40, 0x00, 0x87, 0x40, 0x00, 0x01, 0xA2,
+    0x00, 0x00, 0x00, 0x1E, 0x40, 0x01, 0x80, 0x85, 0x00, 0x80, 0x01, 0xC6, 0x80, 0x40, 0x00, 0xC7,
+    0x40, 0x80, 0x01, 0xA4, 0x40, 0x00, 0x01, 0x86, 0x80, 0x40, 0x00, 0x8A, 0x00, 0xC2, 0x00, 0x26,
+    0x00, 0x80, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x05, 0x72,
+    0x6F, 0x6F, 0x74, 0x04, 0x09, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x73, 0x04, 0x09, 0x64,
+    0x65, 0x61, 0x64, 0x6C, 0x69, 0x6E, 0x65, 0x04, 0x06, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x04, 0x04,
+    0x70, 0x69, 0x64, 0x04, 0x08, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x01, 0x01, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0F, 0x01, 0x18, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x25,
+    0x00, 0x00, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x82,
+    0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x84,
+    0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x84,
+    0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x85,
+    0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x87, 0x01, 0x00, 0x00, 0x87,
+    0x01, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00, 0x89,
+    0x01, 0x00, 0x00, 0x8A, 0x01, 0x00, 0x00, 0x8A, 0x01, 0x00, 0x00, 0x8B, 0x01, 0x00, 0x00, 0x8B,
+    0x01, 0x00, 0x00, 0x8B, 0x01, 0x00, 0x00, 0x8B, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C,
+    0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8D, 0x01, 0x00, 0x00, 0x8D,
+    0x01, 0x00, 0x00, 0x8F, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x74, 0x69, 0x6D, 0x65,
+    0x6F, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x02,
+    0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x0B, 0x74, 0x69,
+    0x6D, 0x65, 0x72, 0x5F, 0x70, 0x75, 0x73, 0x68, 0x0C, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x5F, 0x79,
+    0x69, 0x65, 0x6C, 0x64, 0x0D, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x5F, 0x72, 0x65, 0x6D, 0x6F, 0x76,
+    0x65, 0x00, 0x91, 0x01, 0x00, 0x00, 0x9B, 0x01, 0x00, 0x00, 0x02, 0x00, 0x06, 0x2D, 0x00, 0x00,
+    0x00, 0x86, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x80, 0x00, 0x01, 0xA2, 0x40, 0x00,
+    0x00, 0x1E, 0x40, 0x00, 0x80, 0xC3, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x01, 0xC6, 0x40, 0x40,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0xE4, 0x80, 0x00, 0x01, 0x06, 0x81, 0x40, 0x00, 0x5F, 0x00, 0x81,
+    0x01, 0x1E, 0x80, 0x02, 0x80, 0xC6, 0xC0, 0x40, 0x00, 0x5F, 0x00, 0xC1, 0x01, 0x1E, 0x00, 0x01,
+    0x80, 0xC6, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x00, 0x01, 0x40, 0x01, 0x80, 0x00, 0xE4, 0x80, 0x80,
+    0x01, 0x1E, 0x40, 0x00, 0x80, 0xC3, 0x40, 0x00, 0x00, 0xC3, 0x00, 0x80, 0x00, 0xE6, 0x00, 0x00,
+    0x01, 0xC6, 0x40, 0x41, 0x00, 0xC7, 0x80, 0x80, 0x01, 0xE2, 0x40, 0x00, 0x00, 0x1E, 0x40, 0x00,
+    0x80, 0xC3, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x01, 0xC5, 0x00, 0x80, 0x00, 0x06, 0x41, 0x41,
+    0x00, 0x07, 0x81, 0x00, 0x02, 0x40, 0x01, 0x80, 0x00, 0xE4, 0x40, 0x80, 0x01, 0xC6, 0x80, 0x41,
+    0x00, 0xC7, 0x80, 0x80, 0x01, 0xE2, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0xC5, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0xE4, 0x40, 0x00, 0x01, 0xC3, 0x00, 0x80, 0x00, 0xE6, 0x00, 0x00,
+    0x01, 0x26, 0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x08, 0x77, 0x68, 0x65, 0x72, 0x65,
+    0x69, 0x73, 0x04, 0x09, 0x77, 0x6F, 0x72, 0x6B, 0x65, 0x72, 0x6F, 0x66, 0x04, 0x07, 0x77, 0x6F,
+    0x72, 0x6B, 0x65, 0x72, 0x04, 0x06, 0x72, 0x6F, 0x75, 0x74, 0x65, 0x00, 0x04, 0x0A, 0x6D, 0x61,
+    0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73, 0x04, 0x08, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6E, 0x67,
+    0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x08, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00,
+    0x00, 0x00, 0x92, 0x01, 0x00, 0x00, 0x92, 0x01, 0x00, 0x00, 0x92, 0x01, 0x00, 0x00, 0x93, 0x01,
+    0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x94, 0x01,
+    0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x94, 0x01,
+    0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x95, 0x01,
+    0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x95, 0x01,
+    0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x95, 0x01,
+    0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x97, 0x01,
+    0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00, 0x98, 0x01,
+    0x00, 0x00, 0x98, 0x01, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00, 0x99, 0x01,
+    0x00, 0x00, 0x99, 0x01, 0x00, 0x00, 0x99, 0x01, 0x00, 0x00, 0x99, 0x01, 0x00, 0x00, 0x99, 0x01,
+    0x00, 0x00, 0x99, 0x01, 0x00, 0x00, 0x99, 0x01, 0x00, 0x00, 0x9A, 0x01, 0x00, 0x00, 0x9A, 0x01,
+    0x00, 0x00, 0x9B, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74, 0x00,
+    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x04, 0x6D, 0x73, 0x67, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x03, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x02, 0x4D, 0x0B, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5F, 0x70, 0x75, 0x73, 0x68,
+    0x0D, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x77, 0x61, 0x6B, 0x65, 0x00, 0x9D, 0x01,
+    0x00, 0x00, 0xA1, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x11, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40,
+    0x00, 0x86, 0x40, 0x40, 0x00, 0xA4, 0x80, 0x80, 0x00, 0x47, 0x80, 0x80, 0x00, 0x85, 0x00, 0x80,
+    0x00, 0xC0, 0x00, 0x80, 0x00, 0xA4, 0x80, 0x00, 0x01, 0x1F, 0x80, 0x40, 0x01, 0x1E, 0x80, 0x00,
+    0x80, 0x86, 0xC0, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x40, 0x00, 0x01, 0x85, 0x00, 0x00,
+    0x01, 0xC0, 0x00, 0x80, 0x00, 0xA5, 0x00, 0x00, 0x01, 0xA6, 0x00, 0x00, 0x00, 0x26, 0x00, 0x80,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x6D, 0x61, 0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73,
+    0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x06, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x07, 0x01, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x9E, 0x01, 0x00, 0x00, 0x9E, 0x01, 0x00, 0x00,
+    0x9E, 0x01, 0x00, 0x00, 0x9E, 0x01, 0x00, 0x00, 0x9F, 0x01, 0x00, 0x00, 0x9F, 0x01, 0x00, 0x00,
+    0x9F, 0x01, 0x00, 0x00, 0x9F, 0x01, 0x00, 0x00, 0x9F, 0x01, 0x00, 0x00, 0x9F, 0x01, 0x00, 0x00,
+    0x9F, 0x01, 0x00, 0x00, 0x9F, 0x01, 0x00, 0x00, 0xA0, 0x01, 0x00, 0x00, 0xA0, 0x01, 0x00, 0x00,
+    0xA0, 0x01, 0x00, 0x00, 0xA0, 0x01, 0x00, 0x00, 0xA1, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x08, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x03, 0x6D, 0x62, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+    0x4D, 0x0B, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x71, 0x75, 0x65,
+    0x75, 0x65, 0x5F, 0x70, 0x6F, 0x70, 0x00, 0xA3, 0x01, 0x00, 0x00, 0xAB, 0x01, 0x00, 0x00, 0x02,
+    0x00, 0x0B, 0x20, 0x00, 0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0xC6, 0x40, 0x40, 0x00, 0xE4, 0x80,
+    0x80, 0x00, 0x87, 0xC0, 0x00, 0x01, 0xC5, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x01, 0xE4, 0x80,
+    0x00, 0x01, 0x1F, 0x80, 0xC0, 0x01, 0x1E, 0x80, 0x00, 0x80, 0xC6, 0xC0, 0x40, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0xE4, 0x40, 0x00, 0x01, 0xC5, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x01, 0xE4, 0x80,
+    0x00, 0x01, 0x22, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0x20, 0x00, 0x80, 0x01, 0x1E, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x80, 0x01, 0x0B, 0x01, 0x00, 0x00, 0x41, 0x01, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x00, 0xC1, 0x01, 0x01, 0x00, 0x68, 0xC1, 0x00, 0x80, 0x45, 0x02, 0x00, 0x01, 0x80, 0x02,
+    0x00, 0x01, 0x64, 0x82, 0x00, 0x01, 0x0A, 0x41, 0x02, 0x04, 0x67, 0x81, 0xFE, 0x7F, 0x26, 0x01,
+    0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x6D, 0x61, 0x69, 0x6C,
+    0x62, 0x6F, 0x78, 0x65, 0x73, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x13, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x07, 0x01, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xA4, 0x01, 0x00, 0x00, 0xA4, 0x01, 0x00, 0x00, 0xA4, 0x01,
+    0x00, 0x00, 0xA4, 0x01, 0x00, 0x00, 0xA5, 0x01, 0x00, 0x00, 0xA5, 0x01, 0x00, 0x00, 0xA5, 0x01,
+    0x00, 0x00, 0xA5, 0x01, 0x00, 0x00, 0xA5, 0x01, 0x00, 0x00, 0xA5, 0x01, 0x00, 0x00, 0xA5, 0x01,
+    0x00, 0x00, 0xA5, 0x01, 0x00, 0x00, 0xA6, 0x01, 0x00, 0x00, 0xA6, 0x01, 0x00, 0x00, 0xA6, 0x01,
+    0x00, 0x00, 0xA7, 0x01, 0x00, 0x00, 0xA7, 0x01, 0x00, 0x00, 0xA7, 0x01, 0x00, 0x00, 0xA7, 0x01,
+    0x00, 0x00, 0xA7, 0x01, 0x00, 0x00, 0xA8, 0x01, 0x00, 0x00, 0xA9, 0x01, 0x00, 0x00, 0xA9, 0x01,
+    0x00, 0x00, 0xA9, 0x01, 0x00, 0x00, 0xA9, 0x01, 0x00, 0x00, 0xA9, 0x01, 0x00, 0x00, 0xA9, 0x01,
+    0x00, 0x00, 0xA9, 0x01, 0x00, 0x00, 0xA9, 0x01, 0x00, 0x00, 0xA9, 0x01, 0x00, 0x00, 0xAA, 0x01,
+    0x00, 0x00, 0xAB, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x6E, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x08, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x03, 0x6D, 0x62, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x05,
+    0x73, 0x69, 0x7A, 0x65, 0x0F, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x05, 0x6D, 0x73, 0x67,
+    0x73, 0x15, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x29, 0x18, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66,
+    0x6F, 0x72, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x29, 0x18, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x0B, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x65, 0x70, 0x29, 0x18, 0x00, 0x00, 0x00,
+    0x1E, 0x00, 0x00, 0x00, 0x02, 0x69, 0x19, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x02, 0x4D, 0x0B, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x0A,
+    0x71, 0x75, 0x65, 0x75, 0x65, 0x5F, 0x70, 0x6F, 0x70, 0x00, 0xAD, 0x01, 0x00, 0x00, 0xB1, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x16, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x01,
+    0x80, 0x46, 0x00, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0x64, 0x80, 0x00, 0x01, 0x62, 0x40, 0x00,
+    0x00, 0x1E, 0x40, 0x00, 0x80, 0x46, 0x40, 0x40, 0x00, 0x64, 0x80, 0x80, 0x00, 0x62, 0x00, 0x00,
+    0x00, 0x1E, 0xC0, 0x00, 0x80, 0x86, 0x80, 0x40, 0x00, 0x87, 0x40, 0x00, 0x01, 0xA2, 0x40, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x85, 0x00, 0x80, 0x00, 0xC6, 0x80, 0x40,
+    0x00, 0xC7, 0x40, 0x80, 0x01, 0xA5, 0x00, 0x00, 0x01, 0xA6, 0x00, 0x00, 0x00, 0x26, 0x00, 0x80,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69, 0x73, 0x04, 0x05,
+    0x73, 0x65, 0x6C, 0x66, 0x04, 0x0A, 0x6D, 0x61, 0x69, 0x6C, 0x62, 0x6F, 0x78, 0x65, 0x73, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xAE,
+    0x01, 0x00, 0x00, 0xAE, 0x01, 0x00, 0x00, 0xAE, 0x01, 0x00, 0x00, 0xAE, 0x01, 0x00, 0x00, 0xAE,
+    0x01, 0x00, 0x00, 0xAE, 0x01, 0x00, 0x00, 0xAE, 0x01, 0x00, 0x00, 0xAE, 0x01, 0x00, 0x00, 0xAE,
+    0x01, 0x00, 0x00, 0xAF, 0x01, 0x00, 0x00, 0xAF, 0x01, 0x00, 0x00, 0xAF, 0x01, 0x00, 0x00, 0xAF,
+    0x01, 0x00, 0x00, 0xAF, 0x01, 0x00, 0x00, 0xAF, 0x01, 0x00, 0x00, 0xAF, 0x01, 0x00, 0x00, 0xB0,
+    0x01, 0x00, 0x00, 0xB0, 0x01, 0x00, 0x00, 0xB0, 0x01, 0x00, 0x00, 0xB0, 0x01, 0x00, 0x00, 0xB0,
+    0x01, 0x00, 0x00, 0xB1, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x09, 0x00, 0x00, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x0B, 0x71, 0x75, 0x65, 0x75, 0x65,
+    0x5F, 0x73, 0x69, 0x7A, 0x65, 0x00, 0xB3, 0x01, 0x00, 0x00, 0xD5, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x0A, 0x53, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0xA3, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00,
+    0x80, 0x81, 0x40, 0x00, 0x00, 0x4D, 0x80, 0x80, 0x00, 0x08, 0x40, 0x00, 0x80, 0x46, 0x80, 0x40,
+    0x00, 0x62, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0x46, 0x80, 0x40, 0x00, 0x64, 0x40, 0x80,
+    0x00, 0x46, 0xC0, 0xC0, 0x00, 0x86, 0x00, 0x41, 0x00, 0x64, 0x80, 0x00, 0x01, 0x62, 0x00, 0x00,
+    0x00, 0x1E, 0x00, 0x05, 0x80, 0x46, 0x00, 0x41, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00,
+    0x82, 0x86, 0x40, 0xC1, 0x00, 0xC0, 0x00, 0x80, 0x00, 0xA4, 0x00, 0x01, 0x01, 0x1E, 0xC0, 0x02,
+    0x80, 0xC6, 0x81, 0x41, 0x00, 0x00, 0x02, 0x80, 0x02, 0x40, 0x02, 0x00, 0x03, 0xE4, 0x81, 0x80,
+    0x01, 0xE2, 0x41, 0x00, 0x00, 0x1E, 0x40, 0x01, 0x80, 0xC6, 0xC1, 0x41, 0x00, 0xC7, 0x41, 0x81,
+    0x03, 0xE2, 0x01, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0xC6, 0x01, 0x41, 0x00, 0xCA, 0x81, 0x81,
+    0x02, 0xA9, 0x80, 0x00, 0x00, 0x2A, 0x41, 0xFC, 0x7F, 0x46, 0x00, 0x42, 0x00, 0x87, 0x40, 0xC2,
+    0x00, 0xA2, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x04, 0x80, 0x87, 0x40, 0xC2, 0x00, 0x87, 0x80, 0x42,
+    0x01, 0xC6, 0x00, 0x40, 0x00, 0x21, 0xC0, 0x00, 0x01, 0x1E, 0x40, 0x03, 0x80, 0x85, 0x00, 0x00,
+    0x01, 0xA4, 0x80, 0x80, 0x00, 0xC6, 0xC0, 0x42, 0x00, 0x07, 0x01, 0x43, 0x01, 0xC7, 0x00, 0x81,
+    0x01, 0x1F, 0x80, 0x80, 0x01, 0x1E, 0x00, 0xFC, 0x7F, 0xC6, 0xC0, 0x42, 0x00, 0x07, 0x01, 0x43,
+    0x01, 0xCA, 0x40, 0x43, 0x02, 0xC5, 0x00, 0x80, 0x01, 0x07, 0x01, 0x43, 0x01, 0xE4, 0x40, 0x00,
+    0x01, 0x1E, 0x40, 0xFA, 0x7F, 0x81, 0x40, 0x02, 0x00, 0xC5, 0x00, 0x00, 0x02, 0x06, 0x81, 0x43,
+    0x00, 0xE4, 0x80, 0x00, 0x01, 0x01, 0x41, 0x02, 0x00, 0xA8, 0x00, 0x02, 0x80, 0x85, 0x01, 0x80,
+    0x02, 0xC6, 0x81, 0x43, 0x00, 0xA4, 0x81, 0x00, 0x01, 0xC6, 0xC1, 0x43, 0x00, 0xCA, 0x41, 0x43,
+    0x03, 0xC5, 0x01, 0x00, 0x03, 0x06, 0xC2, 0x41, 0x00, 0x07, 0x82, 0x01, 0x04, 0xE4, 0x41, 0x00,
+    0x01, 0xA7, 0x40, 0xFD, 0x7F, 0x86, 0x00, 0x44, 0x00, 0x60, 0x80, 0x80, 0x80, 0x1E, 0x00, 0x00,
+    0x80, 0x83, 0x40, 0x00, 0x00, 0x83, 0x00, 0x80, 0x00, 0xA6, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x06, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x70, 0x6F, 0x6C, 0x6C, 0x04, 0x05, 0x6E, 0x65, 0x78,
+    0x74, 0x04, 0x0B, 0x73, 0x6C, 0x61, 0x75, 0x67, 0x68, 0x74, 0x65, 0x72, 0x73, 0x04, 0x06, 0x70,
+    0x61, 0x69, 0x72, 0x73, 0x04, 0x05, 0x6B, 0x69, 0x6C, 0x6C, 0x04, 0x0A, 0x70, 0x72, 0x6F, 0x63,
+    0x65, 0x73, 0x73, 0x65, 0x73, 0x04, 0x07, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x73, 0x13, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x64, 0x65, 0x61, 0x64, 0x6C, 0x69, 0x6E, 0x65,
+    0x04, 0x09, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x73, 0x04, 0x04, 0x70, 0x69, 0x64, 0x00,
+    0x04, 0x09, 0x72, 0x75, 0x6E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x04, 0x06, 0x72, 0x65, 0x61, 0x64,
+    0x79, 0x04, 0x06, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x11, 0x01, 0x14, 0x01, 0x07, 0x01, 0x09, 0x01, 0x16, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00,
+    0x00, 0x00, 0xB4, 0x01, 0x00, 0x00, 0xB4, 0x01, 0x00, 0x00, 0xB4, 0x01, 0x00, 0x00, 0xB4, 0x01,
+    0x00, 0x00, 0xB4, 0x01, 0x00, 0x00, 0xB4, 0x01, 0x00, 0x00, 0xB6, 0x01, 0x00, 0x00, 0xB6, 0x01,
+    0x00, 0x00, 0xB6, 0x01, 0x00, 0x00, 0xB6, 0x01, 0x00, 0x00, 0xB6, 0x01, 0x00, 0x00, 0xB9, 0x01,
+    0x00, 0x00, 0xB9, 0x01, 0x00, 0x00, 0xB9, 0x01, 0x00, 0x00, 0xB9, 0x01, 0x00, 0x00, 0xB9, 0x01,
+    0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0xBC, 0x01,
+    0x00, 0x00, 0xBC, 0x01, 0x00, 0x00, 0xBC, 0x01, 0x00, 0x00, 0xBC, 0x01, 0x00, 0x00, 0xBD, 0x01,
+    0x00, 0x00, 0xBD, 0x01, 0x00, 0x00, 0xBD, 0x01, 0x00, 0x00, 0xBD, 0x01, 0x00, 0x00, 0xBD, 0x01,
+    0x00, 0x00, 0xBD, 0x01, 0x00, 0x00, 0xBD, 0x01, 0x00, 0x00, 0xBD, 0x01, 0x00, 0x00, 0xBD, 0x01,
+    0x00, 0x00, 0xBD, 0x01, 0x00, 0x00, 0xBE, 0x01, 0x00, 0x00, 0xBE, 0x01, 0x00, 0x00, 0xBC, 0x01,
+    0x00, 0x00, 0xBC, 0x01, 0x00, 0x00, 0xC4, 0x01, 0x00, 0x00, 0xC5, 0x01, 0x00, 0x00, 0xC5, 0x01,
+    0x00, 0x00, 0xC5, 0x01, 0x00, 0x00, 0xC5, 0x01, 0x00, 0x00, 0xC5, 0x01, 0x00, 0x00, 0xC5, 0x01,
+    0x00, 0x00, 0xC5, 0x01, 0x00, 0x00, 0xC5, 0x01, 0x00, 0x00, 0xC6, 0x01, 0x00, 0x00, 0xC6, 0x01,
+    0x00, 0x00, 0xC7, 0x01, 0x00, 0x00, 0xC7, 0x01, 0x00, 0x00, 0xC7, 0x01, 0x00, 0x00, 0xC7, 0x01,
+    0x00, 0x00, 0xC7, 0x01, 0x00, 0x00, 0xC8, 0x01, 0x00, 0x00, 0xC8, 0x01, 0x00, 0x00, 0xC8, 0x01,
+    0x00, 0x00, 0xC9, 0x01, 0x00, 0x00, 0xC9, 0x01, 0x00, 0x00, 0xC9, 0x01, 0x00, 0x00, 0xCA, 0x01,
+    0x00, 0x00, 0xCE, 0x01, 0x00, 0x00, 0xCE, 0x01, 0x00, 0x00, 0xCE, 0x01, 0x00, 0x00, 0xCE, 0x01,
+    0x00, 0x00, 0xCE, 0x01, 0x00, 0x00, 0xCE, 0x01, 0x00, 0x00, 0xCF, 0x01, 0x00, 0x00, 0xCF, 0x01,
+    0x00, 0x00, 0xCF, 0x01, 0x00, 0x00, 0xD0, 0x01, 0x00, 0x00, 0xD0, 0x01, 0x00, 0x00, 0xD1, 0x01,
+    0x00, 0x00, 0xD1, 0x01, 0x00, 0x00, 0xD1, 0x01, 0x00, 0x00, 0xD1, 0x01, 0x00, 0x00, 0xCE, 0x01,
+    0x00, 0x00, 0xD4, 0x01, 0x00, 0x00, 0xD4, 0x01, 0x00, 0x00, 0xD4, 0x01, 0x00, 0x00, 0xD4, 0x01,
+    0x00, 0x00, 0xD4, 0x01, 0x00, 0x00, 0xD4, 0x01, 0x00, 0x00, 0xD5, 0x01, 0x00, 0x00, 0x0E, 0x00,
+    0x00, 0x00, 0x06, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+    0x0B, 0x73, 0x6C, 0x61, 0x75, 0x67, 0x68, 0x74, 0x65, 0x72, 0x73, 0x11, 0x00, 0x00, 0x00, 0x25,
+    0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74,
+    0x6F, 0x72, 0x29, 0x16, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72,
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x16, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0E,
+    0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x16, 0x00, 0x00,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x17, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00,
+    0x00, 0x07, 0x72, 0x65, 0x61, 0x73, 0x6F, 0x6E, 0x17, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x05, 0x68, 0x65, 0x61, 0x70, 0x26, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x02, 0x74, 0x30,
+    0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x64,
+    0x65, 0x78, 0x29, 0x41, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72,
+    0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x29, 0x41, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x0B,
+    0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x65, 0x70, 0x29, 0x41, 0x00, 0x00, 0x00, 0x4C, 0x00,
+    0x00, 0x00, 0x02, 0x69, 0x42, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64,
+    0x45, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F,
+    0x45, 0x4E, 0x56, 0x0A, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x5F, 0x70, 0x6F, 0x70, 0x0D, 0x70, 0x72,
+    0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x77, 0x61, 0x6B, 0x65, 0x0B, 0x71, 0x75, 0x65, 0x75, 0x65,
+    0x5F, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5F, 0x70, 0x6F, 0x70, 0x0F,
+    0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x00, 0xD9,
+    0x01, 0x00, 0x00, 0xDD, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x46, 0x00, 0xC0, 0x00, 0x24, 0x80, 0x00, 0x01, 0x60, 0x00, 0x80, 0x80, 0x1E, 0x00,
+    0x01, 0x80, 0x06, 0x80, 0x40, 0x01, 0x46, 0xC0, 0xC0, 0x00, 0x24, 0x80, 0x00, 0x01, 0x22, 0x00,
+    0x00, 0x00, 0x1E, 0x40, 0x00, 0x80, 0x01, 0x40, 0x00, 0x00, 0x26, 0x00, 0x00, 0x01, 0x06, 0x00,
+    0xC1, 0x00, 0x07, 0x40, 0x41, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1E, 0xC0, 0x01, 0x80, 0x46, 0x80,
+    0x41, 0x01, 0x47, 0xC0, 0xC1, 0x00, 0x87, 0x00, 0x42, 0x00, 0xC6, 0x40, 0xC2, 0x00, 0x8E, 0xC0,
+    0x00, 0x01, 0xC1, 0x40, 0x00, 0x00, 0x65, 0x00, 0x80, 0x01, 0x66, 0x00, 0x00, 0x00, 0x26, 0x00,
+    0x80, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x09, 0x72, 0x75, 0x6E, 0x71, 0x75, 0x65, 0x75, 0x65,
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x6E, 0x65, 0x78, 0x74, 0x04,
+    0x0B, 0x73, 0x6C, 0x61, 0x75, 0x67, 0x68, 0x74, 0x65, 0x72, 0x73, 0x04, 0x07, 0x74, 0x69, 0x6D,
+    0x65, 0x72, 0x73, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x6D, 0x61,
+    0x74, 0x68, 0x04, 0x04, 0x6D, 0x61, 0x78, 0x04, 0x09, 0x64, 0x65, 0x61, 0x64, 0x6C, 0x69, 0x6E,
+    0x65, 0x04, 0x06, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x03, 0x00, 0x00, 0x00, 0x01, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0xDA, 0x01, 0x00, 0x00, 0xDA, 0x01,
+    0x00, 0x00, 0xDA, 0x01, 0x00, 0x00, 0xDA, 0x01, 0x00, 0x00, 0xDA, 0x01, 0x00, 0x00, 0xDA, 0x01,
+    0x00, 0x00, 0xDA, 0x01, 0x00, 0x00, 0xDA, 0x01, 0x00, 0x00, 0xDA, 0x01, 0x00, 0x00, 0xDA, 0x01,
+    0x00, 0x00, 0xDA, 0x01, 0x00, 0x00, 0xDA, 0x01, 0x00, 0x00, 0xDB, 0x01, 0x00, 0x00, 0xDB, 0x01,
+    0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0xDC, 0x01,
+    0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0xDC, 0x01,
+    0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0xDD, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x02, 0x74, 0x0E, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x0B, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x02, 0x4D, 0x05, 0x5F, 0x45,
+    0x4E, 0x56, 0x00, 0xDF, 0x01, 0x00, 0x00, 0xE7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x05, 0x21, 0x00,
     0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x64, 0x80, 0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0xC0, 0x00,
-    0x00, 0x00, 0xA4, 0x80, 0x00, 0x01, 0xA2, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00,
-    0x80, 0x00, 0xC6, 0x80, 0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0x1F, 0xC0, 0xC0, 0x01, 0x1E, 0x80,
-    0x00, 0x80, 0xC6, 0x80, 0x40, 0x00, 0x0B, 0x01, 0x00, 0x00, 0xCA, 0x00, 0x01, 0x01, 0xC6, 0x00,
-    0xC1, 0x00, 0x06, 0x81, 0x40, 0x00, 0x07, 0x81, 0x00, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x1E, 0x80,
-    0x00, 0x80, 0x1F, 0xC0, 0x81, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0xE9, 0x80,
-    0x00, 0x00, 0x6A, 0x81, 0xFE, 0x7F, 0xC6, 0x40, 0xC1, 0x00, 0xC7, 0x80, 0xC1, 0x01, 0x06, 0x81,
-    0x40, 0x00, 0x07, 0x81, 0x00, 0x02, 0x40, 0x01, 0x80, 0x00, 0xE4, 0x40, 0x80, 0x01, 0x26, 0x00,
-    0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x08, 0x77, 0x68,
-    0x65, 0x72, 0x65, 0x69, 0x73, 0x04, 0x09, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x73, 0x00,
-    0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x06, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x04, 0x07,
-    0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x15, 0x01,
-    0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x16, 0x01,
-    0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x17, 0x01,
-    0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x17, 0x01,
-    0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x18, 0x01,
-    0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x19, 0x01, 0x00, 0x00, 0x19, 0x01, 0x00, 0x00, 0x19, 0x01,
-    0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x1B, 0x01, 0x00, 0x00, 0x1B, 0x01,
-    0x00, 0x00, 0x1B, 0x01, 0x00, 0x00, 0x1B, 0x01, 0x00, 0x00, 0x1B, 0x01, 0x00, 0x00, 0x1B, 0x01,
-    0x00, 0x00, 0x1C, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x73, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x04, 0x70, 0x69, 0x64, 0x05, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66,
-    0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x13, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
-    0x29, 0x13, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63,
-    0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x13, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02,
-    0x5F, 0x14, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x76, 0x14, 0x00, 0x00, 0x00, 0x17,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x1E,
-    0x01, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x40, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x24, 0xC0, 0x00, 0x00, 0x22, 0x40, 0x00, 0x00, 0x1E, 0x80,
-    0x00, 0x80, 0x84, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0xA6, 0x00, 0x80, 0x01, 0x86, 0x40,
-    0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x40, 0x00, 0x01, 0x26, 0x00, 0x00, 0x01, 0x26, 0x00,
-    0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x06, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x04, 0x08, 0x6D,
-    0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00,
-    0x20, 0x01, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
-    0x20, 0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00,
-    0x22, 0x01, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64,
-    0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 0x65, 0x72, 0x72, 0x6D, 0x73, 0x67, 0x03,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0x25, 0x01,
-    0x00, 0x00, 0x2D, 0x01, 0x00, 0x00, 0x01, 0x00, 0x09, 0x1A, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40,
-    0x00, 0x64, 0x80, 0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x80, 0x00,
-    0x01, 0xA2, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0xC6, 0x80, 0x40,
-    0x00, 0xC7, 0x80, 0x80, 0x01, 0x1F, 0xC0, 0xC0, 0x01, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80,
-    0x00, 0xC6, 0x00, 0xC1, 0x00, 0x06, 0x81, 0x40, 0x00, 0x07, 0x81, 0x00, 0x02, 0xE4, 0x00, 0x01,
-    0x01, 0x1E, 0x00, 0x01, 0x80, 0x1F, 0xC0, 0x81, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x06, 0x82, 0x40,
-    0x00, 0x07, 0x82, 0x00, 0x04, 0x0A, 0xC2, 0x40, 0x03, 0xE9, 0x80, 0x00, 0x00, 0x6A, 0x01, 0xFE,
-    0x7F, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04,
-    0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69, 0x73, 0x04, 0x09, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F,
-    0x72, 0x73, 0x00, 0x04, 0x06, 0x70, 0x61, 0x69, 0x72, 0x73, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x26, 0x01,
-    0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x28, 0x01,
-    0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x29, 0x01,
-    0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x2A, 0x01,
-    0x00, 0x00, 0x2A, 0x01, 0x00, 0x00, 0x2A, 0x01, 0x00, 0x00, 0x2A, 0x01, 0x00, 0x00, 0x2A, 0x01,
-    0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x2B, 0x01,
-    0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x2A, 0x01, 0x00, 0x00, 0x2A, 0x01, 0x00, 0x00, 0x2D, 0x01,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x00, 0x00, 0x00, 0x02, 0x73, 0x02, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69,
-    0x64, 0x05, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67,
-    0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x11, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x11, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72,
-    0x6F, 0x6C, 0x29, 0x11, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x6B, 0x12, 0x00, 0x00,
-    0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x76, 0x12, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x02, 0x4D, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x2F, 0x01, 0x00, 0x00, 0x31,
-    0x01, 0x00, 0x00, 0x03, 0x00, 0x06, 0x08, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x40, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x4B, 0xC1, 0x00, 0x00, 0x4A, 0x81, 0xC0, 0x80, 0x4A, 0x41, 0x80, 0x81, 0x4A, 0x81,
-    0x00, 0x82, 0xE4, 0x40, 0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x05,
-    0x73, 0x65, 0x6E, 0x64, 0x04, 0x07, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x04, 0x05, 0x44, 0x4F,
-    0x57, 0x4E, 0x04, 0x05, 0x66, 0x72, 0x6F, 0x6D, 0x04, 0x07, 0x72, 0x65, 0x61, 0x73, 0x6F, 0x6E,
-    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x30, 0x01,
-    0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x30, 0x01,
-    0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05,
-    0x64, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x61,
-    0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
-    0x4D, 0x00, 0x42, 0x01, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x02, 0x01, 0x07, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0xA4, 0x80, 0x00, 0x01, 0xA2, 0x00, 0x00, 0x00, 0x1E, 0xC0, 0x00, 0x80, 0xC6, 0x80,
+    0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0xE2, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00,
+    0x80, 0x00, 0xC6, 0xC0, 0x40, 0x00, 0xC7, 0x40, 0x80, 0x01, 0x1F, 0x00, 0xC1, 0x01, 0x1E, 0x80,
+    0x00, 0x80, 0xC6, 0xC0, 0x40, 0x00, 0x0B, 0x01, 0x00, 0x00, 0xCA, 0x00, 0x81, 0x00, 0xC6, 0xC0,
+    0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0x1F, 0x00, 0xC1, 0x01, 0x1E, 0x80, 0x00, 0x80, 0xC6, 0xC0,
+    0x40, 0x00, 0x0B, 0x01, 0x00, 0x00, 0xCA, 0x00, 0x01, 0x01, 0xC6, 0xC0, 0x40, 0x00, 0xC7, 0x40,
+    0x80, 0x01, 0xCA, 0x40, 0x41, 0x01, 0xC6, 0xC0, 0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0xCA, 0x40,
+    0xC1, 0x00, 0x26, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66,
+    0x04, 0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69, 0x73, 0x04, 0x0A, 0x70, 0x72, 0x6F, 0x63, 0x65,
+    0x73, 0x73, 0x65, 0x73, 0x04, 0x06, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x00, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00,
+    0xE0, 0x01, 0x00, 0x00, 0xE1, 0x01, 0x00, 0x00, 0xE1, 0x01, 0x00, 0x00, 0xE1, 0x01, 0x00, 0x00,
+    0xE2, 0x01, 0x00, 0x00, 0xE2, 0x01, 0x00, 0x00, 0xE2, 0x01, 0x00, 0x00, 0xE2, 0x01, 0x00, 0x00,
+    0xE2, 0x01, 0x00, 0x00, 0xE2, 0x01, 0x00, 0x00, 0xE2, 0x01, 0x00, 0x00, 0xE3, 0x01, 0x00, 0x00,
+    0xE3, 0x01, 0x00, 0x00, 0xE3, 0x01, 0x00, 0x00, 0xE3, 0x01, 0x00, 0x00, 0xE3, 0x01, 0x00, 0x00,
+    0xE3, 0x01, 0x00, 0x00, 0xE3, 0x01, 0x00, 0x00, 0xE4, 0x01, 0x00, 0x00, 0xE4, 0x01, 0x00, 0x00,
+    0xE4, 0x01, 0x00, 0x00, 0xE4, 0x01, 0x00, 0x00, 0xE4, 0x01, 0x00, 0x00, 0xE4, 0x01, 0x00, 0x00,
+    0xE4, 0x01, 0x00, 0x00, 0xE5, 0x01, 0x00, 0x00, 0xE5, 0x01, 0x00, 0x00, 0xE5, 0x01, 0x00, 0x00,
+    0xE6, 0x01, 0x00, 0x00, 0xE6, 0x01, 0x00, 0x00, 0xE6, 0x01, 0x00, 0x00, 0xE7, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x02, 0x73, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x05,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0xE9, 0x01,
+    0x00, 0x00, 0xEE, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40,
+    0x00, 0x6D, 0x00, 0x00, 0x00, 0x24, 0xC0, 0x00, 0x00, 0x22, 0x40, 0x00, 0x00, 0x1E, 0x80, 0x00,
+    0x80, 0x84, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0xA6, 0x00, 0x80, 0x01, 0x86, 0x40, 0x40,
+    0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x40, 0x00, 0x01, 0x26, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x06, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x04, 0x05, 0x6C, 0x69,
+    0x6E, 0x6B, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
+    0xEA, 0x01, 0x00, 0x00, 0xEA, 0x01, 0x00, 0x00, 0xEA, 0x01, 0x00, 0x00, 0xEB, 0x01, 0x00, 0x00,
+    0xEB, 0x01, 0x00, 0x00, 0xEB, 0x01, 0x00, 0x00, 0xEB, 0x01, 0x00, 0x00, 0xEB, 0x01, 0x00, 0x00,
+    0xEC, 0x01, 0x00, 0x00, 0xEC, 0x01, 0x00, 0x00, 0xEC, 0x01, 0x00, 0x00, 0xED, 0x01, 0x00, 0x00,
+    0xEE, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x03, 0x00, 0x00, 0x00,
+    0x0D, 0x00, 0x00, 0x00, 0x07, 0x65, 0x72, 0x72, 0x6D, 0x73, 0x67, 0x03, 0x00, 0x00, 0x00, 0x0D,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xF6, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x17, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x64, 0x80, 0x80,
+    0x00, 0x86, 0x40, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x80, 0x00, 0x01, 0xA2, 0x40, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0xC6, 0x80, 0x40, 0x00, 0xC7, 0x40, 0x80,
+    0x01, 0xE2, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0xC6, 0x80, 0x40, 0x00, 0xC7, 0x40, 0x80,
+    0x01, 0xCA, 0xC0, 0x40, 0x01, 0xC6, 0x80, 0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0xE2, 0x00, 0x00,
+    0x00, 0x1E, 0x80, 0x00, 0x80, 0xC6, 0x80, 0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0xCA, 0xC0, 0xC0,
+    0x00, 0x26, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04,
+    0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69, 0x73, 0x04, 0x06, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xF1, 0x01,
+    0x00, 0x00, 0xF1, 0x01, 0x00, 0x00, 0xF2, 0x01, 0x00, 0x00, 0xF2, 0x01, 0x00, 0x00, 0xF2, 0x01,
+    0x00, 0x00, 0xF3, 0x01, 0x00, 0x00, 0xF3, 0x01, 0x00, 0x00, 0xF3, 0x01, 0x00, 0x00, 0xF4, 0x01,
+    0x00, 0x00, 0xF4, 0x01, 0x00, 0x00, 0xF4, 0x01, 0x00, 0x00, 0xF4, 0x01, 0x00, 0x00, 0xF4, 0x01,
+    0x00, 0x00, 0xF4, 0x01, 0x00, 0x00, 0xF4, 0x01, 0x00, 0x00, 0xF5, 0x01, 0x00, 0x00, 0xF5, 0x01,
+    0x00, 0x00, 0xF5, 0x01, 0x00, 0x00, 0xF5, 0x01, 0x00, 0x00, 0xF5, 0x01, 0x00, 0x00, 0xF5, 0x01,
+    0x00, 0x00, 0xF5, 0x01, 0x00, 0x00, 0xF6, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x64,
+    0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x73, 0x02, 0x00, 0x00,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x05, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xFA, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x06, 0x05, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40,
+    0x01, 0x00, 0x01, 0xE4, 0x40, 0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+    0x05, 0x6B, 0x69, 0x6C, 0x6C, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0xF9, 0x01, 0x00, 0x00, 0xF9, 0x01, 0x00, 0x00, 0xF9, 0x01, 0x00, 0x00, 0xF9,
+    0x01, 0x00, 0x00, 0xFA, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x61, 0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x04,
+    0x02, 0x00, 0x00, 0x01, 0x00, 0x05, 0x21, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x64, 0x80,
+    0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x80, 0x00, 0x01, 0xA2, 0x00,
+    0x00, 0x00, 0x1E, 0xC0, 0x00, 0x80, 0xC6, 0x80, 0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0xE2, 0x40,
+    0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0xC6, 0xC0, 0x40, 0x00, 0xC7, 0x80,
+    0x80, 0x01, 0x1F, 0x00, 0xC1, 0x01, 0x1E, 0x80, 0x00, 0x80, 0xC6, 0xC0, 0x40, 0x00, 0x0B, 0x01,
+    0x00, 0x00, 0xCA, 0x00, 0x01, 0x01, 0xC6, 0x40, 0x41, 0x00, 0xC7, 0x40, 0x80, 0x01, 0x1F, 0x00,
+    0xC1, 0x01, 0x1E, 0x80, 0x00, 0x80, 0xC6, 0x40, 0x41, 0x00, 0x0B, 0x01, 0x00, 0x00, 0xCA, 0x00,
+    0x81, 0x00, 0xC6, 0xC0, 0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0xCA, 0x80, 0xC1, 0x00, 0xC6, 0x40,
+    0x41, 0x00, 0xC7, 0x40, 0x80, 0x01, 0xCA, 0x80, 0x41, 0x01, 0x26, 0x00, 0x80, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69,
+    0x73, 0x04, 0x0A, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x04, 0x09, 0x6D, 0x6F,
+    0x6E, 0x69, 0x74, 0x6F, 0x72, 0x73, 0x00, 0x04, 0x09, 0x77, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6E,
+    0x67, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0xFD, 0x01, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xFE, 0x01, 0x00,
+    0x00, 0xFE, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x02, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x02, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00,
+    0x00, 0x02, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00,
+    0x00, 0x04, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x73, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+    0x04, 0x70, 0x69, 0x64, 0x05, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x4D, 0x00, 0x06, 0x02, 0x00, 0x00, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0D, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x24, 0xC0, 0x00, 0x00, 0x22, 0x40,
+    0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0x84, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x00, 0xA6, 0x00,
+    0x80, 0x01, 0x86, 0x40, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x40, 0x00, 0x01, 0x26, 0x00,
+    0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x06, 0x73, 0x70, 0x61, 0x77,
+    0x6E, 0x04, 0x08, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+    0x07, 0x02, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
+    0x08, 0x02, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00,
+    0x09, 0x02, 0x00, 0x00, 0x0A, 0x02, 0x00, 0x00, 0x0B, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x04, 0x70, 0x69, 0x64, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 0x65, 0x72, 0x72,
+    0x6D, 0x73, 0x67, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+    0x4D, 0x00, 0x0D, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x01, 0x00, 0x04, 0x17, 0x00, 0x00,
+    0x00, 0x46, 0x00, 0x40, 0x00, 0x64, 0x80, 0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0xC0, 0x00, 0x00,
+    0x00, 0xA4, 0x80, 0x00, 0x01, 0xA2, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80,
+    0x00, 0xC6, 0x80, 0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0xE2, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x00,
+    0x80, 0xC6, 0x80, 0x40, 0x00, 0xC7, 0x80, 0x80, 0x01, 0xCA, 0xC0, 0xC0, 0x00, 0xC6, 0x00, 0x41,
+    0x00, 0xC7, 0x40, 0x80, 0x01, 0xE2, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0xC6, 0x00, 0x41,
+    0x00, 0xC7, 0x40, 0x80, 0x01, 0xCA, 0xC0, 0x40, 0x01, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x04, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x04, 0x08, 0x77, 0x68, 0x65, 0x72, 0x65, 0x69, 0x73,
+    0x04, 0x09, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x73, 0x00, 0x04, 0x09, 0x77, 0x61, 0x74,
+    0x63, 0x68, 0x69, 0x6E, 0x67, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x0E, 0x02, 0x00, 0x00, 0x0E, 0x02, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x0F,
+    0x02, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10,
+    0x02, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x11,
+    0x02, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x12,
+    0x02, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00, 0x12,
+    0x02, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+    0x02, 0x73, 0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x05, 0x00,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0x15, 0x02, 0x00,
+    0x00, 0x17, 0x02, 0x00, 0x00, 0x03, 0x00, 0x06, 0x08, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x40, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x4B, 0xC1, 0x00, 0x00, 0x4A, 0x81, 0xC0, 0x80, 0x4A, 0x41, 0x80, 0x81,
+    0x4A, 0x81, 0x00, 0x82, 0xE4, 0x40, 0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x04, 0x05, 0x73, 0x65, 0x6E, 0x64, 0x04, 0x07, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x04, 0x05,
+    0x44, 0x4F, 0x57, 0x4E, 0x04, 0x05, 0x66, 0x72, 0x6F, 0x6D, 0x04, 0x07, 0x72, 0x65, 0x61, 0x73,
+    0x6F, 0x6E, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x16, 0x02, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00,
+    0x16, 0x02, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x17, 0x02, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x05, 0x64, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x72,
+    0x65, 0x61, 0x73, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x4D, 0x00, 0x28, 0x02, 0x00, 0x00, 0x2F, 0x02, 0x00, 0x00, 0x02, 0x01, 0x07, 0x0B,
+    0x00, 0x00, 0x00, 0x22, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x86,
+    0x00, 0x40, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x01, 0x80, 0x00, 0xAD,
+    0x01, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x26, 0x00, 0x80, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x04, 0x06, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x2E, 0x02, 0x00, 0x00, 0x02, 0x01, 0x04,
+    0x07, 0x00, 0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x80, 0x00, 0xA4, 0x40, 0x00, 0x01,
+    0x80, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0xA4, 0x40, 0x00, 0x00, 0x26, 0x00, 0x80, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x06, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x2C, 0x02, 0x00,
+    0x00, 0x2C, 0x02, 0x00, 0x00, 0x2D, 0x02, 0x00, 0x00, 0x2D, 0x02, 0x00, 0x00, 0x2D, 0x02, 0x00,
+    0x00, 0x2E, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x63, 0x62, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x03, 0x6D, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x02, 0x4D, 0x0B, 0x00, 0x00, 0x00, 0x29, 0x02, 0x00, 0x00, 0x29, 0x02, 0x00,
+    0x00, 0x29, 0x02, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x00, 0x2E, 0x02, 0x00, 0x00, 0x2E, 0x02, 0x00,
+    0x00, 0x2E, 0x02, 0x00, 0x00, 0x2E, 0x02, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x00, 0x2E, 0x02, 0x00,
+    0x00, 0x2F, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x08, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0x31, 0x02, 0x00,
+    0x00, 0x33, 0x02, 0x00, 0x00, 0x01, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0xC1, 0x40, 0x00, 0x00, 0x64, 0x40, 0x80, 0x01, 0x26, 0x00, 0x80, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x04, 0x05, 0x6B, 0x69, 0x6C, 0x6C, 0x04, 0x0E, 0x63, 0x6C, 0x65, 0x61,
+    0x72, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0x32,
+    0x02, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+    0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+    0x4D, 0x00, 0x35, 0x02, 0x00, 0x00, 0x3E, 0x02, 0x00, 0x00, 0x02, 0x01, 0x07, 0x0B, 0x00, 0x00,
     0x00, 0x22, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x86, 0x00, 0x40,
     0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x01, 0x80, 0x00, 0xAD, 0x01, 0x00,
     0x00, 0xA5, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x26, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00,
     0x00, 0x04, 0x06, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x02, 0x01, 0x04, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x3D, 0x02, 0x00, 0x00, 0x02, 0x01, 0x04, 0x08, 0x00,
     0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x80, 0x00, 0xA4, 0x40, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0xA4, 0x40, 0x00, 0x00, 0x26, 0x00, 0x80, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x04, 0x06, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x46, 0x01, 0x00, 0x00, 0x46, 0x01, 0x00, 0x00, 0x46,
-    0x01, 0x00, 0x00, 0x47, 0x01, 0x00, 0x00, 0x47, 0x01, 0x00, 0x00, 0x47, 0x01, 0x00, 0x00, 0x48,
-    0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x63, 0x62, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x00, 0x03, 0x6D, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x02, 0x4D, 0x0B, 0x00, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x43,
-    0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x48,
-    0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x49,
-    0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x08, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0x4B, 0x01, 0x00, 0x00, 0x4D,
-    0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0xC1, 0x40, 0x00, 0x00, 0x64, 0x40, 0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x04, 0x05, 0x6B, 0x69, 0x6C, 0x6C, 0x04, 0x0E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20,
-    0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x4C, 0x01, 0x00,
-    0x00, 0x4C, 0x01, 0x00, 0x00, 0x4D, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00,
-    0x4F, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x02, 0x01, 0x07, 0x0B, 0x00, 0x00, 0x00, 0x22,
-    0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x86, 0x00, 0x40, 0x00, 0xEC,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x01, 0x80, 0x00, 0xAD, 0x01, 0x00, 0x00, 0xA5,
-    0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x26, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
-    0x06, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x52, 0x01, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x02, 0x01, 0x04, 0x08, 0x00, 0x00, 0x00,
-    0x86, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x80, 0x00, 0xA4, 0x40, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0xED, 0x00, 0x00, 0x00, 0xA4, 0x40, 0x00, 0x00, 0x1E, 0x00, 0xFE, 0x7F, 0x26, 0x00, 0x80, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x04, 0x06, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00,
-    0x00, 0x54, 0x01, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x00,
-    0x00, 0x55, 0x01, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x63, 0x62,
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x6D, 0x73, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x0B, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00,
-    0x00, 0x50, 0x01, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00, 0x57, 0x01, 0x00,
-    0x00, 0x57, 0x01, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x51, 0x01, 0x00,
-    0x00, 0x57, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75,
-    0x6E, 0x63, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09, 0x69, 0x6E, 0x74, 0x65, 0x72,
-    0x76, 0x61, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
-    0x4D, 0x00, 0x5A, 0x01, 0x00, 0x00, 0x5C, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x05, 0x00, 0x00,
-    0x00, 0x46, 0x00, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC1, 0x40, 0x00, 0x00, 0x64, 0x40, 0x80,
-    0x01, 0x26, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x05, 0x6B, 0x69, 0x6C, 0x6C, 0x04,
-    0x0F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x5B, 0x01, 0x00,
-    0x00, 0x5B, 0x01, 0x00, 0x00, 0x5B, 0x01, 0x00, 0x00, 0x5B, 0x01, 0x00, 0x00, 0x5C, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0x5E, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x0D, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x80, 0x6C, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x80, 0x6C, 0x40, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x81, 0x6C, 0x80, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x81, 0x6C, 0xC0, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x82, 0x26, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04,
-    0x0B, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x04, 0x03, 0x6F, 0x6E, 0x04,
-    0x05, 0x6F, 0x6E, 0x63, 0x65, 0x04, 0x05, 0x65, 0x6D, 0x69, 0x74, 0x04, 0x07, 0x72, 0x65, 0x6D,
-    0x6F, 0x76, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x61, 0x01,
-    0x00, 0x00, 0x6A, 0x01, 0x00, 0x00, 0x03, 0x00, 0x09, 0x1B, 0x00, 0x00, 0x00, 0xA2, 0x40, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0xC7, 0x00, 0x40, 0x00, 0xC7, 0x40, 0x80,
-    0x01, 0xE2, 0x40, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0xC7, 0x00, 0x40, 0x00, 0x0B, 0x01, 0x00,
-    0x00, 0xCA, 0x00, 0x81, 0x00, 0xC6, 0x40, 0x40, 0x00, 0x07, 0x01, 0x40, 0x00, 0x07, 0x41, 0x00,
-    0x02, 0xE4, 0x00, 0x01, 0x01, 0x1E, 0x80, 0x00, 0x80, 0x1F, 0xC0, 0x01, 0x01, 0x1E, 0x00, 0x00,
-    0x80, 0x26, 0x00, 0x80, 0x00, 0xE9, 0x80, 0x00, 0x00, 0x6A, 0x81, 0xFE, 0x7F, 0xC6, 0x80, 0x40,
-    0x00, 0xC7, 0xC0, 0xC0, 0x01, 0x07, 0x01, 0x40, 0x00, 0x07, 0x41, 0x00, 0x02, 0x40, 0x01, 0x00,
-    0x01, 0xE4, 0x40, 0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x5F,
-    0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x04, 0x07, 0x69, 0x70, 0x61, 0x69, 0x72,
-    0x73, 0x04, 0x06, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x04, 0x07, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x62, 0x01,
-    0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x63, 0x01,
-    0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x63, 0x01,
-    0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x65, 0x01,
-    0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x66, 0x01, 0x00, 0x00, 0x66, 0x01,
-    0x00, 0x00, 0x66, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x69, 0x01,
-    0x00, 0x00, 0x69, 0x01, 0x00, 0x00, 0x69, 0x01, 0x00, 0x00, 0x69, 0x01, 0x00, 0x00, 0x69, 0x01,
-    0x00, 0x00, 0x69, 0x01, 0x00, 0x00, 0x6A, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 0x73,
-    0x65, 0x6C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x61, 0x6D, 0x65,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72,
-    0x61, 0x74, 0x6F, 0x72, 0x29, 0x0E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66,
-    0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x0E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x0E,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x69, 0x0F, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
-    0x00, 0x03, 0x63, 0x62, 0x0F, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x6C, 0x01, 0x00, 0x00, 0x75, 0x01, 0x00, 0x00, 0x03, 0x00,
-    0x08, 0x0F, 0x00, 0x00, 0x00, 0xA2, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80,
-    0x00, 0xC6, 0x00, 0x40, 0x00, 0x0B, 0x01, 0x00, 0x00, 0x4B, 0x41, 0x00, 0x00, 0xAC, 0x01, 0x00,
-    0x00, 0x4A, 0x81, 0x81, 0x80, 0xE4, 0x80, 0x80, 0x01, 0x0C, 0x81, 0x40, 0x00, 0x80, 0x01, 0x80,
-    0x00, 0xC0, 0x01, 0x80, 0x01, 0x25, 0x01, 0x00, 0x02, 0x26, 0x01, 0x00, 0x00, 0x26, 0x00, 0x80,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x0D, 0x73, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61,
-    0x62, 0x6C, 0x65, 0x04, 0x07, 0x5F, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x04, 0x03, 0x6F, 0x6E, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0x73, 0x01,
-    0x00, 0x00, 0x01, 0x01, 0x05, 0x0A, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x4C, 0x00, 0xC0,
-    0x00, 0xC5, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x64, 0x40, 0x00, 0x02, 0x45, 0x00, 0x00,
-    0x01, 0xAD, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x26, 0x00, 0x80,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x07, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x71,
-    0x01, 0x00, 0x00, 0x71, 0x01, 0x00, 0x00, 0x71, 0x01, 0x00, 0x00, 0x71, 0x01, 0x00, 0x00, 0x71,
-    0x01, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x72,
-    0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x6F, 0x6E, 0x63, 0x65,
-    0x5F, 0x63, 0x62, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05,
-    0x73, 0x65, 0x6C, 0x66, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x0F, 0x00,
-    0x00, 0x00, 0x6D, 0x01, 0x00, 0x00, 0x6D, 0x01, 0x00, 0x00, 0x6D, 0x01, 0x00, 0x00, 0x6F, 0x01,
-    0x00, 0x00, 0x6F, 0x01, 0x00, 0x00, 0x6F, 0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x73, 0x01,
-    0x00, 0x00, 0x6F, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x74, 0x01,
-    0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x75, 0x01, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x05,
-    0x6E, 0x61, 0x6D, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75, 0x6E,
-    0x63, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 0x77, 0x72, 0x61, 0x70, 0x5F, 0x63,
-    0x62, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45,
-    0x4E, 0x56, 0x00, 0x77, 0x01, 0x00, 0x00, 0x7D, 0x01, 0x00, 0x00, 0x02, 0x01, 0x08, 0x12, 0x00,
-    0x00, 0x00, 0x87, 0x00, 0x40, 0x00, 0x87, 0x40, 0x00, 0x01, 0xA2, 0x40, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x87, 0x00, 0x40, 0x00, 0x87, 0x40, 0x00, 0x01, 0x9C, 0x00,
-    0x00, 0x01, 0xC1, 0x40, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0xA8, 0x00, 0x01, 0x80, 0x87, 0x01,
-    0x40, 0x00, 0x87, 0x41, 0x00, 0x03, 0x87, 0x41, 0x01, 0x03, 0xED, 0x01, 0x00, 0x00, 0xA4, 0x41,
-    0x00, 0x00, 0xA7, 0x40, 0xFE, 0x7F, 0x26, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x0B,
-    0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00,
-    0x78, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x7A, 0x01, 0x00, 0x00,
-    0x7A, 0x01, 0x00, 0x00, 0x7A, 0x01, 0x00, 0x00, 0x7A, 0x01, 0x00, 0x00, 0x7A, 0x01, 0x00, 0x00,
-    0x7A, 0x01, 0x00, 0x00, 0x7B, 0x01, 0x00, 0x00, 0x7B, 0x01, 0x00, 0x00, 0x7B, 0x01, 0x00, 0x00,
-    0x7B, 0x01, 0x00, 0x00, 0x7B, 0x01, 0x00, 0x00, 0x7A, 0x01, 0x00, 0x00, 0x7D, 0x01, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
-    0x00, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0C, 0x28,
-    0x66, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x00, 0x00, 0x00, 0x11, 0x00,
-    0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x29, 0x0A, 0x00,
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0B, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x65, 0x70,
-    0x29, 0x0A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x69, 0x0B, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00,
-    0x03, 0x00, 0x0B, 0x1A, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x40, 0x00, 0xC7, 0x40, 0x80, 0x01, 0xE2,
-    0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0xA2, 0x40, 0x00, 0x00, 0x1E,
-    0x40, 0x00, 0x80, 0xC7, 0x00, 0x40, 0x00, 0xCA, 0x40, 0xC0, 0x00, 0xC6, 0x80, 0x40, 0x00, 0x07,
-    0x01, 0x40, 0x00, 0x07, 0x41, 0x00, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x02, 0x80, 0x1F,
-    0xC0, 0x01, 0x01, 0x1E, 0x80, 0x01, 0x80, 0x06, 0xC2, 0x40, 0x00, 0x07, 0x02, 0x41, 0x04, 0x47,
-    0x02, 0x40, 0x00, 0x47, 0x42, 0x80, 0x04, 0x80, 0x02, 0x00, 0x03, 0x24, 0x42, 0x80, 0x01, 0x1E,
-    0x40, 0x00, 0x80, 0xE9, 0x80, 0x00, 0x00, 0x6A, 0x01, 0xFD, 0x7F, 0x26, 0x00, 0x80, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x04, 0x0B, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x00,
-    0x04, 0x07, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x06, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x04,
-    0x07, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00,
-    0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x00,
-    0x00, 0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00,
-    0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00,
-    0x00, 0x84, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00,
-    0x00, 0x85, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00,
-    0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x05, 0x6E,
-    0x61, 0x6D, 0x65, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75, 0x6E, 0x63,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65,
-    0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x0D, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x0D, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F,
-    0x6C, 0x29, 0x0D, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x69, 0x0E, 0x00, 0x00, 0x00,
-    0x17, 0x00, 0x00, 0x00, 0x03, 0x63, 0x62, 0x0E, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x0D, 0x00, 0x00, 0x00, 0x5F, 0x01, 0x00, 0x00,
-    0x5F, 0x01, 0x00, 0x00, 0x5F, 0x01, 0x00, 0x00, 0x6A, 0x01, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00,
-    0x75, 0x01, 0x00, 0x00, 0x6C, 0x01, 0x00, 0x00, 0x7D, 0x01, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00,
-    0x89, 0x01, 0x00, 0x00, 0x7F, 0x01, 0x00, 0x00, 0x8B, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x03, 0x45, 0x4D, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x8A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
-    0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-    0x35, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
-    0x5F, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00,
-    0x73, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
-    0x92, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
-    0xA8, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0xC6, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00,
-    0xEA, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0D, 0x01, 0x00, 0x00, 0x0D, 0x01, 0x00, 0x00,
-    0x11, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x1C, 0x01, 0x00, 0x00, 0x1C, 0x01, 0x00, 0x00,
-    0x23, 0x01, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00, 0x2D, 0x01, 0x00, 0x00, 0x2D, 0x01, 0x00, 0x00,
-    0x31, 0x01, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00,
-    0x33, 0x01, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00,
-    0x34, 0x01, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00,
-    0x36, 0x01, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00,
-    0x36, 0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00,
-    0x37, 0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x39, 0x01, 0x00, 0x00, 0x39, 0x01, 0x00, 0x00,
-    0x39, 0x01, 0x00, 0x00, 0x39, 0x01, 0x00, 0x00, 0x39, 0x01, 0x00, 0x00, 0x3A, 0x01, 0x00, 0x00,
-    0x3A, 0x01, 0x00, 0x00, 0x3A, 0x01, 0x00, 0x00, 0x3A, 0x01, 0x00, 0x00, 0x3A, 0x01, 0x00, 0x00,
-    0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00,
-    0x3D, 0x01, 0x00, 0x00, 0x3D, 0x01, 0x00, 0x00, 0x3D, 0x01, 0x00, 0x00, 0x3D, 0x01, 0x00, 0x00,
-    0x3D, 0x01, 0x00, 0x00, 0x3E, 0x01, 0x00, 0x00, 0x3E, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00,
-    0x3C, 0x01, 0x00, 0x00, 0x42, 0x01, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00,
-    0x4B, 0x01, 0x00, 0x00, 0x4D, 0x01, 0x00, 0x00, 0x4D, 0x01, 0x00, 0x00, 0x4F, 0x01, 0x00, 0x00,
-    0x58, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x5A, 0x01, 0x00, 0x00, 0x5C, 0x01, 0x00, 0x00,
-    0x5C, 0x01, 0x00, 0x00, 0x5E, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00,
-    0x8C, 0x01, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x01, 0x00, 0x00, 0x00, 0x8A, 0x00,
-    0x00, 0x00, 0x10, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x64, 0x65, 0x73, 0x74, 0x6F,
-    0x72, 0x79, 0x1C, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x0C, 0x70, 0x72, 0x6F, 0x63, 0x65,
-    0x73, 0x73, 0x5F, 0x64, 0x69, 0x65, 0x1D, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x0F, 0x70,
-    0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x1E, 0x00, 0x00,
-    0x00, 0x8A, 0x00, 0x00, 0x00, 0x10, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x65, 0x72, 0x5F,
-    0x79, 0x69, 0x65, 0x6C, 0x64, 0x1F, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x0C, 0x73, 0x6C,
-    0x65, 0x65, 0x70, 0x5F, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x20, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00,
-    0x00, 0x13, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C,
-    0x5F, 0x61, 0x6C, 0x6C, 0x21, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x13, 0x70, 0x72, 0x6F,
-    0x63, 0x65, 0x73, 0x73, 0x5F, 0x75, 0x6E, 0x6C, 0x69, 0x6E, 0x6B, 0x5F, 0x61, 0x6C, 0x6C, 0x22,
-    0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x13, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x5F,
-    0x6E, 0x6F, 0x74, 0x69, 0x66, 0x79, 0x5F, 0x61, 0x6C, 0x6C, 0x23, 0x00, 0x00, 0x00, 0x8A, 0x00,
-    0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F,
-    0x72, 0x29, 0x70, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20,
-    0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x70, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x0E, 0x28,
-    0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0x70, 0x00, 0x00, 0x00,
-    0x7A, 0x00, 0x00, 0x00, 0x02, 0x6B, 0x71, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x02, 0x76,
-    0x71, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E,
-    0x56,
+    0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0xA4, 0x40, 0x00, 0x00, 0x1E, 0x00, 0xFE, 0x7F, 0x26, 0x00,
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x06, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3A, 0x02, 0x00, 0x00, 0x3A,
+    0x02, 0x00, 0x00, 0x3A, 0x02, 0x00, 0x00, 0x3B, 0x02, 0x00, 0x00, 0x3B, 0x02, 0x00, 0x00, 0x3B,
+    0x02, 0x00, 0x00, 0x3B, 0x02, 0x00, 0x00, 0x3D, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+    0x63, 0x62, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x6D, 0x73, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x0B, 0x00, 0x00, 0x00, 0x36,
+    0x02, 0x00, 0x00, 0x36, 0x02, 0x00, 0x00, 0x36, 0x02, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0x3D,
+    0x02, 0x00, 0x00, 0x3D, 0x02, 0x00, 0x00, 0x3D, 0x02, 0x00, 0x00, 0x3D, 0x02, 0x00, 0x00, 0x37,
+    0x02, 0x00, 0x00, 0x3D, 0x02, 0x00, 0x00, 0x3E, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05,
+    0x66, 0x75, 0x6E, 0x63, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09, 0x69, 0x6E, 0x74,
+    0x65, 0x72, 0x76, 0x61, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x4D, 0x00, 0x40, 0x02, 0x00, 0x00, 0x42, 0x02, 0x00, 0x00, 0x01, 0x00, 0x04, 0x05,
+    0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC1, 0x40, 0x00, 0x00, 0x64,
+    0x40, 0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x05, 0x6B, 0x69, 0x6C,
+    0x6C, 0x04, 0x0F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61,
+    0x6C, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x41,
+    0x02, 0x00, 0x00, 0x41, 0x02, 0x00, 0x00, 0x41, 0x02, 0x00, 0x00, 0x41, 0x02, 0x00, 0x00, 0x42,
+    0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x4D, 0x00, 0x44, 0x02, 0x00, 0x00, 0x72, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x0D, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x4B, 0x00, 0x00,
+    0x00, 0x0A, 0x40, 0x00, 0x80, 0x6C, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x80, 0x6C, 0x40, 0x00,
+    0x00, 0x0A, 0x40, 0x00, 0x81, 0x6C, 0x80, 0x00, 0x00, 0x0A, 0x40, 0x80, 0x81, 0x6C, 0xC0, 0x00,
+    0x00, 0x0A, 0x40, 0x00, 0x82, 0x26, 0x00, 0x00, 0x01, 0x26, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x04, 0x0B, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x04, 0x03, 0x6F,
+    0x6E, 0x04, 0x05, 0x6F, 0x6E, 0x63, 0x65, 0x04, 0x05, 0x65, 0x6D, 0x69, 0x74, 0x04, 0x07, 0x72,
+    0x65, 0x6D, 0x6F, 0x76, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x47, 0x02, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x03, 0x00, 0x09, 0x1B, 0x00, 0x00, 0x00, 0xA2,
+    0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0xC7, 0x00, 0x40, 0x00, 0xC7,
+    0x40, 0x80, 0x01, 0xE2, 0x40, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x80, 0xC7, 0x00, 0x40, 0x00, 0x0B,
+    0x01, 0x00, 0x00, 0xCA, 0x00, 0x81, 0x00, 0xC6, 0x40, 0x40, 0x00, 0x07, 0x01, 0x40, 0x00, 0x07,
+    0x41, 0x00, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x1E, 0x80, 0x00, 0x80, 0x1F, 0xC0, 0x01, 0x01, 0x1E,
+    0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0xE9, 0x80, 0x00, 0x00, 0x6A, 0x81, 0xFE, 0x7F, 0xC6,
+    0x80, 0x40, 0x00, 0xC7, 0xC0, 0xC0, 0x01, 0x07, 0x01, 0x40, 0x00, 0x07, 0x41, 0x00, 0x02, 0x40,
+    0x01, 0x00, 0x01, 0xE4, 0x40, 0x80, 0x01, 0x26, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
+    0x0B, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x04, 0x07, 0x69, 0x70, 0x61,
+    0x69, 0x72, 0x73, 0x04, 0x06, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x04, 0x07, 0x69, 0x6E, 0x73, 0x65,
+    0x72, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00,
+    0x48, 0x02, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00,
+    0x49, 0x02, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00,
+    0x49, 0x02, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00, 0x4B, 0x02, 0x00, 0x00, 0x4B, 0x02, 0x00, 0x00,
+    0x4B, 0x02, 0x00, 0x00, 0x4B, 0x02, 0x00, 0x00, 0x4B, 0x02, 0x00, 0x00, 0x4C, 0x02, 0x00, 0x00,
+    0x4C, 0x02, 0x00, 0x00, 0x4C, 0x02, 0x00, 0x00, 0x4B, 0x02, 0x00, 0x00, 0x4B, 0x02, 0x00, 0x00,
+    0x4F, 0x02, 0x00, 0x00, 0x4F, 0x02, 0x00, 0x00, 0x4F, 0x02, 0x00, 0x00, 0x4F, 0x02, 0x00, 0x00,
+    0x4F, 0x02, 0x00, 0x00, 0x4F, 0x02, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x05, 0x73, 0x65, 0x6C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x61,
+    0x6D, 0x65, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75, 0x6E, 0x63, 0x00,
+    0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E,
+    0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x0E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0C,
+    0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x0E, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C,
+    0x29, 0x0E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x69, 0x0F, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x03, 0x63, 0x62, 0x0F, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x00, 0x52, 0x02, 0x00, 0x00, 0x5B, 0x02, 0x00, 0x00,
+    0x03, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x00, 0xA2, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26,
+    0x00, 0x80, 0x00, 0xC6, 0x00, 0x40, 0x00, 0x0B, 0x01, 0x00, 0x00, 0x4B, 0x41, 0x00, 0x00, 0xAC,
+    0x01, 0x00, 0x00, 0x4A, 0x81, 0x81, 0x80, 0xE4, 0x80, 0x80, 0x01, 0x0C, 0x81, 0x40, 0x00, 0x80,
+    0x01, 0x80, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x25, 0x01, 0x00, 0x02, 0x26, 0x01, 0x00, 0x00, 0x26,
+    0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x0D, 0x73, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x04, 0x07, 0x5F, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x04, 0x03, 0x6F,
+    0x6E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x56, 0x02, 0x00, 0x00,
+    0x59, 0x02, 0x00, 0x00, 0x01, 0x01, 0x05, 0x0A, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x4C,
+    0x00, 0xC0, 0x00, 0xC5, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x64, 0x40, 0x00, 0x02, 0x45,
+    0x00, 0x00, 0x01, 0xAD, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x26,
+    0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x07, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    0x00, 0x57, 0x02, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0x57, 0x02, 0x00,
+    0x00, 0x57, 0x02, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x58, 0x02, 0x00,
+    0x00, 0x58, 0x02, 0x00, 0x00, 0x59, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x6F, 0x6E,
+    0x63, 0x65, 0x5F, 0x63, 0x62, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x05, 0x66, 0x75, 0x6E, 0x63,
+    0x0F, 0x00, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00,
+    0x55, 0x02, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x59, 0x02, 0x00, 0x00,
+    0x59, 0x02, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x5A, 0x02, 0x00, 0x00, 0x5A, 0x02, 0x00, 0x00,
+    0x5A, 0x02, 0x00, 0x00, 0x5A, 0x02, 0x00, 0x00, 0x5A, 0x02, 0x00, 0x00, 0x5B, 0x02, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+    0x00, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x66,
+    0x75, 0x6E, 0x63, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 0x77, 0x72, 0x61, 0x70,
+    0x5F, 0x63, 0x62, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05,
+    0x5F, 0x45, 0x4E, 0x56, 0x00, 0x5D, 0x02, 0x00, 0x00, 0x63, 0x02, 0x00, 0x00, 0x02, 0x01, 0x08,
+    0x12, 0x00, 0x00, 0x00, 0x87, 0x00, 0x40, 0x00, 0x87, 0x40, 0x00, 0x01, 0xA2, 0x40, 0x00, 0x00,
+    0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0x87, 0x00, 0x40, 0x00, 0x87, 0x40, 0x00, 0x01,
+    0x9C, 0x00, 0x00, 0x01, 0xC1, 0x40, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0xA8, 0x00, 0x01, 0x80,
+    0x87, 0x01, 0x40, 0x00, 0x87, 0x41, 0x00, 0x03, 0x87, 0x41, 0x01, 0x03, 0xED, 0x01, 0x00, 0x00,
+    0xA4, 0x41, 0x00, 0x00, 0xA7, 0x40, 0xFE, 0x7F, 0x26, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x04, 0x0B, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x13, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x5E, 0x02, 0x00, 0x00, 0x5E, 0x02,
+    0x00, 0x00, 0x5E, 0x02, 0x00, 0x00, 0x5E, 0x02, 0x00, 0x00, 0x5E, 0x02, 0x00, 0x00, 0x60, 0x02,
+    0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x60, 0x02,
+    0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00, 0x61, 0x02,
+    0x00, 0x00, 0x61, 0x02, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x63, 0x02,
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x29,
+    0x0A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0B, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74,
+    0x65, 0x70, 0x29, 0x0A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x69, 0x0B, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x02, 0x00, 0x00, 0x6F, 0x02,
+    0x00, 0x00, 0x03, 0x00, 0x0B, 0x1A, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x40, 0x00, 0xC7, 0x40, 0x80,
+    0x01, 0xE2, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x26, 0x00, 0x80, 0x00, 0xA2, 0x40, 0x00,
+    0x00, 0x1E, 0x40, 0x00, 0x80, 0xC7, 0x00, 0x40, 0x00, 0xCA, 0x40, 0xC0, 0x00, 0xC6, 0x80, 0x40,
+    0x00, 0x07, 0x01, 0x40, 0x00, 0x07, 0x41, 0x00, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x02,
+    0x80, 0x1F, 0xC0, 0x01, 0x01, 0x1E, 0x80, 0x01, 0x80, 0x06, 0xC2, 0x40, 0x00, 0x07, 0x02, 0x41,
+    0x04, 0x47, 0x02, 0x40, 0x00, 0x47, 0x42, 0x80, 0x04, 0x80, 0x02, 0x00, 0x03, 0x24, 0x42, 0x80,
+    0x01, 0x1E, 0x40, 0x00, 0x80, 0xE9, 0x80, 0x00, 0x00, 0x6A, 0x01, 0xFD, 0x7F, 0x26, 0x00, 0x80,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B,
+    0x73, 0x00, 0x04, 0x07, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x04, 0x06, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x04, 0x07, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00, 0x66,
+    0x02, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x67,
+    0x02, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x69,
+    0x02, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x6A,
+    0x02, 0x00, 0x00, 0x6A, 0x02, 0x00, 0x00, 0x6B, 0x02, 0x00, 0x00, 0x6B, 0x02, 0x00, 0x00, 0x6B,
+    0x02, 0x00, 0x00, 0x6B, 0x02, 0x00, 0x00, 0x6B, 0x02, 0x00, 0x00, 0x6B, 0x02, 0x00, 0x00, 0x6B,
+    0x02, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x6F, 0x02, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x05, 0x73, 0x65, 0x6C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00,
+    0x05, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x05, 0x66, 0x75,
+    0x6E, 0x63, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20,
+    0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x0D, 0x00, 0x00, 0x00, 0x19, 0x00,
+    0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x0D, 0x00,
+    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+    0x72, 0x6F, 0x6C, 0x29, 0x0D, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x69, 0x0E, 0x00,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x03, 0x63, 0x62, 0x0E, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0x0D, 0x00, 0x00, 0x00, 0x45, 0x02,
+    0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x47, 0x02,
+    0x00, 0x00, 0x5B, 0x02, 0x00, 0x00, 0x52, 0x02, 0x00, 0x00, 0x63, 0x02, 0x00, 0x00, 0x5D, 0x02,
+    0x00, 0x00, 0x6F, 0x02, 0x00, 0x00, 0x65, 0x02, 0x00, 0x00, 0x71, 0x02, 0x00, 0x00, 0x72, 0x02,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x45, 0x4D, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x45, 0x4E, 0x56, 0xCC, 0x00, 0x00, 0x00, 0x0C, 0x00,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00,
+    0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00,
+    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x16, 0x00,
+    0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x18, 0x00,
+    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x1B, 0x00,
+    0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1D, 0x00,
+    0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1F, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x23, 0x00,
+    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x25, 0x00,
+    0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x2B, 0x00,
+    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x31, 0x00,
+    0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x35, 0x00,
+    0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x57, 0x00,
+    0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x7D, 0x00,
+    0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x9A, 0x00,
+    0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x9D, 0x00,
+    0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0xAA, 0x00,
+    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0xE7, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x12, 0x01,
+    0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x25, 0x01,
+    0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x2D, 0x01, 0x00, 0x00, 0x2D, 0x01,
+    0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x38, 0x01,
+    0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x47, 0x01, 0x00, 0x00, 0x47, 0x01,
+    0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x58, 0x01,
+    0x00, 0x00, 0x6A, 0x01, 0x00, 0x00, 0x6A, 0x01, 0x00, 0x00, 0x6E, 0x01, 0x00, 0x00, 0x6E, 0x01,
+    0x00, 0x00, 0x7E, 0x01, 0x00, 0x00, 0x7E, 0x01, 0x00, 0x00, 0x8F, 0x01, 0x00, 0x00, 0x8F, 0x01,
+    0x00, 0x00, 0x9B, 0x01, 0x00, 0x00, 0x9B, 0x01, 0x00, 0x00, 0xA1, 0x01, 0x00, 0x00, 0xA1, 0x01,
+    0x00, 0x00, 0xAB, 0x01, 0x00, 0x00, 0xAB, 0x01, 0x00, 0x00, 0xB1, 0x01, 0x00, 0x00, 0xB1, 0x01,
+    0x00, 0x00, 0xD5, 0x01, 0x00, 0x00, 0xD5, 0x01, 0x00, 0x00, 0xDD, 0x01, 0x00, 0x00, 0xDD, 0x01,
+    0x00, 0x00, 0xE7, 0x01, 0x00, 0x00, 0xE7, 0x01, 0x00, 0x00, 0xEE, 0x01, 0x00, 0x00, 0xEE, 0x01,
+    0x00, 0x00, 0xF6, 0x01, 0x00, 0x00, 0xF6, 0x01, 0x00, 0x00, 0xFA, 0x01, 0x00, 0x00, 0xFA, 0x01,
+    0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x0B, 0x02, 0x00, 0x00, 0x0B, 0x02,
+    0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x17, 0x02, 0x00, 0x00, 0x17, 0x02,
+    0x00, 0x00, 0x19, 0x02, 0x00, 0x00, 0x19, 0x02, 0x00, 0x00, 0x19, 0x02, 0x00, 0x00, 0x19, 0x02,
+    0x00, 0x00, 0x19, 0x02, 0x00, 0x00, 0x1A, 0x02, 0x00, 0x00, 0x1A, 0x02, 0x00, 0x00, 0x1A, 0x02,
+    0x00, 0x00, 0x1A, 0x02, 0x00, 0x00, 0x1A, 0x02, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x1C, 0x02,
+    0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x1D, 0x02,
+    0x00, 0x00, 0x1D, 0x02, 0x00, 0x00, 0x1D, 0x02, 0x00, 0x00, 0x1D, 0x02, 0x00, 0x00, 0x1D, 0x02,
+    0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x1F, 0x02,
+    0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x20, 0x02,
+    0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x22, 0x02,
+    0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x23, 0x02,
+    0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x24, 0x02,
+    0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x28, 0x02,
+    0x00, 0x00, 0x2F, 0x02, 0x00, 0x00, 0x2F, 0x02, 0x00, 0x00, 0x31, 0x02, 0x00, 0x00, 0x33, 0x02,
+    0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x3E, 0x02, 0x00, 0x00, 0x3E, 0x02,
+    0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x42, 0x02, 0x00, 0x00, 0x42, 0x02, 0x00, 0x00, 0x44, 0x02,
+    0x00, 0x00, 0x72, 0x02, 0x00, 0x00, 0x72, 0x02, 0x00, 0x00, 0x72, 0x02, 0x00, 0x00, 0x21, 0x00,
+    0x00, 0x00, 0x02, 0x4D, 0x01, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x49, 0x44,
+    0x5F, 0x53, 0x4C, 0x4F, 0x54, 0x5F, 0x42, 0x49, 0x54, 0x53, 0x2E, 0x00, 0x00, 0x00, 0xCC, 0x00,
+    0x00, 0x00, 0x0E, 0x50, 0x49, 0x44, 0x5F, 0x53, 0x4C, 0x4F, 0x54, 0x5F, 0x4D, 0x41, 0x53, 0x4B,
+    0x30, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x10, 0x50, 0x49, 0x44, 0x5F, 0x57, 0x4F, 0x52,
+    0x4B, 0x45, 0x52, 0x5F, 0x4D, 0x41, 0x53, 0x4B, 0x31, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00,
+    0x0E, 0x50, 0x49, 0x44, 0x5F, 0x47, 0x45, 0x4E, 0x5F, 0x53, 0x48, 0x49, 0x46, 0x54, 0x32, 0x00,
+    0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0D, 0x50, 0x49, 0x44, 0x5F, 0x47, 0x45, 0x4E, 0x5F, 0x4D,
+    0x41, 0x53, 0x4B, 0x33, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0A, 0x71, 0x75, 0x65, 0x75,
+    0x65, 0x5F, 0x6E, 0x65, 0x77, 0x3D, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0B, 0x71, 0x75,
+    0x65, 0x75, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x3E, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00,
+    0x0B, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5F, 0x70, 0x75, 0x73, 0x68, 0x3F, 0x00, 0x00, 0x00, 0xCC,
+    0x00, 0x00, 0x00, 0x0A, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5F, 0x70, 0x6F, 0x70, 0x40, 0x00, 0x00,
+    0x00, 0xCC, 0x00, 0x00, 0x00, 0x0A, 0x70, 0x69, 0x64, 0x5F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x41,
+    0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x09, 0x70, 0x69, 0x64, 0x5F, 0x66, 0x72, 0x65, 0x65,
+    0x42, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0C, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x5F, 0x70,
+    0x6C, 0x61, 0x63, 0x65, 0x43, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x09, 0x74, 0x69, 0x6D,
+    0x65, 0x72, 0x5F, 0x75, 0x70, 0x44, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0B, 0x74, 0x69,
+    0x6D, 0x65, 0x72, 0x5F, 0x64, 0x6F, 0x77, 0x6E, 0x45, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00,
+    0x0B, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x5F, 0x70, 0x75, 0x73, 0x68, 0x46, 0x00, 0x00, 0x00, 0xCC,
+    0x00, 0x00, 0x00, 0x0D, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x5F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65,
+    0x47, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0A, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x5F, 0x70,
+    0x6F, 0x70, 0x48, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x10, 0x70, 0x72, 0x6F, 0x63, 0x65,
+    0x73, 0x73, 0x5F, 0x64, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x50, 0x00, 0x00, 0x00, 0xCC, 0x00,
+    0x00, 0x00, 0x0C, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x64, 0x69, 0x65, 0x51, 0x00,
+    0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0D, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x77,
+    0x61, 0x6B, 0x65, 0x52, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0D, 0x70, 0x72, 0x6F, 0x63,
+    0x65, 0x73, 0x73, 0x5F, 0x72, 0x65, 0x61, 0x70, 0x53, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00,
+    0x0F, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x54,
+    0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x10, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x65,
+    0x72, 0x5F, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x55, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0C,
+    0x73, 0x6C, 0x65, 0x65, 0x70, 0x5F, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x56, 0x00, 0x00, 0x00, 0xCC,
+    0x00, 0x00, 0x00, 0x13, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x73, 0x69, 0x67, 0x6E,
+    0x61, 0x6C, 0x5F, 0x61, 0x6C, 0x6C, 0x57, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x13, 0x70,
+    0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x5F, 0x75, 0x6E, 0x6C, 0x69, 0x6E, 0x6B, 0x5F, 0x61, 0x6C,
+    0x6C, 0x58, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x13, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F,
+    0x72, 0x5F, 0x6E, 0x6F, 0x74, 0x69, 0x66, 0x79, 0x5F, 0x61, 0x6C, 0x6C, 0x59, 0x00, 0x00, 0x00,
+    0xCC, 0x00, 0x00, 0x00, 0x10, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61,
+    0x74, 0x6F, 0x72, 0x29, 0xB2, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x66, 0x6F,
+    0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0xB2, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
+    0x0E, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x29, 0xB2, 0x00,
+    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0x6B, 0xB3, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00,
+    0x02, 0x76, 0xB3, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x5F,
+    0x45, 0x4E, 0x56,
 };
 
 #endif
@@ -10,6 +10,8 @@
 #include "wrap_thread.h"
 #include "common/vfs.h"
 #include "common/logger.h"
+#include "common/serial.h"
+#include "common/channel.h"
 #include "modules/sevo/sevo.h"
 
 #define THREAD_READY    0
@@ -21,8 +23,8 @@ typedef struct mcl_thread_t {
     int         status;
     mc_sstr_t   file;
     mc_sstr_t   progm;
-    mc_chan_t   *chan0; /* handle(w) -> thread(r) */
-    mc_chan_t   *chan1; /* handle(r) <- thread(w) */
+    channel_t   *chan0; /* handle(w) -> thread(r) */
+    channel_t   *chan1; /* handle(r) <- thread(w) */
     mc_mutex_t  mutex;
     mc_cond_t   cond;
 } mcl_thread_t;
@@ -31,15 +33,18 @@ static int      g_thread_inited = 0;
 static mc_tls_t g_tls;
 
 static const char g_meta_thread[] = { CODE_NAME ".meta.thread" };
+static const char g_meta_blob[] = { SERIAL_META_BLOB };
 
 #define QSIZE_NUM                   64
+#define BATCH_NUM                   256
 #define luaX_checkthread(L, idx)    (mcl_thread_t *)luaL_checkudata(L, idx, g_meta_thread)
+#define luaX_checkblob(L, idx)      *(serial_blob_t **)luaL_checkudata(L, idx, g_meta_blob)
 #define local_thread()              (mcl_thread_t *)mc_tls_get_value(g_tls)
 #define tidx(i)                     (local_thread() ? ((i) - 1) : (i))
 
 #define WAIT_INFINITE   0xFFFFFFFF
 
-static mcl_thread_t *thread_handle(lua_State * L, int index, mc_chan_t **r, mc_chan_t **w) {
+static mcl_thread_t *thread_handle(lua_State * L, int index, channel_t **r, channel_t **w) {
     mcl_thread_t *thread = local_thread();
 
     if (thread) {
@@ -71,6 +76,11 @@ int thread_init(void) {
     return 0;
 }
 
+channel_t *thread_inbox(void) {
+    mcl_thread_t *thread = local_thread();
+    return thread ? thread->chan0 : NULL;
+}
+
 void thread_deinit(void) {
     if (g_thread_inited) {
         mc_tls_destroy(g_tls);
@@ -83,21 +93,21 @@ static int mcl_thread__gc(lua_State * L) {
     if (thread) {
         void *p;
 
-        mc_chan_shutdown(thread->chan0);
-        mc_chan_shutdown(thread->chan1);
+        channel_shutdown(thread->chan0);
+        channel_shutdown(thread->chan1);
 
-        while (mc_chan_readable(thread->chan0)) {
-            mc_chan_read(thread->chan0, &p);
-            mc_sstr_destroy((mc_sstr_t)p);
+        while (channel_readable(thread->chan0)) {
+            channel_read(thread->chan0, &p, 0);
+            serial_free((serial_buf_t *)p);
         }
 
-        while (mc_chan_readable(thread->chan1)) {
-            mc_chan_read(thread->chan1, &p);
-            mc_sstr_destroy((mc_sstr_t)p);
+        while (channel_readable(thread->chan1)) {
+            channel_read(thread->chan1, &p, 0);
+            serial_free((serial_buf_t *)p);
         }
 
-        mc_chan_destroy(thread->chan0);
-        mc_chan_destroy(thread->chan1);
+        channel_destroy(thread->chan0);
+        channel_destroy(thread->chan1);
         mc_cond_destroy(&thread->cond);
         mc_mutex_destroy(&thread->mutex);
 
@@ -253,84 +263,268 @@ static int mcl_thread_status(lua_State * L) {
 }
 
 static int mcl_thread_write(lua_State * L) {
-    mc_chan_t *chan_w;
-    size_t l = 0;
+    channel_t *chan_w;
+    mcl_thread_t *thread = thread_handle(L, 1, NULL, &chan_w);
+    int idx = tidx(2);
+    const char *err = NULL;
+    serial_buf_t *buf;
+
+    MC_UNUSED(thread);
+    luaL_checkany(L, idx);
+
+    /* Keep write(data, len) sending a prefix of a string. */
+    if ((LUA_TSTRING == lua_type(L, idx)) && !lua_isnoneornil(L, idx + 1)) {
+        size_t l = 0;
+        const char *data = lua_tolstring(L, idx, &l);
+        lua_Integer len = luaL_checkinteger(L, idx + 1);
+
+        lua_pushlstring(L, data, (size_t)MC_MAX(0, MC_MIN(len, (lua_Integer)l)));
+        idx = lua_gettop(L);
+    }
+
+    buf = serial_pack(L, idx, idx, &err);
+
+    if (!buf) {
+        return luaL_error(L, "Cannot write %s to a thread.", err);
+    }
+
+    if (0 != channel_write(chan_w, buf)) {
+        serial_free(buf);
+        lua_pushboolean(L, 0);
+    } else {
+        lua_pushboolean(L, 1);
+    }
+    return 1;
+}
+
+static int mcl_thread_write_many(lua_State * L) {
+    channel_t *chan_w;
     mcl_thread_t *thread = thread_handle(L, 1, NULL, &chan_w);
-    const char *data = luaL_checklstring(L, tidx(2), &l);
-    int len = (int)luaL_optinteger(L, tidx(3), (lua_Integer)l);
-    mc_sstr_t buf = mc_sstr_from_buffer(data, len);
+    int idx = tidx(2);
+    int i, n, count, written = 0;
+    serial_buf_t *bufs[BATCH_NUM];
+    const char *err = NULL;
+
+    MC_UNUSED(thread);
+    luaL_checktype(L, idx, LUA_TTABLE);
+
+    n = (int)lua_rawlen(L, idx);
+
+    /* Encode a batch, then move it under one lock. */
+    for (i = 1; i <= n; i += count) {
+        int j, put;
+
+        count = MC_MIN(BATCH_NUM, n - i + 1);
+
+        for (j = 0; j < count; ++j) {
+            lua_rawgeti(L, idx, i + j);
+            bufs[j] = serial_pack(L, -1, -1, &err);
+            lua_pop(L, 1);
+
+            if (!bufs[j]) {
+                while (j-- > 0) {
+                    serial_free(bufs[j]);
+                }
+                return luaL_error(L, "Cannot write %s to a thread.", err);
+            }
+        }
+
+        put = channel_write_many(chan_w, (void **)bufs, count);
+        written += put;
+
+        for (j = put; j < count; ++j) {
+            serial_free(bufs[j]);
+        }
+
+        if (put < count) {
+            break;
+        }
+    }
+
+    lua_pushinteger(L, written);
+    return 1;
+}
+
+static int mcl_thread_read_many(lua_State * L) {
+    channel_t *chan_r;
+    mcl_thread_t *thread = thread_handle(L, 1, &chan_r, NULL);
+    int max = (int)luaL_optinteger(L, tidx(2), BATCH_NUM);
+    unsigned int timeout = (unsigned int)luaL_optinteger(L, tidx(3), 0);
+    serial_buf_t *bufs[BATCH_NUM];
+    int i, n, count = 0;
 
     MC_UNUSED(thread);
-    lua_pushboolean(L, 0 == mc_chan_write(chan_w, buf));
+    lua_createtable(L, MC_MIN(max, BATCH_NUM), 0);
+
+    while (count < max) {
+        n = channel_read_many(chan_r, (void **)bufs, MC_MIN(max - count, BATCH_NUM), count ? 0 : timeout);
+
+        for (i = 0; i < n; ++i) {
+            if (1 != serial_unpack(L, bufs[i])) {
+                lua_pushnil(L);
+            }
+            lua_rawseti(L, -2, ++count);
+            serial_free(bufs[i]);
+        }
+
+        if (n < BATCH_NUM) {
+            break;
+        }
+    }
+
     return 1;
 }
 
 static int mcl_thread_read(lua_State * L) {
-    mc_chan_t *chan_r;
+    channel_t *chan_r;
     mcl_thread_t *thread = thread_handle(L, 1, &chan_r, NULL);
+    unsigned int timeout = (unsigned int)luaL_optinteger(L, tidx(2), 0);
     void *buf;
 
     MC_UNUSED(thread);
 
-    if (0 == mc_chan_read(chan_r, &buf)) {
-        mc_sstr_t data = (mc_sstr_t)buf;
-        lua_pushlstring(L, data, mc_sstr_length(data));
-        mc_sstr_destroy(data);
+    if (0 == channel_read(chan_r, &buf, timeout)) {
+        if (1 != serial_unpack(L, (serial_buf_t *)buf)) {
+            lua_pushnil(L);
+        }
+        serial_free((serial_buf_t *)buf);
     } else {
         lua_pushnil(L);
     }
     return 1;
 }
 
+/* Blocks until a message is readable, leaves it in the channel. */
+static int mcl_thread_wait(lua_State * L) {
+    channel_t *chan_r;
+    mcl_thread_t *thread = thread_handle(L, 1, &chan_r, NULL);
+    unsigned int timeout = (unsigned int)luaL_optinteger(L, tidx(2), WAIT_INFINITE);
+
+    MC_UNUSED(thread);
+    lua_pushboolean(L, channel_wait(chan_r, timeout));
+    return 1;
+}
+
 static int mcl_thread_writeable(lua_State * L) {
-    mc_chan_t *chan_w;
+    channel_t *chan_w;
     mcl_thread_t *thread = thread_handle(L, 1, NULL, &chan_w);
 
     MC_UNUSED(thread);
-    lua_pushboolean(L, mc_chan_writeable(chan_w));
+    lua_pushboolean(L, channel_writeable(chan_w));
     return 1;
 }
 
 static int mcl_thread_readable(lua_State * L) {
-    mc_chan_t *chan_r;
+    channel_t *chan_r;
     mcl_thread_t *thread = thread_handle(L, 1, &chan_r, NULL);
 
     MC_UNUSED(thread);
-    lua_pushboolean(L, mc_chan_readable(chan_r));
+    lua_pushboolean(L, channel_readable(chan_r));
     return 1;
 }
 
 static int mcl_thread_write_size(lua_State * L) {
-    mc_chan_t *chan_w;
+    channel_t *chan_w;
     mcl_thread_t *thread = thread_handle(L, 1, NULL, &chan_w);
 
     MC_UNUSED(thread);
-    lua_pushinteger(L, mc_chan_size(chan_w));
+    lua_pushinteger(L, channel_size(chan_w));
     return 1;
 }
 
 static int mcl_thread_read_size(lua_State * L) {
-    mc_chan_t *chan_r;
+    channel_t *chan_r;
     mcl_thread_t *thread = thread_handle(L, 1, &chan_r, NULL);
 
     MC_UNUSED(thread);
-    lua_pushinteger(L, mc_chan_size(chan_r));
+    lua_pushinteger(L, channel_size(chan_r));
+    return 1;
+}
+
+static int mcl_blob__gc(lua_State * L) {
+    serial_blob_t **blob = (serial_blob_t **)luaL_checkudata(L, 1, g_meta_blob);
+    if (*blob) {
+        serial_blob_unref(*blob);
+        *blob = NULL;
+    }
+    return 0;
+}
+
+static int mcl_blob_size(lua_State * L) {
+    serial_blob_t *blob = luaX_checkblob(L, 1);
+    lua_pushinteger(L, blob->size);
+    return 1;
+}
+
+static int mcl_blob_tostring(lua_State * L) {
+    serial_blob_t *blob = luaX_checkblob(L, 1);
+    lua_pushlstring(L, blob->data, blob->size);
+    return 1;
+}
+
+/* Same index rules as string.sub, only the slice is copied. */
+static int mcl_blob_sub(lua_State * L) {
+    serial_blob_t *blob = luaX_checkblob(L, 1);
+    lua_Integer i = luaL_optinteger(L, 2, 1);
+    lua_Integer j = luaL_optinteger(L, 3, -1);
+
+    if (i < 0) {
+        i = MC_MAX(blob->size + i + 1, 1);
+    } else if (0 == i) {
+        i = 1;
+    }
+
+    if (j < 0) {
+        j = blob->size + j + 1;
+    } else if (j > blob->size) {
+        j = blob->size;
+    }
+
+    if (i > j) {
+        lua_pushliteral(L, "");
+    } else {
+        lua_pushlstring(L, blob->data + i - 1, (size_t)(j - i + 1));
+    }
     return 1;
 }
 
+/* Raw address for ffi.cast, valid while the blob is referenced. */
+static int mcl_blob_pointer(lua_State * L) {
+    serial_blob_t *blob = luaX_checkblob(L, 1);
+    lua_pushlightuserdata(L, blob->data);
+    return 1;
+}
+
+static int mcl_blob_new(lua_State * L) {
+    size_t l = 0;
+    const char *data = luaL_checklstring(L, 1, &l);
+    serial_blob_t *blob = serial_blob_new(data, (int)l);
+
+    serial_push_blob(L, blob);
+    serial_blob_unref(blob);
+    return 1;
+}
+
+/* One reader and one writer per direction, so spsc fits by default. */
+static const char *g_channel_kinds[] = { "lock", "spsc", "mpsc", NULL };
+static const int g_channel_types[] = { CHANNEL_LOCK, CHANNEL_SPSC, CHANNEL_MPSC };
+
 static int mcl_thread_new(lua_State * L) {
     size_t l = 0;
     const char *fn = luaL_checkstring(L, 1);
     const char *pgm = NULL;
     int qsize = QSIZE_NUM;
+    int kind = 1;
     mcl_thread_t *thread;
 
     if (lua_gettop(L) >= 2) {
         if (lua_isinteger(L, 2)) {
             qsize = (int)luaL_optinteger(L, 2, QSIZE_NUM);
+            kind = luaL_checkoption(L, 3, "spsc", g_channel_kinds);
         } else {
             pgm = luaL_optlstring(L, 2, NULL, &l);
             qsize = (int)luaL_optinteger(L, 3, QSIZE_NUM);
+            kind = luaL_checkoption(L, 4, "spsc", g_channel_kinds);
         }
     }
 
@@ -341,8 +535,8 @@ static int mcl_thread_new(lua_State * L) {
     thread->file = mc_sstr_format("%s.lua", fn);
     thread->progm = pgm ? mc_sstr_from_buffer(pgm, (int)l) : NULL;
 
-    thread->chan0 = mc_chan_create(qsize);
-    thread->chan1 = mc_chan_create(qsize);
+    thread->chan0 = channel_create(qsize, g_channel_types[kind]);
+    thread->chan1 = channel_create(qsize, g_channel_types[kind]);
 
     mc_mutex_create(&thread->mutex);
     mc_cond_create(&thread->cond);
@@ -351,6 +545,15 @@ static int mcl_thread_new(lua_State * L) {
 }
 
 int luaopen_sevo_thread(lua_State* L) {
+    luaL_Reg meta_blob[] = {
+        { "__gc", mcl_blob__gc },
+        { "__len", mcl_blob_size },
+        { "__tostring", mcl_blob_tostring },
+        { "size", mcl_blob_size },
+        { "sub", mcl_blob_sub },
+        { "pointer", mcl_blob_pointer },
+        { NULL, NULL }
+    };
     luaL_Reg meta_thread[] = {
         { "__gc", mcl_thread__gc },
         { "start", mcl_thread_start },
@@ -358,6 +561,9 @@ int luaopen_sevo_thread(lua_State* L) {
         { "status", mcl_thread_status },
         { "write", mcl_thread_write },
         { "read", mcl_thread_read },
+        { "write_many", mcl_thread_write_many },
+        { "read_many", mcl_thread_read_many },
+        { "wait", mcl_thread_wait },
         { "writeable", mcl_thread_writeable },
         { "readable", mcl_thread_readable },
         { "write_size", mcl_thread_write_size },
@@ -366,9 +572,13 @@ int luaopen_sevo_thread(lua_State* L) {
     };
     luaL_Reg mod_thread[] = {
         { "new", mcl_thread_new },
+        { "blob", mcl_blob_new },
         { "run", mcl_thread_run },
         { "write", mcl_thread_write },
         { "read", mcl_thread_read },
+        { "write_many", mcl_thread_write_many },
+        { "read_many", mcl_thread_read_many },
+        { "wait", mcl_thread_wait },
         { "writeable", mcl_thread_writeable },
         { "readable", mcl_thread_readable },
         { "write_size", mcl_thread_write_size },
@@ -377,6 +587,7 @@ int luaopen_sevo_thread(lua_State* L) {
     };
 
     luaX_register_type(L, g_meta_thread, meta_thread);
+    luaX_register_type(L, g_meta_blob, meta_blob);
     luaX_register_module(L, "thread", mod_thread);
     return 0;
 }
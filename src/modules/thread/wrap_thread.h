@@ -11,6 +11,7 @@
 #define __WRAP_THREAD_H__
 
 #include "common/runtime.h"
+#include "common/channel.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -19,6 +20,9 @@ extern "C" {
     int thread_init(void);
     void thread_deinit(void);
 
+    /* The calling worker's inbound channel, NULL outside a worker. */
+    channel_t *thread_inbox(void);
+
     int luaopen_sevo_thread(lua_State* L);
 
 #ifdef __cplusplus
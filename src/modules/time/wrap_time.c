@@ -8,9 +8,15 @@
  */
 
 #include "wrap_time.h"
+#include "common/timewheel.h"
+#include "common/logger.h"
 
 static const char g_meta_timer[] = { CODE_NAME ".meta.timer" };
 static const char g_meta_fps[] = { CODE_NAME ".meta.fps" };
+static const char g_meta_wheel[] = { CODE_NAME ".meta.timewheel" };
+
+/* Registry key of the per-state timing wheel */
+static const char g_wheel_key = 0;
 
 #define luaX_checktimer(L, idx) (mc_timer_t *)luaL_checkudata(L, idx, g_meta_timer)
 #define luaX_checkfps(L, idx)   (mc_fps_t *)luaL_checkudata(L, idx, g_meta_fps)
@@ -77,6 +83,134 @@ static int mcl_fps_new(lua_State * L) {
     return 1;
 }
 
+static int mcl_wheel__gc(lua_State * L) {
+    timewheel_t **tw = (timewheel_t **)luaL_checkudata(L, 1, g_meta_wheel);
+    if (*tw) {
+        timewheel_destroy(*tw);
+        *tw = NULL;
+    }
+    return 0;
+}
+
+/* Pushes the callbacks table, returns the wheel of this state. */
+static timewheel_t *wheel_get(lua_State * L) {
+    timewheel_t **tw;
+
+    lua_rawgetp(L, LUA_REGISTRYINDEX, &g_wheel_key);
+    tw = (timewheel_t **)lua_touserdata(L, -1);
+    lua_getuservalue(L, -1);
+    lua_remove(L, -2);
+
+    return *tw;
+}
+
+static int wheel_add(lua_State * L, int repeat) {
+    unsigned int ms = (unsigned int)luaL_checkinteger(L, 1);
+    int i, top = lua_gettop(L);
+    timewheel_t *tw;
+    long long id;
+
+    luaL_checktype(L, 2, LUA_TFUNCTION);
+
+    tw = wheel_get(L);
+    id = timewheel_add(tw, ms, repeat ? MC_MAX(ms, 1) : 0);
+
+    if (!id) {
+        return luaL_error(L, "Timer create failed.");
+    }
+
+    /* callbacks[id] = { func, args..., n = #args + 1 } */
+    lua_createtable(L, top - 1, 1);
+    for (i = 2; i <= top; ++i) {
+        lua_pushvalue(L, i);
+        lua_rawseti(L, -2, i - 1);
+    }
+    lua_pushinteger(L, top - 1);
+    lua_setfield(L, -2, "n");
+    lua_rawseti(L, -2, (lua_Integer)id);
+
+    lua_pushinteger(L, (lua_Integer)id);
+    return 1;
+}
+
+static int mcl_after(lua_State * L) {
+    return wheel_add(L, 0);
+}
+
+static int mcl_every(lua_State * L) {
+    return wheel_add(L, 1);
+}
+
+static int mcl_cancel(lua_State * L) {
+    lua_Integer id = luaL_checkinteger(L, 1);
+    timewheel_t *tw = wheel_get(L);
+    int retval = timewheel_cancel(tw, id);
+
+    if (0 == retval) {
+        lua_pushnil(L);
+        lua_rawseti(L, -2, id);
+    }
+
+    lua_pushboolean(L, 0 == retval);
+    return 1;
+}
+
+static int mcl_update(lua_State * L) {
+    unsigned int elapsed = (unsigned int)luaL_checkinteger(L, 1);
+    timewheel_t *tw = wheel_get(L);
+    int cbs = lua_gettop(L);
+    int i, n, repeat, count = 0;
+    long long id;
+
+    timewheel_update(tw, elapsed);
+
+    /* Fire every due timer in one batch */
+    while (0 != (id = timewheel_expired(tw, &repeat))) {
+        if (LUA_TTABLE != lua_rawgeti(L, cbs, (lua_Integer)id)) {
+            lua_pop(L, 1);
+            continue;
+        }
+
+        if (!repeat) {
+            lua_pushnil(L);
+            lua_rawseti(L, cbs, (lua_Integer)id);
+        }
+
+        lua_getfield(L, -1, "n");
+        n = (int)lua_tointeger(L, -1);
+        lua_pop(L, 1);
+
+        luaL_checkstack(L, n, "too many timer arguments");
+
+        for (i = 1; i <= n; ++i) {
+            lua_rawgeti(L, cbs + 1, i);
+        }
+
+        if (LUA_OK != lua_pcall(L, n - 1, 0, 0)) {
+            LG_ERR("timer callback: %s", lua_tostring(L, -1));
+            lua_pop(L, 1);
+        }
+
+        lua_pop(L, 1);  /* pop callback entry */
+        count += 1;
+    }
+
+    lua_pushinteger(L, count);
+    return 1;
+}
+
+/* Milliseconds until sevo.time.update has work, nil without timers. */
+static int mcl_next(lua_State * L) {
+    int next = timewheel_next(wheel_get(L));
+
+    if (next < 0) {
+        lua_pushnil(L);
+    } else {
+        lua_pushinteger(L, next);
+    }
+    return 1;
+}
+
 static int mcl_sleep(lua_State * L) {
     unsigned int ms = (unsigned int)luaL_checkinteger(L, 1);
     mc_sleep(ms);
@@ -113,9 +247,18 @@ int luaopen_sevo_time(lua_State* L) {
         { "avg", mcl_fps_avg },
         { NULL, NULL }
     };
+    luaL_Reg meta_wheel[] = {
+        { "__gc", mcl_wheel__gc },
+        { NULL, NULL }
+    };
     luaL_Reg mod_time[] = {
         { "timer", mcl_timer_new },
         { "fps", mcl_fps_new },
+        { "after", mcl_after },
+        { "every", mcl_every },
+        { "cancel", mcl_cancel },
+        { "update", mcl_update },
+        { "next", mcl_next },
         { "sleep", mcl_sleep },
         { "now", mcl_now },
         { "millisec", mcl_millisec },
@@ -125,7 +268,19 @@ int luaopen_sevo_time(lua_State* L) {
 
     luaX_register_type(L, g_meta_timer, meta_timer);
     luaX_register_type(L, g_meta_fps, meta_fps);
+    luaX_register_type(L, g_meta_wheel, meta_wheel);
     luaX_register_module(L, "time", mod_time);
 
+    if (LUA_TNIL == lua_rawgetp(L, LUA_REGISTRYINDEX, &g_wheel_key)) {
+        timewheel_t **tw = (timewheel_t **)luaX_newuserdata(L, g_meta_wheel, sizeof(timewheel_t *));
+
+        *tw = timewheel_create();
+
+        lua_newtable(L);
+        lua_setuservalue(L, -2);
+        lua_rawsetp(L, LUA_REGISTRYINDEX, &g_wheel_key);
+    }
+    lua_pop(L, 1);
+
     return 0;
 }
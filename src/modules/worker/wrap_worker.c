@@ -0,0 +1,482 @@
+/*
+ *  wrap_worker.c
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#include "wrap_worker.h"
+#include "common/mpsc.h"
+#include "common/serial.h"
+#include "common/logger.h"
+#include "modules/sevo/sevo.h"
+
+#define WORKER_STOPPED  0
+#define WORKER_RUNNING  1
+
+#define MSG_SEND        0
+#define MSG_SPAWN       1
+
+/* Must match the PID layout in sevo.lua */
+#define PID_SLOT_BITS   24
+#define PID_WORKER_MASK 0xFF
+
+#define MAX_WORKERS     PID_WORKER_MASK
+#define POLL_MAX        4096
+#define TICK_DEFAULT    10
+
+typedef struct wmsg_t {
+    mpsc_node_t node;
+    int         type;
+    long long   pid;    /* send: destination, spawn: reply to, -1 if none */
+    long long   ref;
+    serial_buf_t *data;
+} wmsg_t;
+
+typedef struct worker_t {
+    mpsc_t          inbox;
+    int             index;
+    int             status;
+    volatile int    sleeping;
+    volatile int    load;
+    mc_mutex_t      mutex;
+    mc_cond_t       cond;
+} worker_t;
+
+static int                  g_worker_inited = 0;
+static mc_tls_t             g_tls;
+static worker_t             *g_workers = NULL;  /* 0 is the main state */
+static int                  g_worker_num = 0;
+static int                  g_worker_tick = TICK_DEFAULT;
+static volatile int         g_worker_quit = 0;
+static volatile long long   g_worker_ref = 0;
+
+#define local_worker()      (worker_t *)mc_tls_get_value(g_tls)
+#define pid_worker(pid)     ((int)(((pid) >> PID_SLOT_BITS) & PID_WORKER_MASK))
+
+static void msg_free(wmsg_t *m) {
+    serial_free(m->data);
+    mc_free(m);
+}
+
+static int worker_post(int index, int type, long long pid, long long ref, serial_buf_t *data) {
+    worker_t *w;
+    wmsg_t *m;
+
+    if (!g_workers || g_worker_quit || (index < 0) || (index > g_worker_num)) {
+        serial_free(data);
+        return -1;
+    }
+
+    m = (wmsg_t *)mc_malloc(sizeof(wmsg_t));
+    m->type = type;
+    m->pid = pid;
+    m->ref = ref;
+    m->data = data;
+
+    w = g_workers + index;
+    mpsc_push(&w->inbox, &m->node);
+
+    if (atomic_load_int(&w->sleeping)) {
+        mc_mutex_lock(&w->mutex);
+        mc_cond_signal(&w->cond);
+        mc_mutex_unlock(&w->mutex);
+    }
+
+    return 0;
+}
+
+/* Power of two choices, the less loaded of two candidates. */
+static int worker_pick(long long seed) {
+    unsigned int h = (unsigned int)seed * 2654435761u;
+    int a = 1 + (int)(h % (unsigned int)g_worker_num);
+    int b = 1 + (int)((h >> 16) % (unsigned int)g_worker_num);
+
+    if (atomic_load_int(&g_workers[b].load) < atomic_load_int(&g_workers[a].load)) {
+        a = b;
+    }
+
+    /* Count it now, so a burst of spawns spreads out before the next tick. */
+    atomic_add_int(&g_workers[a].load, 1);
+    return a;
+}
+
+static int worker_call(lua_State * L, int nargs, int nresults) {
+    if (LUA_OK != lua_pcall(L, nargs, nresults, 0)) {
+        LG_ERR("Worker: %s", lua_tostring(L, -1));
+        lua_pop(L, 1);
+        return -1;
+    }
+    return 0;
+}
+
+static void worker_dispatch(lua_State * L, wmsg_t *m) {
+    int top = lua_gettop(L);
+
+    if (MSG_SEND == m->type) {
+        luaX_getsevo(L, "send");
+        lua_pushinteger(L, m->pid);
+
+        if (1 == serial_unpack(L, m->data)) {
+            worker_call(L, 2, 0);
+        }
+    } else {
+        int n;
+
+        luaX_getsevo(L, "spawn");
+        n = serial_unpack(L, m->data);
+
+        /* spawn(require(module), ...) */
+        if ((n >= 1) && lua_isstring(L, top + 2)) {
+            lua_getglobal(L, "require");
+            lua_pushvalue(L, top + 2);
+
+            if (0 == worker_call(L, 1, 1)) {
+                lua_replace(L, top + 2);
+
+                if ((0 == worker_call(L, n, 1)) && lua_isinteger(L, -1) && (m->pid >= 0)) {
+                    lua_Integer pid = lua_tointeger(L, -1);
+
+                    luaX_getsevo(L, "send");
+                    lua_pushinteger(L, m->pid);
+
+                    lua_createtable(L, 0, 3);
+                    lua_pushliteral(L, "SPAWN");
+                    lua_setfield(L, -2, "signal");
+                    lua_pushinteger(L, m->ref);
+                    lua_setfield(L, -2, "ref");
+                    lua_pushinteger(L, pid);
+                    lua_setfield(L, -2, "pid");
+
+                    worker_call(L, 2, 0);
+                }
+            }
+        }
+    }
+
+    lua_settop(L, top);
+}
+
+static int mcl_worker_route(lua_State * L) {
+    lua_Integer pid = luaL_checkinteger(L, 1);
+    const char *err = NULL;
+    serial_buf_t *data;
+
+    luaL_checkany(L, 2);
+
+    if (!g_workers) {
+        lua_pushboolean(L, 0);
+        return 1;
+    }
+
+    data = serial_pack(L, 2, 2, &err);
+
+    if (!data) {
+        return luaL_error(L, "Cannot send %s to another worker.", err);
+    }
+
+    lua_pushboolean(L, 0 == worker_post(pid_worker(pid), MSG_SEND, pid, 0, data));
+    return 1;
+}
+
+static int mcl_worker_poll(lua_State * L) {
+    worker_t *w = local_worker();
+    mpsc_node_t *node;
+    int count = 0;
+
+    if (!g_workers) {
+        lua_pushinteger(L, 0);
+        return 1;
+    }
+
+    if (!w) {
+        w = g_workers;
+    }
+
+    while ((count < POLL_MAX) && (NULL != (node = mpsc_pop(&w->inbox)))) {
+        worker_dispatch(L, (wmsg_t *)node);
+        msg_free((wmsg_t *)node);
+        count += 1;
+    }
+
+    lua_pushinteger(L, count);
+    return 1;
+}
+
+static void worker_attach(lua_State * L, int index, int enable) {
+    luaX_getsevo(L, "attach");
+    lua_pushinteger(L, index);
+
+    if (enable) {
+        lua_pushcfunction(L, mcl_worker_route);
+        lua_pushcfunction(L, mcl_worker_poll);
+        lua_call(L, 3, 0);
+    } else {
+        lua_call(L, 1, 0);
+    }
+}
+
+static void worker_wait(worker_t *w, unsigned int timeout) {
+    mc_mutex_lock(&w->mutex);
+    atomic_store_int(&w->sleeping, 1);
+
+    if (!g_worker_quit && mpsc_empty(&w->inbox)) {
+        mc_cond_timedwait(&w->cond, &w->mutex, timeout);
+    }
+
+    atomic_store_int(&w->sleeping, 0);
+    mc_mutex_unlock(&w->mutex);
+}
+
+static void worker_main(void *param) {
+    worker_t *w = (worker_t *)param;
+    unsigned long long last, now;
+    lua_State *L;
+
+    mc_tls_set_value(g_tls, w);
+
+    L = luaX_newstate();
+    luaL_openlibs(L);
+
+    luaX_preload(L, CODE_NAME, luaopen_sevo);
+
+    luaX_require(L, CODE_NAME);
+    lua_pop(L, 1);
+
+    luaX_require(L, CODE_NAME ".parallel");
+    lua_pop(L, 1);
+
+    luaX_getsevo(L, "parallel");
+    lua_call(L, 0, 0);
+
+    worker_attach(L, w->index, 1);
+
+    last = mc_millisec(NULL);
+
+    while (!g_worker_quit) {
+        int delta, elapsed;
+
+        now = mc_millisec(NULL);
+        delta = (int)(now - last);
+        last = now;
+
+        luaX_getsevo(L, "scheduler");
+        lua_pushinteger(L, delta);
+        worker_call(L, 1, 0);
+
+        luaX_getsevo(L, "time");
+        lua_getfield(L, -1, "update");
+        lua_pushinteger(L, delta);
+        worker_call(L, 1, 0);
+        lua_pop(L, 1);
+
+        luaX_getsevo(L, "living");
+        if (0 == worker_call(L, 0, 1)) {
+            atomic_store_int(&w->load, (int)lua_tointeger(L, -1));
+            lua_pop(L, 1);
+        }
+
+        /* Sleep out the rest of the tick, a post wakes us early. */
+        elapsed = (int)(mc_millisec(NULL) - now);
+
+        if (elapsed < g_worker_tick) {
+            worker_wait(w, (unsigned int)(g_worker_tick - elapsed));
+        }
+    }
+
+    lua_close(L);
+
+    mc_mutex_lock(&w->mutex);
+    w->status = WORKER_STOPPED;
+    mc_cond_broadcast(&w->cond);
+    mc_mutex_unlock(&w->mutex);
+}
+
+static void worker_stop(void) {
+    mpsc_node_t *node;
+    int i;
+
+    if (!g_workers) {
+        return;
+    }
+
+    g_worker_quit = 1;
+
+    for (i = 1; i <= g_worker_num; ++i) {
+        worker_t *w = g_workers + i;
+
+        mc_mutex_lock(&w->mutex);
+        while (WORKER_RUNNING == w->status) {
+            mc_cond_broadcast(&w->cond);
+            mc_cond_timedwait(&w->cond, &w->mutex, g_worker_tick);
+        }
+        mc_mutex_unlock(&w->mutex);
+    }
+
+    for (i = 0; i <= g_worker_num; ++i) {
+        worker_t *w = g_workers + i;
+
+        while (NULL != (node = mpsc_pop(&w->inbox))) {
+            msg_free((wmsg_t *)node);
+        }
+
+        mc_cond_destroy(&w->cond);
+        mc_mutex_destroy(&w->mutex);
+    }
+
+    mc_free(g_workers);
+    g_workers = NULL;
+    g_worker_num = 0;
+}
+
+int worker_init(void) {
+    if (!g_worker_inited) {
+        mc_tls_create(&g_tls);
+        g_worker_inited = 1;
+    }
+    return 0;
+}
+
+void worker_deinit(void) {
+    if (g_worker_inited) {
+        worker_stop();
+        mc_tls_destroy(g_tls);
+        g_worker_inited = 0;
+    }
+}
+
+static int mcl_worker_start(lua_State * L) {
+    int i, n = (int)luaL_optinteger(L, 1, mc_cpunum());
+    int tick = (int)luaL_optinteger(L, 2, TICK_DEFAULT);
+
+    if (local_worker()) {
+        return luaL_error(L, "Workers can only be started from the main state.");
+    }
+
+    if (g_workers) {
+        lua_pushboolean(L, 0);
+        return 1;
+    }
+
+    n = MC_MAX(1, MC_MIN(n, MAX_WORKERS));
+
+    g_workers = (worker_t *)mc_calloc(n + 1, sizeof(worker_t));
+    g_worker_num = n;
+    g_worker_tick = MC_MAX(1, tick);
+    g_worker_quit = 0;
+
+    for (i = 0; i <= n; ++i) {
+        worker_t *w = g_workers + i;
+
+        mpsc_init(&w->inbox);
+        w->index = i;
+        w->status = WORKER_STOPPED;
+
+        mc_mutex_create(&w->mutex);
+        mc_cond_create(&w->cond);
+    }
+
+    worker_attach(L, 0, 1);
+
+    for (i = 1; i <= n; ++i) {
+        mc_thread_t t = { worker_main, g_workers + i };
+
+        g_workers[i].status = WORKER_RUNNING;
+        mc_thread_exec(&t, 1);
+    }
+
+    lua_pushboolean(L, 1);
+    return 1;
+}
+
+static int mcl_worker_stop(lua_State * L) {
+    if (local_worker()) {
+        return luaL_error(L, "Workers can only be stopped from the main state.");
+    }
+
+    if (!g_workers) {
+        lua_pushboolean(L, 0);
+        return 1;
+    }
+
+    worker_stop();
+    worker_attach(L, 0, 0);
+
+    lua_pushboolean(L, 1);
+    return 1;
+}
+
+static int mcl_worker_spawn(lua_State * L) {
+    int top = lua_gettop(L);
+    long long from = -1, ref;
+    const char *err = NULL;
+    serial_buf_t *data;
+
+    luaL_checkstring(L, 1);
+
+    if (!g_workers) {
+        return luaL_error(L, "Workers are not started.");
+    }
+
+    luaX_getsevo(L, "self");
+    lua_call(L, 0, 1);
+    if (lua_isinteger(L, -1)) {
+        from = lua_tointeger(L, -1);
+    }
+    lua_pop(L, 1);
+
+    data = serial_pack(L, 1, top, &err);
+
+    if (!data) {
+        return luaL_error(L, "Cannot pass %s to another worker.", err);
+    }
+
+    ref = atomic_add_ll(&g_worker_ref, 1) + 1;
+
+    if (0 != worker_post(worker_pick(ref), MSG_SPAWN, from, ref, data)) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_pushinteger(L, ref);
+    return 1;
+}
+
+static int mcl_worker_count(lua_State * L) {
+    lua_pushinteger(L, g_worker_num);
+    return 1;
+}
+
+static int mcl_worker_index(lua_State * L) {
+    worker_t *w = local_worker();
+    lua_pushinteger(L, w ? w->index : 0);
+    return 1;
+}
+
+static int mcl_worker_load(lua_State * L) {
+    int index = (int)luaL_checkinteger(L, 1);
+
+    if (!g_workers || (index < 0) || (index > g_worker_num)) {
+        lua_pushnil(L);
+    } else {
+        lua_pushinteger(L, atomic_load_int(&g_workers[index].load));
+    }
+    return 1;
+}
+
+int luaopen_sevo_worker(lua_State* L) {
+    luaL_Reg mod_worker[] = {
+        { "start", mcl_worker_start },
+        { "stop", mcl_worker_stop },
+        { "spawn", mcl_worker_spawn },
+        { "count", mcl_worker_count },
+        { "index", mcl_worker_index },
+        { "load", mcl_worker_load },
+        { NULL, NULL }
+    };
+
+    luaX_register_module(L, "worker", mod_worker);
+    return 0;
+}
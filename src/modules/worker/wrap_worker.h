@@ -0,0 +1,28 @@
+/*
+ *  wrap_worker.h
+ *
+ *  copyright (c) 2018 Xiongfei Shi
+ *
+ *  author: Xiongfei Shi <jenson.shixf(a)gmail.com>
+ *  license: Apache-2.0
+ */
+
+#ifndef __WRAP_WORKER_H__
+#define __WRAP_WORKER_H__
+
+#include "common/runtime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    int worker_init(void);
+    void worker_deinit(void);
+
+    int luaopen_sevo_worker(lua_State* L);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif  /* __WRAP_WORKER_H__ */
@@ -145,8 +145,10 @@ function sevo.init()
         "hash",
         "rand",
         "net",
+        "poll",
         "secure",
         "thread",
+        "worker",
         "dbm",
         "env",
         "math",
@@ -177,7 +179,9 @@ function sevo.run()
     return function()
         fps:update()
 
+        local start = sevo.time.millisec()
         local alive = sevo.scheduler(fps:delta())
+        sevo.time.update(fps:delta())
 
         if sevo.event then
             sevo.event.pump()
@@ -192,6 +196,7 @@ function sevo.run()
                         while alive do
                             fps:update()
                             alive = sevo.scheduler(fps:delta())
+                            sevo.time.update(fps:delta())
                             fps:wait();
                         end
                     end
@@ -204,6 +209,18 @@ function sevo.run()
 
         if sevo.update then sevo.update(fps:delta()) end
 
+        -- Serve registered sockets every frame, even one that overran the
+        -- tick, then sleep out what is left of it in the poller
+        if sevo.poll.count() > 0 then
+            local deadline = start + M.conf.tick
+            local now = sevo.time.millisec()
+
+            repeat
+                sevo.poll.wait(math.max(deadline - now, 0))
+                now = sevo.time.millisec()
+            until now >= deadline or sevo.poll.count() == 0
+        end
+
         fps:wait();
     end
 end
@@ -14,21 +14,60 @@ function sevo.parallel()
     require("sevo.logger")
     require("sevo.vfs")
     require("sevo.thread")
+    require("sevo.worker")
     require("sevo.time")
 end
 
+-- net:update takes its timeout as an unsigned millisecond count.
+local FOREVER = 0xFFFFFFFF
+
+-- A tick of 0 runs event driven: the thread sleeps on its inbound channel
+-- (or on the net handle) until a message, process timeout or timer is due.
+-- A threaded net wakes on messages too, a direct one returns every 10 ms.
+local function evented(func, net)
+    local alive = true
+    local last = sevo.time.millisec()
+
+    while alive do
+        local now = sevo.time.millisec()
+        local delta = now - last
+        last = now
+
+        alive = sevo.scheduler(delta)
+        sevo.time.update(delta)
+        if alive and func then func(delta) end
+
+        if alive then
+            local timeout = sevo.idle()
+            local timer = sevo.time.next()
+            if timer and (not timeout or timer < timeout) then timeout = timer end
+
+            if net then
+                if not sevo.thread.readable() then
+                    net:update(timeout or FOREVER)
+                end
+            elseif timeout ~= 0 then
+                sevo.thread.wait(timeout)
+            end
+        end
+    end
+end
+
 return function()
     sevo.parallel()
 
-    local func, tick = sevo.thread.run()
+    local func, tick, net = sevo.thread.run()
     tick = tick or 10
 
+    if tick <= 0 then return evented(func, net) end
+
     local alive = true
     local fps = sevo.time.fps(1000 / tick)
 
     while alive do
         fps:update()
         alive = sevo.scheduler(fps:delta())
+        sevo.time.update(fps:delta())
         if alive and func then func(fps:delta()) end
         fps:wait();
     end
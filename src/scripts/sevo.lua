@@ -13,19 +13,148 @@ local M = {}            -- Submodule for concurrent.
 
 M.names = {}            -- Process names and PIDs associative table.
 M.processes = {}        -- All the processes in the system.
+M.pids = setmetatable({}, { __mode = "k" })    -- Coroutines and PIDs reverse index.
 M.slaughters = {}       -- The processes is pending kill
 M.mailboxes = {}        -- Mailboxes associated with processes.
 M.timeouts = {}         -- Timeouts for processes that are suspended.
-M.links = {}            -- Active links between processes.
-M.monitors = {}         -- Active monitors between processes.
+M.timers = {}           -- Min-heap of pending timeouts, ordered by deadline.
+M.runqueue = nil        -- Processes ready to be resumed on next tick.
+M.ready = {}            -- Processes already queued in runqueue.
+M.waiting = {}          -- Processes suspended until a message or timeout.
+M.clock = 0             -- Scheduler clock, milliseconds.
+M.count = 0             -- Number of living processes, except root.
+M.links = {}            -- Active links between processes, as sets.
+M.monitors = {}         -- Processes watching each process, as sets.
+M.watching = {}         -- Processes watched by each process, as sets.
+M.generations = {}      -- Current generation of each process slot.
+M.freeslots = {}        -- Slots of reaped processes, ready for reuse.
+M.maxslot = 0           -- Highest slot ever allocated.
+M.worker = 0            -- Index of the worker owning this state, 0 for main.
+M.root = 0              -- PID of the root process of this state.
+M.route = nil           -- Delivers messages to processes of other workers.
+M.poll = nil            -- Drains messages posted by other workers.
 M.ondeath = {}          -- Functions to execute on abnormal exit.
 M.ondestruction = {}    -- Functions to execute on termination.
 
+-- PID layout: generation << 32 | worker << 24 | slot, a stale PID never
+-- reaches a recycled slot because the generation differs.
+local PID_SLOT_BITS = 24
+local PID_SLOT_MASK = (1 << PID_SLOT_BITS) - 1
+local PID_WORKER_MASK = 0xFF
+local PID_GEN_SHIFT = 32
+local PID_GEN_MASK = (1 << 20) - 1
+
 -- Root process has PID of 0.
 M.processes[0] = coroutine.running()
+M.pids[M.processes[0]] = 0
+
+local function queue_new()
+    return { first = 1, last = 0 }
+end
+
+local function queue_size(mb)
+    return mb.last - mb.first + 1
+end
+
+local function queue_push(mb, msg)
+    local last = mb.last + 1
+    mb.last = last
+    mb[last] = msg
+end
+
+local function queue_pop(mb)
+    local first = mb.first
+    if first > mb.last then return end
+    local msg = mb[first]
+    mb[first] = nil
+    if first == mb.last then
+        mb.first, mb.last = 1, 0    -- Rewind while empty, keeps indices small.
+    else
+        mb.first = first + 1
+    end
+    return msg
+end
+
+local function pid_alloc()
+    local slot = table.remove(M.freeslots)
+    if not slot then
+        slot = M.maxslot + 1
+        if slot > PID_SLOT_MASK then error("too many processes", 2) end
+        M.maxslot = slot
+        M.generations[slot] = 0
+    end
+    return (M.generations[slot] << PID_GEN_SHIFT) | (M.worker << PID_SLOT_BITS) | slot
+end
+
+local function pid_free(pid)
+    local slot = pid & PID_SLOT_MASK
+    M.generations[slot] = (M.generations[slot] + 1) & PID_GEN_MASK
+    table.insert(M.freeslots, slot)
+end
+
+-- Heap entries keep their index, so a timeout cancelled by a message
+-- leaves the heap at once instead of waiting out its deadline.
+local function timer_place(heap, i, t)
+    heap[i] = t
+    t.index = i
+end
+
+local function timer_up(heap, i, t)
+    while i > 1 do
+        local parent = i // 2
+        if heap[parent].deadline <= t.deadline then break end
+        timer_place(heap, i, heap[parent])
+        i = parent
+    end
+    timer_place(heap, i, t)
+end
+
+local function timer_down(heap, i, t)
+    local n = #heap
+    while true do
+        local child = i * 2
+        if child > n then break end
+        if child < n and heap[child + 1].deadline < heap[child].deadline then
+            child = child + 1
+        end
+        if t.deadline <= heap[child].deadline then break end
+        timer_place(heap, i, heap[child])
+        i = child
+    end
+    timer_place(heap, i, t)
+end
+
+local function timer_push(t)
+    local heap = M.timers
+    timer_up(heap, #heap + 1, t)
+end
+
+local function timer_remove(t)
+    local heap = M.timers
+    local i, n = t.index, #heap
+    if not i or heap[i] ~= t then return end
+    local last = heap[n]
+    heap[n] = nil
+    t.index = nil
+    if i < n then
+        if i > 1 and last.deadline < heap[i // 2].deadline then
+            timer_up(heap, i, last)
+        else
+            timer_down(heap, i, last)
+        end
+    end
+end
+
+local function timer_pop()
+    local top = M.timers[1]
+    timer_remove(top)
+    return top
+end
+
+M.runqueue = queue_new()
 
 -- Root process mailbox.
-M.mailboxes[0] = {}
+M.mailboxes[0] = queue_new()
 
 local function process_destory()
     local pid = M.self()
@@ -40,6 +169,48 @@ local function process_die(pid, reason)
     end
 end
 
+local function process_wake(pid)
+    if M.ready[pid] then return end
+    M.ready[pid] = true
+    queue_push(M.runqueue, pid)
+end
+
+-- Release everything a dead process holds, then recycle its slot.
+local function process_reap(pid)
+    M.count = M.count - 1
+    M.processes[pid] = nil
+    M.mailboxes[pid] = nil
+    M.waiting[pid] = nil
+    if M.timeouts[pid] then
+        timer_remove(M.timeouts[pid])
+        M.timeouts[pid] = nil
+    end
+    M.slaughters[pid] = nil
+
+    if M.links[pid] then
+        for other in pairs(M.links[pid]) do
+            if M.links[other] then M.links[other][pid] = nil end
+        end
+        M.links[pid] = nil
+    end
+
+    if M.watching[pid] then
+        for target in pairs(M.watching[pid]) do
+            if M.monitors[target] then M.monitors[target][pid] = nil end
+        end
+        M.watching[pid] = nil
+    end
+
+    if M.monitors[pid] then
+        for watcher in pairs(M.monitors[pid]) do
+            if M.watching[watcher] then M.watching[watcher][pid] = nil end
+        end
+        M.monitors[pid] = nil
+    end
+
+    pid_free(pid)
+end
+
 local function process_resume(co, ...)
     if type(co) ~= "thread" or coroutine.status(co) ~= "suspended" then
         return
@@ -49,6 +220,9 @@ local function process_resume(co, ...)
         local pid = M.whois(co)
         process_die(pid, errmsg)
     end
+    if coroutine.status(co) == "dead" then
+        process_reap(M.whois(co))
+    end
     return status, errmsg
 end
 
@@ -57,38 +231,34 @@ local function scheduler_yield()
 end
 
 local function sleep_yield(pid, timeout)
-    if pid ~= 0 then return scheduler_yield() end
+    if pid ~= M.root then return scheduler_yield() end
 
-    local start = sevo.time.millisec()
+    local last = sevo.time.millisec()
+    local elapsed = 0
 
-    while true do
-        if #M.mailboxes[pid] > 0 then break end
+    while queue_size(M.mailboxes[pid]) == 0 do
+        if timeout and elapsed >= timeout then return end
 
         local now = sevo.time.millisec()
-        local elapsed = now - start
-
-        if M.timeouts[pid] and elapsed >= M.timeouts[pid] then
-            M.timeouts[pid] = nil
-            return
-        end
+        elapsed = elapsed + (now - last)
 
-        sevo.scheduler(elapsed)
+        sevo.scheduler(now - last)
         sevo.time.sleep(0)
+        last = now
     end
 end
 
 local function process_signal_all(dead, reason)
     if M.links[dead] == nil then return end
-    for _, v in pairs(M.links[dead]) do
+    for v in pairs(M.links[dead]) do
         M.signal(v, dead, reason)
     end
-    M.links[dead] = nil
 end
 
 local function process_unlink_all()
     local s = M.self()
     if M.links[s] == nil then return end
-    for _, v in pairs(M.links[s]) do
+    for v in pairs(M.links[s]) do
         M.unlink(v)
     end
     M.links[s] = nil
@@ -96,16 +266,38 @@ end
 
 local function monitor_notify_all(dead, reason)
     if M.monitors[dead] == nil then return end
-    for _, v in pairs(M.monitors[dead]) do
+    for v in pairs(M.monitors[dead]) do
         M.notify(v, dead, reason)
+        if M.watching[v] then M.watching[v][dead] = nil end
     end
     M.monitors[dead] = nil
 end
 
-M.whois = function(co)
-    for k, v in pairs(M.processes) do
-        if co == v then return k end
+M.workerof = function(pid)
+    return (pid >> PID_SLOT_BITS) & PID_WORKER_MASK
+end
+
+-- Bind this state to a worker, PIDs spawned from now on carry its index.
+M.attach = function(worker, route, poll)
+    local root = (worker or 0) << PID_SLOT_BITS
+    if root ~= M.root then
+        local co = M.processes[M.root]
+        M.processes[root], M.processes[M.root] = co, nil
+        M.mailboxes[root], M.mailboxes[M.root] = M.mailboxes[M.root], nil
+        M.pids[co] = root
+        M.root = root
     end
+    M.worker = worker or 0
+    M.route = route
+    M.poll = poll
+end
+
+M.living = function()
+    return M.count
+end
+
+M.whois = function(co)
+    return M.pids[co]
 end
 
 M.whereis = function(name)
@@ -158,12 +350,14 @@ M.spawn = function(func, ...)
             func(...)
             process_destory()
         end)
-    table.insert(M.processes, co)
-    local pid = #M.processes    -- todo: generate unique process id
-    M.mailboxes[pid] = {}
-    M.timeouts[pid] = 0
+    local pid = pid_alloc()
+    M.processes[pid] = co
+    M.pids[co] = pid
+    M.mailboxes[pid] = queue_new()
+    M.count = M.count + 1
     local status, errmsg = process_resume(co, ...)
     if not status then return nil, errmsg end
+    process_wake(pid)
     return pid
 end
 
@@ -172,10 +366,14 @@ M.exit = function(reason)
 end
 
 M.kill = function(pid, reason)
-    if type(M.processes[pid]) == "thread" then
-        if coroutine.status(M.processes[pid]) == "suspended" then
-            local status, errmsg = coroutine.resume(M.processes[pid], "EXIT")
+    local co = M.processes[pid]
+    if type(co) == "thread" then
+        if coroutine.status(co) == "suspended" then
+            local status, errmsg = coroutine.resume(co, "EXIT")
             process_die(pid, reason)
+            if coroutine.status(co) == "dead" and M.processes[pid] then
+                process_reap(pid)
+            end
             return true
         end
         M.slaughters[pid] = reason
@@ -185,65 +383,107 @@ end
 
 M.sleep = function(timeout)
     local pid = M.self()
-    if timeout then M.timeouts[pid] = timeout end
+    if pid ~= M.root then
+        if timeout then
+            M.timeouts[pid] = { deadline = M.clock + timeout, pid = pid }
+            timer_push(M.timeouts[pid])
+        end
+        M.waiting[pid] = true
+    end
     sleep_yield(pid, timeout)
-    if timeout then M.timeouts[pid] = nil end
+    M.waiting[pid] = nil
+    if M.timeouts[pid] then
+        timer_remove(M.timeouts[pid])
+        M.timeouts[pid] = nil
+    end
 end
 
 M.send = function(dest, msg)
     local pid = M.whereis(dest)
     if not pid then return false end
-    table.insert(M.mailboxes[pid], msg)
+    if M.workerof(pid) ~= M.worker then
+        return M.route ~= nil and M.route(pid, msg)
+    end
+    if not M.mailboxes[pid] then return false end
+    queue_push(M.mailboxes[pid], msg)
+    if M.waiting[pid] then process_wake(pid) end
     return true
 end
 
 M.receive = function(timeout)
-    local pid = M.self()
-    if #M.mailboxes[pid] == 0 then M.sleep(timeout) end
-    if #M.mailboxes[pid] > 0 then
-        return table.remove(M.mailboxes[pid], 1)
-    end
+    local mb = M.mailboxes[M.self()]
+    if queue_size(mb) == 0 then M.sleep(timeout) end
+    return queue_pop(mb)
+end
+
+M.receive_many = function(n, timeout)
+    local mb = M.mailboxes[M.self()]
+    if queue_size(mb) == 0 then M.sleep(timeout) end
+    local size = queue_size(mb)
+    if not n or n > size then n = size end
+    local msgs = {}
+    for i = 1, n do msgs[i] = queue_pop(mb) end
+    return msgs
+end
+
+M.pending = function(dest)
+    local pid = dest and M.whereis(dest) or M.self()
+    if not pid or not M.mailboxes[pid] then return end
+    return queue_size(M.mailboxes[pid])
 end
 
 M.scheduler = function(delta)
-    local alive = false
+    M.clock = M.clock + (delta or 0)
 
-    for pid, reason in pairs(M.slaughters) do
-        if M.kill(pid, reason) then
-            M.slaughters[pid] = nil
-        end
-    end
+    if M.poll then M.poll() end
 
-    for k, v in pairs(M.processes) do
-        if M.timeouts[k] then
-            M.timeouts[k] = M.timeouts[k] - delta
+    -- Kills may cascade through links, collect them into a fresh table.
+    if next(M.slaughters) then
+        local slaughters = M.slaughters
+        M.slaughters = {}
+        for pid, reason in pairs(slaughters) do
+            if not M.kill(pid, reason) and M.processes[pid] then
+                M.slaughters[pid] = reason
+            end
         end
+    end
 
-        if #M.mailboxes[k] > 0 or (M.timeouts[k] and M.timeouts[k] <= 0) then
-            if M.timeouts[k] then M.timeouts[k] = nil end
-            process_resume(v)
+    -- Expired timeouts, wakes remove theirs so every entry is live.
+    local heap = M.timers
+    while heap[1] and heap[1].deadline <= M.clock do
+        local t = timer_pop()
+        if M.timeouts[t.pid] == t then
+            M.timeouts[t.pid] = nil
+            process_wake(t.pid)
         end
+    end
 
-        if not alive and coroutine.status(v) ~= "dead" then
-            if k ~= 0 then alive = true end
-            -- todo: process cleanup
-        end
+    -- Processes woken during this pass run on the next tick.
+    for i = 1, queue_size(M.runqueue) do
+        local pid = queue_pop(M.runqueue)
+        M.ready[pid] = nil
+        process_resume(M.processes[pid])
     end
 
-    return alive
+    return M.count > 0
+end
+
+-- Milliseconds the scheduler may stay idle, nil when only a message
+-- or a spawn can make a process runnable.
+M.idle = function()
+    if queue_size(M.runqueue) > 0 or next(M.slaughters) then return 0 end
+    local t = M.timers[1]
+    if t then return math.max(t.deadline - M.clock, 0) end
 end
 
 M.link = function(dest)
     local s = M.self()
     local pid = M.whereis(dest)
-    if not pid then return end
+    if not pid or not M.processes[pid] then return end
     if M.links[s] == nil then M.links[s] = {} end
     if M.links[pid] == nil then M.links[pid] = {} end
-    for _, v in pairs(M.links[s]) do
-        if pid == v then return end
-    end
-    table.insert(M.links[s], pid)
-    table.insert(M.links[pid], s)
+    M.links[s][pid] = true
+    M.links[pid][s] = true
 end
 
 M.spawnlink = function(...)
@@ -257,15 +497,8 @@ M.unlink = function(dest)
     local s = M.self()
     local pid = M.whereis(dest)
     if not pid then return end
-    if M.links[s] == nil or M.links[pid] == nil then
-        return
-    end
-    for k, v in pairs(M.links[s]) do
-        if pid == v then M.links[s][k] = nil end
-    end
-    for k, v in pairs(M.links[pid]) do
-        if s == v then M.links[pid][k] = nil end
-    end
+    if M.links[s] then M.links[s][pid] = nil end
+    if M.links[pid] then M.links[pid][s] = nil end
 end
 
 M.signal = function(dest, dead, reason)
@@ -275,12 +508,11 @@ end
 M.monitor = function(dest)
     local s = M.self()
     local pid = M.whereis(dest)
-    if not pid then return end
+    if not pid or not M.processes[pid] then return end
     if M.monitors[pid] == nil then M.monitors[pid] = {} end
-    for _, v in pairs(M.monitors[pid]) do
-        if s == v then return end
-    end
-    table.insert(M.monitors[pid], s)
+    if M.watching[s] == nil then M.watching[s] = {} end
+    M.monitors[pid][s] = true
+    M.watching[s][pid] = true
 end
 
 M.spawnmonitor =  function(...)
@@ -294,10 +526,8 @@ M.demonitor = function(dest)
     local s = M.self()
     local pid = M.whereis(dest)
     if not pid then return end
-    if M.monitors[pid] == nil then return end
-    for k, v in pairs(M.monitors[pid]) do
-        if s == v then M.monitors[pid][k] = nil end
-    end
+    if M.monitors[pid] then M.monitors[pid][s] = nil end
+    if M.watching[s] then M.watching[s][pid] = nil end
 end
 
 M.notify = function(dest, dead, reason)
@@ -322,6 +322,251 @@ local test_func = {
             n:update()
         end
     end,
+    function()
+        print("-- Net receive garbage --")
+        local n = sevo.net.new()
+        local s = n:server("udp", "0.0.0.0", 12346)
+        local c = n:connect("udp", "127.0.0.1", 12346)
+        local ready = false
+        local e = {}
+
+        while not ready do
+            n:update(10)
+            while n:receive(e) do
+                if e.cmd == "halo" then
+                    e.who:auth("bench")
+                elseif e.cmd == "auth" then
+                    e.who:accept("ok")
+                elseif e.cmd == "accepted" then
+                    ready = true
+                end
+            end
+        end
+
+        local batched = {}
+        local drains = {
+            table = function()
+                local k = 0
+                while true do
+                    local evt = n:receive()
+                    if not evt then return k end
+                    if evt.cmd == "data" then k = k + 1 end
+                end
+            end,
+            reuse = function()
+                local k = 0
+                while n:receive(e) do
+                    if e.cmd == "data" then k = k + 1 end
+                end
+                return k
+            end,
+            next = function()
+                local k = 0
+                while true do
+                    local cmd = n:next()
+                    if not cmd then return k end
+                    if cmd == "data" then k = k + 1 end
+                end
+            end,
+            batch = function()
+                local k = 0
+                local events, count = n:receive_batch(256, batched)
+                for i = 1, count do
+                    if events[i].cmd == "data" then k = k + 1 end
+                end
+                return k
+            end,
+            dispatch = function()
+                local k = 0
+                n:dispatch({ data = function() k = k + 1 end })
+                return k
+            end,
+        }
+
+        local rounds, batch = 20000, 500
+        for _, name in ipairs({ "table", "reuse", "next", "batch", "dispatch" }) do
+            collectgarbage("collect")
+            collectgarbage("stop")
+
+            local before = collectgarbage("count")
+            local t1 = sevo.time.microsec()
+            local got = 0
+
+            for _ = 1, rounds // batch do
+                for _ = 1, batch do c:send("0123456789abcdef") end
+                local deadline = sevo.time.millisec() + 1000
+                local want = got + batch
+                while got < want and sevo.time.millisec() < deadline do
+                    n:update(1)
+                    got = got + drains[name]()
+                end
+            end
+
+            local t2 = sevo.time.microsec()
+            print(name .. ": " .. got .. " events, " .. math.floor(collectgarbage("count") - before) .. " KB garbage, " .. (t2 - t1) .. " us")
+            collectgarbage("restart")
+        end
+    end,
+    function()
+        print("-- Corked sends --")
+        local n = sevo.net.new()
+        local s = n:server("udp", "0.0.0.0", 12349)
+        local c = n:connect("udp", "127.0.0.1", 12349)
+        local ready, messages, bytes = false, 0, 0
+        local deadline = sevo.time.millisec() + 3000
+
+        local handlers = {
+            halo = function(who) who:auth("cork") end,
+            auth = function(who) who:accept("ok") end,
+            accepted = function(who) ready = true end,
+            data = function(who, data)
+                messages = messages + 1
+                bytes = bytes + #data
+            end,
+        }
+
+        while not ready and sevo.time.millisec() < deadline do
+            n:update(1)
+            n:dispatch(handlers)
+        end
+
+        c:cork()
+        for i = 1, 100 do
+            c:sendv({ "[", tostring(i), "]" })
+        end
+        print("corked sendv: " .. select(2, c:queued()) .. " messages, empty " .. tostring(c:sendv({})))
+        c:send("end")
+
+        while bytes < 395 and sevo.time.millisec() < deadline do
+            n:update(1)
+            n:dispatch(handlers)
+        end
+
+        print("corked: " .. messages .. " messages, " .. bytes .. " bytes")
+        print("uncork: " .. tostring(c:uncork()))
+        c:close()
+        s:close()
+    end,
+    function()
+        print("-- Peer watermarks --")
+        local n = sevo.net.new()
+        local s = n:server("udp", "0.0.0.0", 12351)
+        local c = n:connect("udp", "127.0.0.1", 12351)
+        local ready, seen = false, {}
+        local deadline = sevo.time.millisec() + 3000
+
+        local handlers = {
+            halo = function(who) who:auth("limits") end,
+            auth = function(who) who:accept("ok") end,
+            accepted = function(who) ready = true end,
+            writable = function(who) seen[#seen + 1] = "writable" end,
+            drained = function(who) seen[#seen + 1] = "drained" end,
+        }
+
+        while not ready and sevo.time.millisec() < deadline do
+            n:update(1)
+            n:dispatch(handlers)
+        end
+
+        local chunk = string.rep("x", 100)
+        c:cork()
+        c:watermark(100, 300, 500)
+        for i = 1, 6 do
+            print("send " .. i .. ": " .. tostring(c:send(chunk)) .. ", writable " .. tostring(c:writable()) .. ", queued " .. c:queued())
+        end
+
+        while #seen < 2 and sevo.time.millisec() < deadline do
+            n:update(1)
+            n:dispatch(handlers)
+        end
+
+        print("events: " .. table.concat(seen, ", "))
+        print("hard past the send buffer: " .. tostring(pcall(c.watermark, c, 0, 100, 1 << 30)))
+        c:close()
+        s:close()
+    end,
+    function()
+        print("-- Net group broadcast --")
+        local n = sevo.net.new()
+        local s = n:server("udp", "0.0.0.0", 12350)
+        local room = n:group()
+        local clients, received, accepted = {}, 0, 0
+        local deadline = sevo.time.millisec() + 3000
+
+        for i = 1, 8 do
+            clients[i] = n:connect("udp", "127.0.0.1", 12350)
+        end
+
+        local handlers = {
+            halo = function(who) who:auth("room") end,
+            auth = function(who)
+                who:accept("ok")
+                room:add(who)
+            end,
+            accepted = function(who) accepted = accepted + 1 end,
+            data = function(who, data) received = received + 1 end,
+        }
+
+        while accepted < #clients and sevo.time.millisec() < deadline do
+            n:update(1)
+            n:dispatch(handlers)
+        end
+
+        local rounds = 100
+        local t1 = sevo.time.microsec()
+        for _ = 1, rounds do
+            room:send("broadcast")
+        end
+        local t2 = sevo.time.microsec()
+
+        while received < rounds * #room and sevo.time.millisec() < deadline do
+            n:update(1)
+            n:dispatch(handlers)
+        end
+
+        print("group of " .. #room .. ": " .. received .. " received, " .. (t2 - t1) .. " us to send")
+        for _, c in ipairs(clients) do c:close() end
+        s:close()
+    end,
+    function()
+        print("-- Net I/O threads --")
+        local pool = sevo.net.new({ threads = 2 })
+        local n = sevo.net.new()
+        local s, shards = pool:server("udp", "0.0.0.0", 12348)
+        print("listening on " .. shards .. " of 2 I/O threads")
+        local c = n:connect("udp", "127.0.0.1", 12348)
+        local total, echoed, ready, last = 2000, 0, false, nil
+        local deadline = sevo.time.millisec() + 5000
+
+        local server = {
+            auth = function(who) who:accept("ok") end,
+            data = function(who, data) last = who; who:send(data) end,
+        }
+        local client = {
+            halo = function(who) who:auth("pool") end,
+            accepted = function(who) ready = true end,
+            data = function(who, data) echoed = echoed + 1 end,
+        }
+
+        local function pump()
+            n:update(1)
+            n:dispatch(client)
+            pool:update(1)
+            pool:dispatch(server)
+        end
+
+        while not ready and sevo.time.millisec() < deadline do pump() end
+
+        local t1 = sevo.time.microsec()
+        for i = 1, total do c:send(tostring(i)) end
+        while echoed < total and sevo.time.millisec() < deadline do pump() end
+        local t2 = sevo.time.microsec()
+
+        print("pool " .. s:mode() .. " server echoed " .. echoed .. "/" .. total .. " in " .. (t2 - t1) .. " us")
+        print("pool peer queued after the echoes: " .. (last and last:queued() or 0))
+        c:close()
+        s:close()
+    end,
     function()
         local t1 = sevo.thread.new("test-thread")
         local t2 = sevo.thread.new("th1", [[
@@ -351,6 +596,141 @@ local test_func = {
         t2:join()
         print("Status2: " .. t2:status())
     end,
+    function()
+        print("-- Typed thread messages --")
+        local t = sevo.thread.new("echo", [[
+            sevo.spawn(function()
+                while true do
+                    local msg = sevo.thread.read()
+                    if msg ~= nil then
+                        sevo.thread.write(msg)
+                        if msg == "quit" then break end
+                    else
+                        sevo.sleep(1)
+                    end
+                end
+            end)
+        ]])
+        t:start()
+
+        local blob = sevo.thread.blob(string.rep("x", 1024 * 1024))
+        t:write({ id = 1, ratio = 0.5, ok = true, tags = { "a", "b" }, payload = blob })
+        t:write("quit")
+
+        local msgs = {}
+        while #msgs < 2 do
+            local msg = t:read()
+            if msg ~= nil then table.insert(msgs, msg) else sevo.time.sleep(1) end
+        end
+
+        local echo = msgs[1]
+        print("id: " .. echo.id .. " (" .. math.type(echo.id) .. "), ratio: " .. echo.ratio .. ", ok: " .. tostring(echo.ok) .. ", tags: " .. table.concat(echo.tags, ","))
+        print("blob: " .. #echo.payload .. " bytes, head: " .. echo.payload:sub(1, 4) .. ", shared: " .. tostring(echo.payload:pointer() == blob:pointer()))
+        print("last: " .. msgs[2])
+
+        t:join()
+    end,
+    function()
+        print("-- Batched thread channel --")
+        local t = sevo.thread.new("batch", [[
+            sevo.spawn(function()
+                local count = 0
+                while true do
+                    local msgs = sevo.thread.read_many(1024, 100)
+                    count = count + #msgs
+                    if msgs[#msgs] == "quit" then break end
+                end
+                sevo.thread.write(count - 1)
+            end)
+        ]], 4096)
+        t:start()
+
+        local batch = {}
+        for i = 1, 1000 do batch[i] = i end
+
+        local total = 1000000
+        local t1 = sevo.time.microsec()
+        local sent = 0
+        while sent < total do
+            local n = t:write_many(batch)
+            sent = sent + n
+            if n < #batch then sevo.time.sleep(0) end
+        end
+        while not t:write("quit") do sevo.time.sleep(0) end
+
+        local count = t:read(5000)
+        local t2 = sevo.time.microsec()
+
+        print("sent: " .. sent .. ", received: " .. tostring(count) .. ", rate: " .. math.floor(sent / ((t2 - t1) / 1000000)) .. " msg/s")
+        t:join()
+    end,
+    function()
+        print("-- Channel kinds --")
+        for _, kind in ipairs({ "lock", "spsc", "mpsc" }) do
+            local t = sevo.thread.new("kind", [[
+                sevo.spawn(function()
+                    local count = 0
+                    while true do
+                        local msgs = sevo.thread.read_many(1024, 100)
+                        count = count + #msgs
+                        if msgs[#msgs] == "quit" then break end
+                    end
+                    sevo.thread.write(count - 1)
+                end)
+            ]], 4096, kind)
+            t:start()
+
+            local batch = {}
+            for i = 1, 1000 do batch[i] = i end
+
+            local total = 1000000
+            local t1 = sevo.time.microsec()
+            local sent = 0
+            while sent < total do
+                local n = t:write_many(batch)
+                sent = sent + n
+                if n < #batch then sevo.time.sleep(0) end
+            end
+            while not t:write("quit") do sevo.time.sleep(0) end
+
+            local count = t:read(5000)
+            local t2 = sevo.time.microsec()
+
+            print(kind .. ": received " .. tostring(count) .. ", rate: " .. math.floor(sent / ((t2 - t1) / 1000000)) .. " msg/s")
+            t:join()
+        end
+    end,
+    function()
+        print("-- Event driven thread --")
+        local t = sevo.thread.new("evented", [[
+            local echo = sevo.spawn(function()
+                while true do
+                    local msg = sevo.receive()
+                    if msg == "quit" then break end
+                    sevo.thread.write(msg)
+                end
+            end)
+
+            return function()
+                for _, msg in ipairs(sevo.thread.read_many(256, 0)) do
+                    sevo.send(echo, msg)
+                end
+            end, 0
+        ]])
+        t:start()
+
+        local rounds = 10000
+        local t1 = sevo.time.microsec()
+        for i = 1, rounds do
+            t:write(i)
+            assert(t:read(1000) == i)
+        end
+        local t2 = sevo.time.microsec()
+
+        print("round trip: " .. math.floor((t2 - t1) / rounds) .. " us")
+        t:write("quit")
+        t:join()
+    end,
     function()
         local db = sevo.dbm.open("testdb")
         db:put("hello", "world")
@@ -376,6 +756,234 @@ local test_func = {
 
         db:close()
     end,
+    function()
+        print("-- Dbm transactions --")
+        local db = sevo.dbm.open("txndb")
+
+        local txn = db:begin()
+        txn:put("t1", "one")
+        txn:put("t2", "two")
+        print(txn:get("t1"), db:get("t1"))
+        txn:del("t2")
+        print(txn:commit(), db:get("t1"), db:get("t2"))
+
+        txn = db:begin()
+        txn:put("t3", "three")
+        txn:abort()
+        print(db:get("t3"), pcall(txn.put, txn, "t3", "three"))
+
+        local rounds = 200
+        local t1 = sevo.time.microsec()
+        for i = 1, rounds do
+            db:put("single" .. i, "value" .. i)
+        end
+        local t2 = sevo.time.microsec()
+        print("per-op puts: " .. math.floor(rounds * 1000000 / math.max(t2 - t1, 1)) .. " ops/s")
+
+        rounds = 10000
+        local batch = {}
+        for i = 1, rounds do
+            batch["batch" .. i] = "value" .. i
+        end
+        t1 = sevo.time.microsec()
+        local count = db:put_many(batch)
+        t2 = sevo.time.microsec()
+        print("put_many: " .. count .. " keys, " .. math.floor(rounds * 1000000 / math.max(t2 - t1, 1)) .. " ops/s")
+
+        t1 = sevo.time.microsec()
+        txn = db:begin()
+        for i = 1, rounds do
+            txn:put("txn" .. i, "value" .. i)
+        end
+        txn:commit()
+        t2 = sevo.time.microsec()
+        print("txn puts: " .. math.floor(rounds * 1000000 / math.max(t2 - t1, 1)) .. " ops/s")
+
+        db:close()
+    end,
+    function()
+        print("-- Dbm tables --")
+        local db = sevo.dbm.open("tabledb", { mapsize = 1024 * 1024, sync = "none", maxdbs = 4, maxreaders = 512 })
+        print("reader slots: " .. db:stat().maxreaders)
+        local users = db:table("users")
+        local tags = db:table("tags", { dupsort = true })
+        local ids = db:table("ids", { integerkey = true })
+
+        users:put("alice", "1")
+        tags:put("alice", "red")
+        tags:put("alice", "blue")
+        tags:del("alice", "red")
+        ids:put(42, "answer")
+        print(users:get("alice"), tags:get("alice"), ids:get(42), db:get("alice"))
+        print(ids:keys()[1], #db:keys())
+
+        local before = db:stat().mapsize
+        local blob = string.rep("x", 4096)
+        for i = 1, 512 do
+            users:put("blob" .. i, blob)
+        end
+        print("map size: " .. before .. " -> " .. db:stat().mapsize .. ", entries: " .. users:stat().entries)
+
+        db:sync()
+        ids:close()
+        tags:close()
+        users:close()
+        db:close()
+    end,
+    function()
+        print("-- Dbm cursors --")
+        local db = sevo.dbm.open("scandb")
+        local batch = { other = "x" }
+        for i = 1, 1000 do
+            batch[string.format("k%04d", i)] = tostring(i)
+        end
+        db:put_many(batch)
+
+        local cur = db:cursor()
+        print(cur:seek("k0500"))
+        print(cur:next())
+        print(cur:prev())
+        print(cur:last())
+        cur:close()
+
+        local count = 0
+        for k, v in db:scan({ prefix = "k", batch = 64 }) do
+            count = count + 1
+        end
+        print("prefix scan: " .. count)
+
+        count = 0
+        for k, v in db:scan({ prefix = "k09", from = "a" }) do
+            count = count + 1
+        end
+        print("prefix scan from an earlier key: " .. count)
+
+        local open = {}
+        for i = 1, 200 do
+            local it = db:scan({ batch = 1 })
+            it()
+            open[i] = it
+        end
+        print("get with 200 unfinished scans: " .. tostring(db:get("k0001")))
+        open = nil
+
+        local keys = {}
+        for k, v in db:scan({ from = "k0100", to = "k0105" }) do
+            keys[#keys + 1] = k
+        end
+        print(table.concat(keys, " "))
+
+        keys = {}
+        for k, v in db:scan({ from = "k0990", limit = 5 }) do
+            keys[#keys + 1] = k .. "=" .. v
+        end
+        print(table.concat(keys, " "))
+
+        db:close()
+
+        db = sevo.dbm.open("tabledb")
+        local tags = db:table("tags", { dupsort = true })
+        for i = 1, 5 do
+            tags:put("t", "v" .. i)
+        end
+        keys = {}
+        for k, v in tags:scan({ prefix = "t", batch = 2 }) do
+            keys[#keys + 1] = v
+        end
+        print(table.concat(keys, " "))
+
+        tags:close()
+        db:close()
+    end,
+    function()
+        print("-- Dbm snapshots --")
+        local db = sevo.dbm.open("scandb")
+        local blob = string.rep("abcdefgh", 1024)
+        db:put("blob", blob)
+
+        local snap = db:snapshot()
+        local v = snap:get("blob")
+        print(#v, v:byte(1, 3))
+        print(v:sub(5, 8):tostring(), v:sub(-4):tostring(), v:hash() == sevo.hash.h64(blob))
+
+        db:put("blob", "changed")
+        print(snap:get("blob"):len(), db:get("blob"))
+
+        snap:renew()
+        print(v:valid(), pcall(v.len, v))
+        print(snap:get("blob"):tostring())
+
+        local rounds = 100000
+        local t1 = sevo.time.microsec()
+        for i = 1, rounds do
+            db:get("k0500")
+        end
+        local t2 = sevo.time.microsec()
+        for i = 1, rounds do
+            snap:get("k0500")
+        end
+        local t3 = sevo.time.microsec()
+        print("dbm get: " .. math.floor((t2 - t1) * 1000 / rounds) .. " ns, snapshot get: " .. math.floor((t3 - t2) * 1000 / rounds) .. " ns")
+
+        snap:reset()
+        snap:close()
+        db:close()
+    end,
+    function()
+        print("-- Dbm shared env --")
+        local db = sevo.dbm.open("shareddb")
+        local batch = {}
+        for i = 1, 10000 do batch[string.format("k%05d", i)] = tostring(i) end
+        db:put_many(batch)
+
+        -- a second open of the path hands out the same env
+        local again = sevo.dbm.open("shareddb", { mapsize = 1024 * 1024 })
+        again:put("both", "yes")
+        print(db:get("both"), again:stat().entries == db:stat().entries)
+        again:close()
+        print(db:get("both"))
+
+        local reader = [[
+            local db = sevo.dbm.open("shareddb")
+            local reads = 0
+            for r = 1, 20 do
+                for i = 1, 10000 do
+                    if db:get(string.format("k%%05d", i)) then reads = reads + 1 end
+                end
+            end
+            for i = 1, 100 do db:put("w%d_" .. i, tostring(i)) end
+            db:close()
+            sevo.thread.write(reads)
+        ]]
+
+        local function run(workers)
+            local threads = {}
+            for w = 1, workers do
+                threads[w] = sevo.thread.new("dbm" .. workers .. "_" .. w, string.format(reader, w))
+            end
+
+            local t1 = sevo.time.microsec()
+            for _, t in ipairs(threads) do t:start() end
+
+            local reads = 0
+            for _, t in ipairs(threads) do
+                reads = reads + (t:read(60000) or 0)
+                t:join()
+            end
+            local t2 = sevo.time.microsec()
+
+            print(workers .. " workers: " .. reads .. " reads, " .. math.floor(reads / ((t2 - t1) / 1000000)) .. " reads/s")
+        end
+
+        run(1)
+        run(4)
+
+        local writes = 0
+        for k in db:scan({ prefix = "w" }) do writes = writes + 1 end
+        print("queued writes: " .. writes)
+
+        db:close()
+    end,
     function()
         print(sevo.node())
 
@@ -430,6 +1038,158 @@ local test_func = {
         pid = sevo.spawn(ping, 3)
         sevo.spawn(monitor, pid)
     end,
+    function()
+        print("-- Bench send/receive --")
+        local rounds = 10000
+        local idles = {}
+
+        for _, n in ipairs({ 100, 1000, 10000, 50000 }) do
+            while #idles < n do
+                table.insert(idles, sevo.spawn(function() sevo.receive() end))
+            end
+
+            local t1 = sevo.time.microsec()
+            for i = 1, rounds do
+                sevo.send(sevo.self(), i)
+                sevo.receive()
+            end
+            local t2 = sevo.time.microsec()
+
+            print("processes: " .. n .. ", send/receive: " .. (t2 - t1) / rounds .. "us")
+        end
+
+        for _, pid in ipairs(idles) do
+            sevo.send(pid, "quit")
+        end
+    end,
+    function()
+        print("-- Bench mailbox drain --")
+
+        for _, n in ipairs({ 1000, 10000, 100000 }) do
+            for i = 1, n do sevo.send(sevo.self(), i) end
+            print("pending: " .. sevo.pending())
+
+            local t1 = sevo.time.microsec()
+            for i = 1, n do sevo.receive() end
+            local t2 = sevo.time.microsec()
+
+            for i = 1, n do sevo.send(sevo.self(), i) end
+
+            local t3 = sevo.time.microsec()
+            local msgs = sevo.receive_many(n)
+            local t4 = sevo.time.microsec()
+
+            print("backlog: " .. n .. ", receive: " .. (t2 - t1) / n .. "us, receive_many: " .. (t4 - t3) / #msgs .. "us")
+        end
+    end,
+    function()
+        print("-- Bench idle scheduler tick --")
+        local idles = {}
+
+        for i = 1, 100000 do
+            table.insert(idles, sevo.spawn(function() sevo.receive() end))
+        end
+        sevo.scheduler(0)   -- let them all block in receive
+
+        local t1 = sevo.time.microsec()
+        for i = 1, 100 do sevo.scheduler(10) end
+        local t2 = sevo.time.microsec()
+
+        print("idle processes: " .. #idles .. ", tick: " .. (t2 - t1) / 100 .. "us")
+
+        for _, pid in ipairs(idles) do
+            sevo.send(pid, "quit")
+        end
+    end,
+    function()
+        print("-- Process reclamation --")
+        local old = sevo.spawn(function() end)
+        sevo.scheduler(0)
+
+        local new = sevo.spawn(function() sevo.receive() end)
+        print("old: " .. old .. ", new: " .. new .. ", old alive: " .. tostring(sevo.isalive(old)) .. ", send old: " .. tostring(sevo.send(old, "stale")))
+        sevo.send(new, "quit")
+
+        collectgarbage()
+        local m1 = collectgarbage("count")
+        for round = 1, 10 do
+            local pids = {}
+            for i = 1, 10000 do
+                pids[i] = sevo.spawn(function() sevo.receive() end)
+            end
+            sevo.scheduler(0)
+            for _, pid in ipairs(pids) do sevo.send(pid, "quit") end
+            sevo.scheduler(0)
+            sevo.scheduler(0)
+            collectgarbage()
+            print("round " .. round .. ", memory: " .. math.floor(collectgarbage("count") - m1) .. "KB")
+        end
+    end,
+    function()
+        print("-- Worker pool --")
+        sevo.worker.start(4)
+
+        local refs, pids = {}, {}
+        for i = 1, 16 do
+            refs[sevo.worker.spawn("test-worker")] = true
+        end
+        while #pids < 16 do
+            local msg = sevo.receive(1000)
+            if not msg then break end
+            if msg.signal == "SPAWN" and refs[msg.ref] then
+                table.insert(pids, msg.pid)
+            end
+        end
+
+        local workers = {}
+        local t1 = sevo.time.microsec()
+        for round = 1, 1000 do
+            for _, pid in ipairs(pids) do
+                sevo.send(pid, { from = sevo.self(), body = round })
+            end
+            for i = 1, #pids do
+                local msg = sevo.receive(1000)
+                if msg then workers[msg.worker] = (workers[msg.worker] or 0) + 1 end
+            end
+        end
+        local t2 = sevo.time.microsec()
+
+        print("processes: " .. #pids .. ", round trip: " .. (t2 - t1) / (1000 * #pids) .. "us")
+        for index, n in pairs(workers) do
+            print("worker " .. index .. ": " .. n .. " replies")
+        end
+
+        for _, pid in ipairs(pids) do
+            sevo.send(pid, "quit")
+        end
+        sevo.worker.stop()
+    end,
+    function()
+        print("-- Timer wheel --")
+        local fired, ticks = 0, 0
+
+        sevo.time.after(0, function(s) print("after 0: " .. s) end, "now")
+        sevo.time.after(50, function(a, b) print("after 50: " .. a + b) end, 20, 30)
+
+        local id = sevo.time.every(20, function()
+            ticks = ticks + 1
+            print("every 20: " .. ticks)
+        end)
+        sevo.time.after(100, function()
+            print("cancel every: " .. tostring(sevo.time.cancel(id)))
+            print("cancel again: " .. tostring(sevo.time.cancel(id)))
+        end)
+
+        local t1 = sevo.time.microsec()
+        for i = 1, 100000 do
+            sevo.time.after(i % 5000, function() fired = fired + 1 end)
+        end
+        local t2 = sevo.time.microsec()
+        for i = 1, 5000 do sevo.time.update(1) end
+        local t3 = sevo.time.microsec()
+
+        print("timers: 100000, add: " .. (t2 - t1) / 100000 .. "us, fire: " .. (t3 - t2) / 100000 .. "us, fired: " .. fired)
+    end,
     function()
         print(sevo.env.add("Hello", "World"))
         print(sevo.env.add("Hello", "Kitty"))
@@ -458,6 +1218,107 @@ local test_func = {
         print("socket version: " .. socket._VERSION)
         print("mime version: " .. mime._VERSION)
     end,
+    function ()
+        print("-- Socket framing --")
+        local socket = require("socket")
+        local server = socket.bind("127.0.0.1", 0)
+        local _, port = server:getsockname()
+        local client = socket.connect("127.0.0.1", port)
+        local conn = server:accept()
+
+        conn:settimeout(0)
+        conn:setframing("length", 4)
+        client:setframing("length", 4)
+
+        -- Drains between sends, so small socket buffers cannot stall the client.
+        client:settimeout(1)
+        local payload = string.rep("z", 1000)
+        local frames, got, err = {}, 0, nil
+        local t1 = sevo.time.microsec()
+        for i = 1, 1000 do
+            if not client:sendframe(payload) then break end
+
+            while got < i and (not err or err == "timeout") do
+                local _, count, e = conn:receiveframes(256, frames)
+                got, err = got + count, e
+            end
+        end
+        print("length frames: " .. got .. " in " .. (sevo.time.microsec() - t1) .. " us")
+
+        -- Non-blocking sends keep what the socket refused, frames stay whole.
+        client:settimeout(0)
+        local big, kept = string.rep("b", 65536), 0
+        for i = 1, 64 do
+            local _, k = client:sendframe(big)
+            kept = k or kept
+        end
+        got, err = 0, nil
+        local deadline = sevo.time.millisec() + 5000
+        while got < 64 and sevo.time.millisec() < deadline do
+            client:sendframe()
+            local list, count = conn:receiveframes(16, frames)
+            for i = 1, count do
+                if list[i] == big then got = got + 1 end
+            end
+        end
+        print("non-blocking frames: " .. got .. ", kept " .. tostring(kept > 0))
+        client:settimeout(1)
+
+        conn:setframing("delimiter", "\r\n")
+        client:send("first\r\nsec")
+        socket.sleep(0.01)
+        print(conn:receiveframe())
+        print(conn:receiveframe())
+        client:send("ond\r\n")
+        socket.sleep(0.01)
+        print(conn:receiveframe())
+
+        client:close()
+        conn:close()
+        server:close()
+    end,
+    function ()
+        print("-- Socket poll --")
+        local socket = require("socket")
+        local server = socket.bind("127.0.0.1", 0)
+        local _, port = server:getsockname()
+        local lines = 0
+
+        server:settimeout(0)
+        sevo.poll.add(server, "r", function(s)
+            local conn = s:accept()
+            if not conn then return end
+
+            conn:settimeout(0)
+            sevo.poll.add(conn, "r", function(c)
+                local line, err = c:receive()
+                if line then
+                    lines = lines + 1
+                elseif err == "closed" then
+                    sevo.poll.remove(c)
+                    c:close()
+                end
+            end)
+        end)
+
+        local clients = {}
+        for i = 1, 100 do
+            clients[i] = socket.connect("127.0.0.1", port)
+            sevo.poll.wait(0)
+        end
+
+        local t1 = sevo.time.microsec()
+        while sevo.poll.count() < 101 do sevo.poll.wait(10) end
+        for i, c in ipairs(clients) do c:send("ping\npong\n") end
+        while lines < 200 do sevo.poll.wait(10) end
+        print(sevo.poll.backend() .. " lines: " .. lines .. " in " .. (sevo.time.microsec() - t1) .. " us")
+
+        for i, c in ipairs(clients) do c:close() end
+        while sevo.poll.count() > 1 do sevo.poll.wait(10) end
+        sevo.poll.remove(server)
+        server:close()
+        print("poll count: " .. sevo.poll.count())
+    end,
     function ()
         local a = sevo.math.vec2()
         local b = sevo.math.vec2(3)
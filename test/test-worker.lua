@@ -0,0 +1,9 @@
+-- Process body spawned on the worker pool by servo.lua
+
+return function()
+    while true do
+        local msg = sevo.receive()
+        if msg == "quit" then break end
+        sevo.send(msg.from, { body = msg.body, worker = sevo.worker.index() })
+    end
+end